@@ -868,6 +868,10 @@ int main()
 
 	LvnModel lvnmodel = lvn::loadModel("/home/bma/Documents/models/gltf/gameboy/scene.gltf");
 
+	// keep the per mesh data used every frame in packed arrays
+	LvnMeshStore meshStore;
+	meshStore.add_model(lvnmodel);
+
 	LvnDescriptorUpdateInfo descriptorUniformUpdateInfo{};
 	descriptorUniformUpdateInfo.descriptorType = Lvn_DescriptorType_StorageBuffer;
 	descriptorUniformUpdateInfo.binding = 0;
@@ -974,11 +978,12 @@ int main()
 		lvn::renderBeginCommandRecording(window);
 		lvn::renderCmdBeginFrameBuffer(window, frameBuffer);
 
-		objectData.resize(lvnmodel.meshes.size());
-		for (uint32_t i = 0; i < lvnmodel.meshes.size(); i++)
+		LvnSpan<LvnMat4> meshTransforms = meshStore.transforms();
+		objectData.resize(meshTransforms.size());
+		for (uint32_t i = 0; i < meshTransforms.size(); i++)
 		{
 			objectData[i].matrix = camera.matrix;
-			objectData[i].model = lvnmodel.meshes[i].modelMatrix * model;
+			objectData[i].model = meshTransforms[i] * model;
 		}
 
 		pbrData.campPos = lvn::cameraGetPos(&camera);
@@ -990,15 +995,17 @@ int main()
 		lvn::updateUniformBufferData(window, pbrUniformBuffer, &pbrData, sizeof(PbrUniformData));
 
 		lvn::renderCmdBindPipeline(window, pipeline);
-		lvn::updateUniformBufferData(window, uniformBuffer, objectData.data(), sizeof(PbrStorageData) * lvnmodel.meshes.size());
+		lvn::updateUniformBufferData(window, uniformBuffer, objectData.data(), sizeof(PbrStorageData) * objectData.size());
 		lvn::renderCmdBindDescriptorSets(window, pipeline, 0, 1, &descriptorSet);
 
-		for (uint32_t i = 0; i < lvnmodel.meshes.size(); i++)
+		LvnSpan<LvnBuffer*> meshBuffers = meshStore.buffers();
+		LvnSpan<LvnMeshDrawRange> meshDrawRanges = meshStore.draw_ranges();
+		for (uint32_t i = 0; i < meshStore.size(); i++)
 		{
-			lvn::renderCmdBindVertexBuffer(window, lvn::meshGetBuffer(&lvnmodel.meshes[i]));
-			lvn::renderCmdBindIndexBuffer(window, lvn::meshGetBuffer(&lvnmodel.meshes[i]));
+			lvn::renderCmdBindVertexBuffer(window, meshBuffers[i]);
+			lvn::renderCmdBindIndexBuffer(window, meshBuffers[i]);
 
-			lvn::renderCmdDrawIndexedInstanced(window, lvnmodel.meshes[i].indexCount, 1, i);
+			lvn::renderCmdDrawIndexedInstanced(window, meshDrawRanges[i].indexCount, 1, i);
 		}
 
 		// draw cubemap
@@ -192,6 +192,37 @@ int main(int argc, char** argv)
 	int code = 4;
 	lvn::logMessageError(logger, "failed to do thing, error code: %d", code);
 
+	printf("\n");
+
+
+	// [Log sinks]
+	// - a logger outputs to stdout by default, sinks can be added to output messages to other places
+	// - each sink has its own log level and can have its own log pattern
+	// - file sinks buffer messages and write them to the file in large chunks, errors are written immediately
+	// - ring sinks keep the most recent messages in memory so they can be dumped later, eg. after a crash
+
+	LvnLogSinkCreateInfo fileSinkCreateInfo{};
+	fileSinkCreateInfo.type = Lvn_LogSinkType_File;
+	fileSinkCreateInfo.logLevel = Lvn_LogLevel_Info;
+	fileSinkCreateInfo.logPatternFormat = "[%T] [%l] %n: %v%$";  // no color codes in the file
+	fileSinkCreateInfo.filepath = "logging_example.log";
+	fileSinkCreateInfo.maxFileSize = 1024 * 1024;                // rotate after 1 MiB
+	fileSinkCreateInfo.maxFiles = 3;                             // keep logging_example.log.1 to logging_example.log.3
+	lvn::logAddSink(logger, &fileSinkCreateInfo);
+
+	LvnLogSinkCreateInfo ringSinkCreateInfo{};
+	ringSinkCreateInfo.type = Lvn_LogSinkType_Ring;
+	ringSinkCreateInfo.logLevel = Lvn_LogLevel_None;
+	ringSinkCreateInfo.ringSize = 4096;
+	uint32_t ringSinkIndex;
+	lvn::logAddSink(logger, &ringSinkCreateInfo, &ringSinkIndex);
+
+	lvn::logMessageInfo(logger, "this message is written to stdout, the log file and the ring");
+	lvn::logMessageTrace(logger, "this message is not written to the log file");
+
+	// write the recent messages kept by the ring sink to stderr
+	lvn::logSinkDumpRing(logger, ringSinkIndex, nullptr);
+
 
 	// remember to destroy the logger like any other object
 	lvn::destroyLogger(logger);
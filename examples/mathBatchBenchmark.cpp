@@ -0,0 +1,94 @@
+#include <levikno/levikno.h>
+
+#include <vector>
+
+// INFO: this program compares the batch vector functions with transforming each vector in a loop,
+//       the batch functions use avx2 or sse depending on what the cpu supports
+
+
+static const size_t s_VectorCount = 1 << 20;
+static const int s_Iterations = 20;
+
+// runs the function several times and returns the fastest time in milliseconds
+template <typename F>
+static double benchmark(F&& func)
+{
+	double best = 0.0;
+	for (int i = 0; i < s_Iterations; i++)
+	{
+		uint64_t start = lvn::clockNowNs();
+		func();
+		double ms = lvn::clockNsToMs(lvn::clockNowNs() - start);
+		if (i == 0 || ms < best) { best = ms; }
+	}
+
+	return best;
+}
+
+static void printResult(const char* name, double ms, double baselineMs)
+{
+	double vectorsPerNs = static_cast<double>(s_VectorCount) / (ms * 1e6);
+	LVN_INFO("%-28s %8.3f ms  %6.3f vectors/ns  %5.2fx", name, ms, vectorsPerNs, baselineMs / ms);
+}
+
+int main(int argc, char** argv)
+{
+	LvnContextCreateInfo lvnCreateInfo{};
+	lvnCreateInfo.logging.enableLogging = true;
+	lvnCreateInfo.logging.disableCoreLogging = true;
+
+	lvn::createContext(&lvnCreateInfo);
+
+	LVN_INFO("batch instruction set: %s, %zu vectors, best of %d runs", lvn::mathGetBatchInstructionSet(), s_VectorCount, s_Iterations);
+
+	LvnMat4 model = lvn::translate(LvnMat4(1.0f), LvnVec3(1.0f, 2.0f, 3.0f)) * lvn::rotate(LvnMat4(1.0f), lvn::radians(30.0f), LvnVec3(0.0f, 1.0f, 0.0f));
+
+	std::vector<LvnVec3> points(s_VectorCount), results(s_VectorCount);
+	for (size_t i = 0; i < s_VectorCount; i++)
+		points[i] = LvnVec3(static_cast<float>(i % 97), static_cast<float>(i % 89) * 0.5f, static_cast<float>(i % 83) * 0.25f + 1.0f);
+
+	std::vector<float> x(s_VectorCount), y(s_VectorCount), z(s_VectorCount), dots(s_VectorCount);
+	lvn::vectorsAoSToSoA(points.data(), x.data(), y.data(), z.data(), s_VectorCount);
+
+
+	// [Transform]
+	// the loop below is the usual way of transforming points, each point is extended to a vec4 and multiplied by the matrix
+	double loopMs = benchmark([&]()
+	{
+		for (size_t i = 0; i < s_VectorCount; i++)
+			results[i] = LvnVec3(model * LvnVec4(points[i], 1.0f));
+	});
+	printResult("transform (loop)", loopMs, loopMs);
+
+	// transformPoints does the same for the whole array
+	printResult("transformPoints", benchmark([&]() { lvn::transformPoints(model, points.data(), results.data(), s_VectorCount); }), loopMs);
+	printResult("transformDirections", benchmark([&]() { lvn::transformDirections(model, points.data(), results.data(), s_VectorCount); }), loopMs);
+
+	// data that is already stored as separate x, y, z arrays does not need to be deinterleaved
+	printResult("transformPointsSoA", benchmark([&]() { lvn::transformPointsSoA(model, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), s_VectorCount); }), loopMs);
+
+
+	// [Normalize]
+	double normalizeLoopMs = benchmark([&]()
+	{
+		for (size_t i = 0; i < s_VectorCount; i++)
+			results[i] = lvn::normalize(points[i]);
+	});
+	printResult("normalize (loop)", normalizeLoopMs, normalizeLoopMs);
+	printResult("normalizeVectors", benchmark([&]() { lvn::normalizeVectors(points.data(), results.data(), s_VectorCount); }), normalizeLoopMs);
+
+
+	// [Dot]
+	double dotLoopMs = benchmark([&]()
+	{
+		for (size_t i = 0; i < s_VectorCount; i++)
+			dots[i] = lvn::dot(points[i], results[i]);
+	});
+	printResult("dot (loop)", dotLoopMs, dotLoopMs);
+	printResult("dotVectors", benchmark([&]() { lvn::dotVectors(points.data(), results.data(), dots.data(), s_VectorCount); }), dotLoopMs);
+
+
+	lvn::terminateContext();
+
+	return 0;
+}
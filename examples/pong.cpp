@@ -24,6 +24,8 @@ struct DrawCommand
 	uint32_t indexCount;
 };
 
+// draw lists are rebuilt every frame, their vectors use the frame allocator so that growing them is a pointer bump that is reclaimed in lvn::renderBeginNextFrame
+// because of this a draw list must only be used within the frame it was created in
 class DrawList
 {
 public:
@@ -32,21 +34,19 @@ public:
 	uint64_t vertexSize;
 	uint64_t indexSize;
 
-	std::vector<Vertex> vertices;
-	std::vector<uint32_t> indices;
-	std::vector<DrawCommand> drawCommands;
+	LvnFrameVector<Vertex> vertices;
+	LvnFrameVector<uint32_t> indices;
+	LvnFrameVector<DrawCommand> drawCommands;
 
 	void push_back(const DrawCommand& drawCmd)
 	{
 		this->drawCommands.push_back(drawCmd);
-		
-		std::vector<uint32_t> batchIndices(drawCmd.pIndices, drawCmd.pIndices + drawCmd.indexCount);
-
-		for (auto& index : batchIndices)
-			index += this->vertexCount;
 
 		this->vertices.insert(this->vertices.end(), drawCmd.pVertices, drawCmd.pVertices + drawCmd.vertexCount);
-		this->indices.insert(this->indices.end(), batchIndices.begin(), batchIndices.end());
+
+		// offset the indices of the batch by the vertices already in the list
+		for (uint32_t i = 0; i < drawCmd.indexCount; i++)
+			this->indices.push_back(drawCmd.pIndices[i] + this->vertexCount);
 
 		this->vertexCount += drawCmd.vertexCount;
 		this->indexCount += drawCmd.indexCount;
@@ -511,8 +511,7 @@ int main(int argc, char** argv)
 	lvn::createSoundFromFile(&soundWin, &soundWinCreateInfo);
 
 
-	// draw list and game objects
-	DrawList list{};
+	// game objects
 	UniformData uniformData{};
 
 	float oldTime = 0.0f;
@@ -555,6 +554,9 @@ int main(int argc, char** argv)
 	{
 		lvn::windowUpdate(window);
 
+		// draw list memory comes from the frame allocator, create a new list each frame
+		DrawList list{};
+
 		int width, height;
 		lvn::windowGetSize(window, &width, &height);
 
@@ -730,8 +732,6 @@ int main(int argc, char** argv)
 		lvn::renderCmdEndRenderPass(window);
 		lvn::renderEndCommandRecording(window);
 		lvn::renderDrawSubmit(window); // note that this function is where we actually submit our render data to the GPU
-
-		list.clear();
 	}
 
 	lvn::destroySound(sound);
@@ -69,6 +69,8 @@ struct DrawCommand
 	uint32_t indexCount;
 };
 
+// draw lists are rebuilt every frame, their vectors use the frame allocator so that growing them is a pointer bump that is reclaimed in lvn::renderBeginNextFrame
+// because of this a draw list must only be used within the frame it was created in
 class DrawList
 {
 public:
@@ -77,21 +79,19 @@ public:
 	uint64_t vertexSize;
 	uint64_t indexSize;
 
-	std::vector<Vertex> vertices;
-	std::vector<uint32_t> indices;
-	std::vector<DrawCommand> drawCommands;
+	LvnFrameVector<Vertex> vertices;
+	LvnFrameVector<uint32_t> indices;
+	LvnFrameVector<DrawCommand> drawCommands;
 
 	void push_back(const DrawCommand& drawCmd)
 	{
 		this->drawCommands.push_back(drawCmd);
-		
-		std::vector<uint32_t> batchIndices(drawCmd.pIndices, drawCmd.pIndices + drawCmd.indexCount);
-
-		for (auto& index : batchIndices)
-			index += this->vertexCount;
 
 		this->vertices.insert(this->vertices.end(), drawCmd.pVertices, drawCmd.pVertices + drawCmd.vertexCount);
-		this->indices.insert(this->indices.end(), batchIndices.begin(), batchIndices.end());
+
+		// offset the indices of the batch by the vertices already in the list
+		for (uint32_t i = 0; i < drawCmd.indexCount; i++)
+			this->indices.push_back(drawCmd.pIndices[i] + this->vertexCount);
 
 		this->vertexCount += drawCmd.vertexCount;
 		this->indexCount += drawCmd.indexCount;
@@ -384,7 +384,6 @@ int main(int argc, char** argv)
 	lvn::updateDescriptorSetData(descriptorSet, descriptorUpdateInfos, ARRAY_LEN(descriptorUpdateInfos));
 
 	UniformData uniformData{};
-	DrawList list{};
 
 	Timer timer;
 	timer.start();
@@ -402,6 +401,9 @@ int main(int argc, char** argv)
 	{
 		lvn::windowUpdate(window);
 
+		// draw list memory comes from the frame allocator, create a new list each frame
+		DrawList list{};
+
 		int width, height;
 		lvn::windowGetSize(window, &width, &height);
 
@@ -484,8 +486,6 @@ int main(int argc, char** argv)
 		lvn::renderCmdEndRenderPass(window);
 		lvn::renderEndCommandRecording(window);
 		lvn::renderDrawSubmit(window); // note that this function is where we actually submit our render data to the GPU
-
-		list.clear();
 	}
 
 	// destroy objects after they are finished being used
@@ -94,6 +94,7 @@
 
 
 #include <cstdlib> // malloc, free
+#include <cstddef> // size_t, max_align_t
 #include <cstdint> // uint8_t, uint16_t, uint32_t, uint64_t
 #include <cstring> // strlen
 #include <cmath>
@@ -104,8 +105,53 @@
 #include <queue>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <type_traits>
 #include <condition_variable>
 
+// Math simd, float 4x4 matrix operations use sse on x86 and neon on arm
+// the instruction set is chosen at compile time, define LVN_MATH_NO_SIMD to use the scalar templates only
+// avx is only used when LVN_MATH_SIMD_AVX is defined by the build (the cmake option of the same name), never from the compiler flags of
+// one file, so that the library and every file of the application compile the inline matrix functions the same way
+#if !defined(LVN_MATH_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define LVN_MATH_SIMD_SSE
+		#include <xmmintrin.h>
+		#if defined(LVN_MATH_SIMD_AVX)
+			#if !defined(__AVX__)
+				#error "LVN_MATH_SIMD_AVX is defined but this file is not compiled with avx (-mavx or /arch:AVX)"
+			#endif
+			#include <immintrin.h>
+		#endif
+	#elif defined(__ARM_NEON) || defined(_M_ARM64)
+		#define LVN_MATH_SIMD_NEON
+		#include <arm_neon.h>
+	#endif
+#endif
+
+#if !defined(LVN_MATH_SIMD_SSE)
+	#undef LVN_MATH_SIMD_AVX
+#endif
+
+// Math constexpr, true while a function is evaluated in a constant expression so the simd and sqrt paths can fall back to plain code
+// compilers without std::is_constant_evaluated or the builtin define LVN_MATH_NO_CONSTANT_EVALUATED, float matrix math and sqrt then only work at runtime
+#if defined(__cpp_lib_is_constant_evaluated)
+	#define LVN_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+	#if __has_builtin(__builtin_is_constant_evaluated)
+		#define LVN_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+	#endif
+#endif
+#if !defined(LVN_IS_CONSTANT_EVALUATED) && ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+	#define LVN_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(LVN_IS_CONSTANT_EVALUATED)
+	#define LVN_IS_CONSTANT_EVALUATED() false
+	#define LVN_MATH_NO_CONSTANT_EVALUATED
+#endif
+
 using std::abs;
 using std::acos;
 using std::asin;
@@ -196,21 +242,74 @@ using std::fmod;
 #define LVN_LOG_COLOR_RESET                     "\x1b[0m"
 
 
-// Core Log macros
-#define LVN_CORE_TRACE(...)                     ::lvn::logMessageTrace(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_DEBUG(...)                     ::lvn::logMessageDebug(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_INFO(...)                      ::lvn::logMessageInfo(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_WARN(...)                      ::lvn::logMessageWarn(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_ERROR(...)                     ::lvn::logMessageError(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_FATAL(...)                     ::lvn::logMessageFatal(lvn::logGetCoreLogger(), ##__VA_ARGS__)
+// Log levels for LVN_LOG_ACTIVE_LEVEL, same values as LvnLogLevel
+#define LVN_LOG_LEVEL_TRACE                     1
+#define LVN_LOG_LEVEL_DEBUG                     2
+#define LVN_LOG_LEVEL_INFO                      3
+#define LVN_LOG_LEVEL_WARN                      4
+#define LVN_LOG_LEVEL_ERROR                     5
+#define LVN_LOG_LEVEL_FATAL                     6
+#define LVN_LOG_LEVEL_OFF                       7
+
+// log macros below this level compile to nothing, define before including levikno.h to override
+#ifndef LVN_LOG_ACTIVE_LEVEL
+	#ifdef LVN_CONFIG_DEBUG
+		#define LVN_LOG_ACTIVE_LEVEL            LVN_LOG_LEVEL_TRACE
+	#else
+		#define LVN_LOG_ACTIVE_LEVEL            LVN_LOG_LEVEL_INFO
+	#endif
+#endif
+
+// checks the logger level before the message arguments are evaluated, the logger expression may be evaluated twice
+#define LVN_LOG_CALL(logger, level, func, ...)  (::lvn::logShouldOutput(logger, level) ? func(logger, __VA_ARGS__) : (void)0)
+
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_TRACE
+	#define LVN_CORE_TRACE(...)                 LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Trace, ::lvn::logMessageTrace, __VA_ARGS__)
+	#define LVN_TRACE(...)                      LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Trace, ::lvn::logMessageTrace, __VA_ARGS__)
+#else
+	#define LVN_CORE_TRACE(...)                 ((void)0)
+	#define LVN_TRACE(...)                      ((void)0)
+#endif
+
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_DEBUG
+	#define LVN_CORE_DEBUG(...)                 LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Debug, ::lvn::logMessageDebug, __VA_ARGS__)
+	#define LVN_DEBUG(...)                      LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Debug, ::lvn::logMessageDebug, __VA_ARGS__)
+#else
+	#define LVN_CORE_DEBUG(...)                 ((void)0)
+	#define LVN_DEBUG(...)                      ((void)0)
+#endif
+
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_INFO
+	#define LVN_CORE_INFO(...)                  LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Info, ::lvn::logMessageInfo, __VA_ARGS__)
+	#define LVN_INFO(...)                       LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Info, ::lvn::logMessageInfo, __VA_ARGS__)
+#else
+	#define LVN_CORE_INFO(...)                  ((void)0)
+	#define LVN_INFO(...)                       ((void)0)
+#endif
+
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_WARN
+	#define LVN_CORE_WARN(...)                  LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Warn, ::lvn::logMessageWarn, __VA_ARGS__)
+	#define LVN_WARN(...)                       LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Warn, ::lvn::logMessageWarn, __VA_ARGS__)
+#else
+	#define LVN_CORE_WARN(...)                  ((void)0)
+	#define LVN_WARN(...)                       ((void)0)
+#endif
+
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_ERROR
+	#define LVN_CORE_ERROR(...)                 LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Error, ::lvn::logMessageError, __VA_ARGS__)
+	#define LVN_ERROR(...)                      LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Error, ::lvn::logMessageError, __VA_ARGS__)
+#else
+	#define LVN_CORE_ERROR(...)                 ((void)0)
+	#define LVN_ERROR(...)                      ((void)0)
+#endif
 
-// Client Log macros
-#define LVN_TRACE(...)                          ::lvn::logMessageTrace(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_DEBUG(...)                          ::lvn::logMessageDebug(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_INFO(...)                           ::lvn::logMessageInfo(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_WARN(...)                           ::lvn::logMessageWarn(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_ERROR(...)                          ::lvn::logMessageError(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_FATAL(...)                          ::lvn::logMessageFatal(lvn::logGetClientLogger(), ##__VA_ARGS__)
+#if LVN_LOG_ACTIVE_LEVEL <= LVN_LOG_LEVEL_FATAL
+	#define LVN_CORE_FATAL(...)                 LVN_LOG_CALL(::lvn::logGetCoreLogger(), Lvn_LogLevel_Fatal, ::lvn::logMessageFatal, __VA_ARGS__)
+	#define LVN_FATAL(...)                      LVN_LOG_CALL(::lvn::logGetClientLogger(), Lvn_LogLevel_Fatal, ::lvn::logMessageFatal, __VA_ARGS__)
+#else
+	#define LVN_CORE_FATAL(...)                 ((void)0)
+	#define LVN_FATAL(...)                      ((void)0)
+#endif
 
 
 // Logging utils
@@ -218,6 +317,21 @@ using std::fmod;
 #define LVN_LOG_FILE                            LVN_FILE_NAME ":" LVN_STRINGIFY(LVN_LINE) " - "
 
 
+// Profiling
+// zones record the time spent in a scope while a profiling session is running, see lvn::profileBeginSession
+// the zone macros compile to nothing unless LVN_ENABLE_PROFILING is defined (cmake option LVN_ENABLE_PROFILING)
+#define LVN_CONCAT_IMPL(a, b)                   a##b
+#define LVN_CONCAT(a, b)                        LVN_CONCAT_IMPL(a, b)
+
+#ifdef LVN_ENABLE_PROFILING
+	#define LVN_PROFILE_SCOPE(name)             LvnProfileScope LVN_CONCAT(lvnProfileScope, LVN_LINE)(name)
+	#define LVN_PROFILE_FUNCTION()              LVN_PROFILE_SCOPE(LVN_FUNC_NAME)
+#else
+	#define LVN_PROFILE_SCOPE(name)             ((void)0)
+	#define LVN_PROFILE_FUNCTION()              ((void)0)
+#endif
+
+
 // ---------------------------------------------
 // [SECTION]: Enums
 // ---------------------------------------------
@@ -260,6 +374,17 @@ enum LvnMemAllocMode
 	Lvn_MemAllocMode_MemPool,
 };
 
+enum LvnMemoryTag
+{
+	Lvn_MemoryTag_Core,
+	Lvn_MemoryTag_Graphics,
+	Lvn_MemoryTag_Audio,
+	Lvn_MemoryTag_Network,
+	Lvn_MemoryTag_Assets,
+
+	Lvn_MemoryTag_Max,
+};
+
 enum LvnClipRegion
 {
 	Lvn_ClipRegion_ApiSpecific,
@@ -456,6 +581,30 @@ enum LvnLogLevel
 	Lvn_LogLevel_Fatal      = 6,
 };
 
+// what to do when the async log queue is full
+enum LvnLogOverflowPolicy
+{
+	Lvn_LogOverflowPolicy_Block = 0,    // wait for the writer thread to make room, no messages are lost
+	Lvn_LogOverflowPolicy_DropNewest,   // discard the message being logged
+	Lvn_LogOverflowPolicy_DropOldest,   // discard the oldest queued message to make room for the new one
+};
+
+enum LvnLogSinkType
+{
+	Lvn_LogSinkType_Stdout = 0,         // print messages to stdout
+	Lvn_LogSinkType_File,               // buffer messages and write them to a file, the file can be rotated by size or time
+	Lvn_LogSinkType_Ring,               // keep the most recent messages in a fixed size memory ring that can be dumped later (eg. on crash)
+	Lvn_LogSinkType_Binary,             // record the format string id, time and raw arguments to a file without formatting, decode the file with the lvnlogdecode tool. format strings are identified by address and must stay valid (eg. string literals)
+};
+
+// when a file sink asks the OS to write its data to disk
+enum LvnLogFsyncPolicy
+{
+	Lvn_LogFsyncPolicy_Never = 0,       // leave it to the OS, fastest
+	Lvn_LogFsyncPolicy_OnFlush,         // fsync every time the sink buffer is written to the file
+	Lvn_LogFsyncPolicy_EveryMessage,    // write and fsync after every message, slowest but nothing is lost on crash
+};
+
 enum LvnEventType
 {
 	Lvn_EventType_None = 0,
@@ -499,6 +648,29 @@ enum LvnWindowApi
 	// Lvn_WindowApi_WIN32 = Lvn_WindowApi_Win32,
 };
 
+enum LvnThreadPriority
+{
+	Lvn_ThreadPriority_Normal = 0,
+	Lvn_ThreadPriority_Low,             // background work that should give way to the rest of the program
+	Lvn_ThreadPriority_High,
+	Lvn_ThreadPriority_Highest,         // realtime scheduling where permitted, falls back to High
+};
+
+enum LvnThreadAffinityMode
+{
+	Lvn_ThreadAffinityMode_None = 0,    // workers may run on any core that is not reserved
+	Lvn_ThreadAffinityMode_Core,        // each worker is pinned to a single core
+	Lvn_ThreadAffinityMode_CacheDomain, // each worker may run on any core sharing the last level cache with its assigned core
+};
+
+/* [Asset Enums] */
+enum LvnAssetLoadState
+{
+	Lvn_AssetLoadState_Loading = 0,     // the file is being read and decoded, or the graphics objects have not been created yet
+	Lvn_AssetLoadState_Ready,           // the asset can be taken with the assetLoadGet functions
+	Lvn_AssetLoadState_Failed,
+};
+
 /* [Graphics Enums] */
 enum LvnBufferType
 {
@@ -727,8 +899,10 @@ enum LvnSocketType
 };
 
 struct LvnAddress;
+struct LvnAllocationCallbacks;
 struct LvnAppRenderEvent;
 struct LvnAppTickEvent;
+struct LvnAssetLoad;
 struct LvnBatchCreateInfo;
 struct LvnBatchRenderer;
 struct LvnBuffer;
@@ -752,6 +926,12 @@ struct LvnFrameBuffer;
 struct LvnFrameBufferColorAttachment;
 struct LvnFrameBufferCreateInfo;
 struct LvnFrameBufferDepthAttachment;
+struct LvnFramePacer;
+struct LvnFramePacerCreateInfo;
+struct LvnFramePacerStats;
+struct LvnFrameStats;
+struct LvnGpuPipelineStatistics;
+struct LvnGpuTiming;
 struct LvnGraphicsContext;
 struct LvnImageData;
 struct LvnKeyHoldEvent;
@@ -760,10 +940,17 @@ struct LvnKeyReleasedEvent;
 struct LvnKeyTypedEvent;
 struct LvnLogger;
 struct LvnLoggerCreateInfo;
+struct LvnLogSinkCreateInfo;
 struct LvnLogMessage;
 struct LvnLogPattern;
 struct LvnMaterial;
+struct LvnMeshBounds;
+struct LvnMeshDrawRange;
+struct LvnMeshHandle;
 struct LvnMemoryBindingInfo;
+struct LvnMemoryGrowthInfo;
+struct LvnMemoryStats;
+struct LvnMemoryTagStats;
 struct LvnMesh;
 struct LvnMeshCreateInfo;
 struct LvnMeshTextureBindings;
@@ -798,8 +985,11 @@ struct LvnSocketCreateInfo;
 struct LvnSound;
 struct LvnSoundBoard;
 struct LvnSoundCreateInfo;
+struct LvnStructureTypeMemoryStats;
 struct LvnTexture;
 struct LvnTextureCreateInfo;
+struct LvnThreadPoolCreateInfo;
+struct LvnThreadWorkerStats;
 struct LvnUniformBuffer;
 struct LvnUniformBufferCreateInfo;
 struct LvnVertex;
@@ -828,6 +1018,15 @@ struct LvnDoublePair;
 template<typename T>
 class LvnData;
 
+template<typename T>
+class LvnSpan;
+
+template<typename T>
+class LvnFrameAllocator;
+
+class LvnJobCounter;
+class LvnMeshStore;
+class LvnProfileScope;
 class LvnTimer;
 class LvnThreadPool;
 
@@ -1032,6 +1231,13 @@ namespace lvn
 	LVN_API int                     dateGetSecond();                                    // get the second of the current dat (0...60)
 	LVN_API long long               dateGetSecondsSinceEpoch();                         // get the time in seconds since 00::00:00 UTC 1 January 1970
 
+	LVN_API uint32_t                threadGetCoreCount();                               // get the number of logical cores
+	LVN_API uint32_t                threadGetCacheDomainCores(uint32_t core, uint32_t* pCores, uint32_t maxCount); // get the cores sharing the last level cache with core, returns the number of cores written (just core itself if the topology is unknown)
+	LVN_API LvnResult               threadSetAffinity(const uint32_t* pCores, uint32_t coreCount); // restrict the calling thread to the given cores, not supported on macOS
+	LVN_API LvnResult               threadSetPriority(LvnThreadPriority priority);      // set the scheduling priority of the calling thread, raising the priority may need elevated permissions
+	LVN_API void                    threadSetName(const char* name);                    // set the name of the calling thread shown in debuggers and profilers
+	LVN_API LvnThreadPool*          getJobThreadPool();                                 // general purpose job pool configured with LvnContextCreateInfo::threading.jobWorkers, created with the first call
+
 	LVN_API const char*             dateGetMonthName();                                 // get the current month name (eg. January, April)
 	LVN_API const char*             dateGetMonthNameShort();                            // get the current month shortened name (eg. Jan, Apr)
 	LVN_API const char*             dateGetWeekDayName();                               // get the current day name in the week (eg. Monday, Friday)
@@ -1050,7 +1256,17 @@ namespace lvn
 	LVN_API std::string             dateGetMinuteNumStr();                              // get the current minute as a string
 	LVN_API std::string             dateGetSecondNumStr();                              // get the current second as a string
 
-	LVN_API float                   getContextTime();                                   // get time in seconds since context creation
+	LVN_API float                   getContextTime();                                   // get time in seconds since context creation, float seconds lose precision after a few hours, use getContextTimeNs for long running programs
+	LVN_API uint64_t                getContextTimeNs();                                 // get time in nanoseconds since context creation
+	LVN_API double                  getContextTimeSeconds();                            // get time in seconds since context creation as a double
+
+	// the clock functions can be called without a context
+	LVN_API uint64_t                clockNowNs();                                       // monotonic time in nanoseconds (CLOCK_MONOTONIC, QueryPerformanceCounter on windows), not affected by changes to the system time
+	LVN_API uint64_t                clockNowTicks();                                    // read the cpu cycle counter (invariant tsc on x86, cntvct on arm64), falls back to clockNowNs if there is no usable counter
+	LVN_API uint64_t                clockTicksToNs(uint64_t ticks);                     // convert ticks from clockNowTicks into the same time base as clockNowNs, the tick rate is calibrated when first used and the conversion is compared against clockNowNs about once a second, errors are slewed away instead of stepped so later ticks never convert to earlier times
+	LVN_API double                  clockGetTickFrequency();                            // ticks per second of clockNowTicks
+	LVN_API double                  clockNsToSeconds(uint64_t ns);
+	LVN_API double                  clockNsToMs(uint64_t ns);
 
 	LVN_API std::string             loadFileSrc(const char* filepath);                                     // get the src contents from a text file format, filepath must be a valid path to a text file
 	LVN_API LvnBin                  loadFileSrcBin(const char* filepath);                                  // get the binary data contents (in unsigned char*) from a binary file (eg .spv), filepath must be a valid path to a binary file
@@ -1059,9 +1275,18 @@ namespace lvn
 	LVN_API LvnFontGlyph            fontGetGlyph(LvnFont* font, int8_t codepoint);
 
 
-	LVN_API void*                   memAlloc(size_t size);                              // custom memory allocation function that allocates memory given the size of memory, note that function is connected with the context and will keep track of allocation counts, will increment number of allocations per use
+	LVN_API void*                   memAlloc(size_t size, LvnMemoryTag tag = Lvn_MemoryTag_Core);    // custom memory allocation function that allocates memory given the size of memory, note that function is connected with the context and will keep track of allocation counts and bytes under the given subsystem tag, will increment number of allocations per use
 	LVN_API void                    memFree(void* ptr);                                 // custom memory free function, note that it keeps track of memory allocations remaining, decrements number of allocations per use with lvn::memAlloc
-	LVN_API void*                   memRealloc(void* ptr, size_t size);                 // custom memory realloc function
+	LVN_API void*                   memRealloc(void* ptr, size_t size);                 // custom memory realloc function, ptr must be nullptr or allocated with lvn::memAlloc
+	LVN_API LvnAllocationCallbacks* memGetAllocationCallbacks();                        // get the allocation callbacks set when creating the context, returns nullptr if none were set
+
+	LVN_API void*                   frameAlloc(size_t size, size_t alignment = alignof(std::max_align_t));  // allocate temporary memory that lives until the same frame comes around again, memory is reclaimed all at once in renderBeginNextFrame so it must not be freed; frames are buffered per maxFramesInFlight so memory allocated before renderBeginNextFrame is still valid for the rest of that frame; with several windows the frame advances once per frame, not once per window; can be called from any thread during a frame but not at the same time as renderBeginNextFrame, which reclaims the memory without waiting for other threads
+	LVN_API uint64_t                frameAllocGetUsed();                                                   // get the number of bytes allocated with lvn::frameAlloc in the current frame
+
+	LVN_API LvnResult               memPoolReserve(LvnStructureType sType, uint64_t count);  // grows the memory pool so that at least count objects of sType can be created without allocating, only used with Lvn_MemAllocMode_MemPool
+	LVN_API void                    memPoolShrink(LvnStructureType sType);                   // frees memory blocks of sType that were grown after the first memory block and no longer hold any objects, must not be called while other threads create or destroy objects of the same sType
+	LVN_API uint64_t                memPoolGetCapacity(LvnStructureType sType);              // get the total number of objects of sType that the memory pool currently has memory for
+	LVN_API LvnMemoryStats          getMemoryStats();                                        // get the current memory usage of each subsystem and object type
 
 	/* [Logging] */
 
@@ -1109,6 +1334,7 @@ namespace lvn
 	LVN_API void                        logEnableCoreLogging(bool enable);                                  // enable or disable logging from the core logger
 	LVN_API void                        logSetLevel(LvnLogger* logger, LvnLogLevel level);                  // sets the log level of logger, will only print messages with set log level and higher
 	LVN_API bool                        logCheckLevel(LvnLogger* logger, LvnLogLevel level);                // checks level with loger, returns true if level is the same or higher level than the level of the logger
+	LVN_API bool                        logShouldOutput(LvnLogger* logger, LvnLogLevel level);              // returns true if a message of level sent to logger would be output, checks that logging is enabled, core logging is enabled for the core logger and the level of the logger
 	LVN_API void                        logRenameLogger(LvnLogger* logger, const char* name);               // renames the name of the logger
 	LVN_API void                        logOutputMessage(LvnLogger* logger, LvnLogMessage* msg);            // prints the log message
 	LVN_API void                        logMessage(LvnLogger* logger, LvnLogLevel level, const char* msg);  // log message with given log level
@@ -1123,6 +1349,13 @@ namespace lvn
 	LVN_API const char*                 logGetANSIcodeColor(LvnLogLevel level);                             // get the ANSI color code of the log level in a string
 	LVN_API LvnResult                   logSetPatternFormat(LvnLogger* logger, const char* patternfmt);     // set the log pattern of the logger; messages outputed from that logger will be in this format
 	LVN_API LvnResult                   logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count);        // add user defined log patterns to the library
+	LVN_API void                        logFlush();                                                         // blocks until every message queued for the async log writer has been written and writes out the buffered file sinks of the core and client loggers
+	LVN_API uint64_t                    logGetDroppedMessageCount();                                        // get the number of messages discarded by the async log queue overflow policy
+	LVN_API LvnResult                   logAddSink(LvnLogger* logger, LvnLogSinkCreateInfo* sinkCreateInfo, uint32_t* pSinkIndex = nullptr);  // add an output sink to the logger, pSinkIndex is optional and returns the index of the sink within the logger
+	LVN_API void                        logClearSinks(LvnLogger* logger);                                   // remove and flush all sinks of the logger, the logger will not output messages until a sink is added
+	LVN_API void                        logFlushSinks(LvnLogger* logger);                                   // write out any buffered messages of the file sinks of the logger
+	LVN_API uint64_t                    logSinkReadRing(LvnLogger* logger, uint32_t sinkIndex, char* buffer, uint64_t size);  // copy the contents of a ring sink into buffer from oldest to newest, returns the number of bytes copied
+	LVN_API LvnResult                   logSinkDumpRing(LvnLogger* logger, uint32_t sinkIndex, const char* filepath);         // write the contents of a ring sink to a file, filepath may be nullptr to write to stderr
 
 	LVN_API LvnResult                   createLogger(LvnLogger** logger, LvnLoggerCreateInfo* loggerCreateInfo);
 	LVN_API void                        destroyLogger(LvnLogger* logger);
@@ -1213,6 +1446,26 @@ namespace lvn
 	LVN_API void                        renderCmdBeginFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer);                                        // begins the framebuffer for recording offscreen render calls, similar to beginning the render pass
 	LVN_API void                        renderCmdEndFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer);                                          // ends recording to the framebuffer
 
+	// gpu regions are timed with timestamp queries, results are read without waiting once the frame has finished on the gpu, which is a few frames after it was recorded
+	LVN_API LvnResult                   renderEnableGpuTiming(LvnWindow* window, bool timePasses, bool pipelineStatistics);                               // create the queries for timing gpu regions of the window, timePasses times every render pass and frame buffer pass, pipelineStatistics also counts vertices, primitives and shader invocations
+	LVN_API void                        renderDisableGpuTiming(LvnWindow* window);
+	LVN_API void                        renderCmdBeginGpuRegion(LvnWindow* window, const char* name);                                                     // start timing a region of commands, regions can be nested. name must stay valid while results are read (eg. a string literal)
+	LVN_API void                        renderCmdEndGpuRegion(LvnWindow* window);                                                                         // end the last region begun, a region must begin and end on the same side of a render pass
+	LVN_API uint32_t                    renderGetGpuTimings(LvnWindow* window, LvnGpuTiming* pTimings, uint32_t maxCount);                                // get the regions of the latest frame with results, returns the number of regions (pTimings can be nullptr to only get the count)
+
+	// render commands of a window are counted every frame, the counters are moved into the history and reset in renderBeginNextFrame
+	LVN_API LvnFrameStats               renderGetFrameStats(LvnWindow* window);                                                                           // get the stats of the last completed frame of the window
+	LVN_API uint32_t                    renderGetFrameStatsHistory(LvnWindow* window, LvnFrameStats* pStats, uint32_t maxCount);                          // get the stats of up to the last LVN_FRAME_STATS_HISTORY_SIZE frames ordered from oldest to newest, returns the number of frames (pStats can be nullptr to only get the count)
+
+	// the frame pacer limits the frame rate without vsync, it sleeps for most of the frame interval and spins for the last part against the monotonic clock
+	LVN_API LvnResult                   createFramePacer(LvnFramePacer** framePacer, LvnFramePacerCreateInfo* createInfo);
+	LVN_API void                        destroyFramePacer(LvnFramePacer* framePacer);
+	LVN_API void                        framePacerBeginFrame(LvnFramePacer* framePacer, LvnWindow* window);                                               // wait until the next frame is due, then calls renderBeginNextFrame
+	LVN_API void                        framePacerEndFrame(LvnFramePacer* framePacer, LvnWindow* window);                                                 // calls renderDrawSubmit and records how long the frame took to make
+	LVN_API void                        framePacerWait(LvnFramePacer* framePacer);                                                                        // wait until the next frame is due without rendering, for loops that do not draw to a window
+	LVN_API void                        framePacerSetTargetHz(LvnFramePacer* framePacer, double targetHz);                                                // change the target frame rate, 0 turns off limiting while still tracking frame times
+	LVN_API LvnFramePacerStats          framePacerGetStats(LvnFramePacer* framePacer);                                                                    // get frame time and jitter percentiles of the recent frames
+
 	LVN_API LvnResult                   createShaderFromSrc(LvnShader** shader, LvnShaderCreateInfo* createInfo);                                         // create shader with the source code as input
 	LVN_API LvnResult                   createShaderFromFileBin(LvnShader** shader, LvnShaderCreateInfo* createInfo);                                     // create shader with the file paths to the binary files (.spv) as input
 	LVN_API LvnResult                   createShaderFromFileSrc(LvnShader** shader, LvnShaderCreateInfo* createInfo);                                     // create shader with the file paths to the source files as input
@@ -1272,6 +1525,22 @@ namespace lvn
 	LVN_API LvnModel                    loadModel(const char* filepath);
 	LVN_API void                        freeModel(LvnModel* model);
 
+	/* [Async Loading] */
+	// file reads and decoding run on worker threads, graphics objects of models are created on the render thread in renderBeginNextFrame or assetLoadWait
+	LVN_API LvnResult                   loadModelAsync(LvnAssetLoad** assetLoad, const char* filepath);
+	LVN_API LvnResult                   loadImageDataAsync(LvnAssetLoad** assetLoad, const char* filepath, int forceChannels = 0, bool flipVertically = false);
+	LVN_API LvnResult                   loadFontFromFileTTFAsync(LvnAssetLoad** assetLoad, const char* filepath, uint32_t fontSize, LvnCharset charset);
+	LVN_API LvnResult                   createSoundFromFileAsync(LvnAssetLoad** assetLoad, LvnSoundCreateInfo* createInfo);
+	LVN_API void                        destroyAssetLoad(LvnAssetLoad* assetLoad);                                        // waits for the load to finish, assets that were not taken with the assetLoadGet functions are freed
+
+	LVN_API LvnAssetLoadState           assetLoadGetState(LvnAssetLoad* assetLoad);                                       // poll the state of the load without blocking
+	LVN_API LvnAssetLoadState           assetLoadWait(LvnAssetLoad* assetLoad);                                           // block until the load is finished, runs other loading jobs while waiting. model loads must be waited on from the render thread
+	LVN_API void                        assetLoadProcessPending();                                                        // create the graphics objects of decoded models, called by renderBeginNextFrame; must be called on the render thread
+	LVN_API LvnModel                    assetLoadGetModel(LvnAssetLoad* assetLoad);                                       // take the loaded model, the model must be freed with freeModel
+	LVN_API LvnImageData                assetLoadGetImageData(LvnAssetLoad* assetLoad);                                   // take the loaded image data
+	LVN_API LvnFont                     assetLoadGetFont(LvnAssetLoad* assetLoad);                                        // take the loaded font
+	LVN_API LvnSound*                   assetLoadGetSound(LvnAssetLoad* assetLoad);                                       // take the loaded sound, the sound must be destroyed with destroySound
+
 	LVN_API LvnCamera                   cameraConfigInit(LvnCameraCreateInfo* createInfo);                                // initialize the config of the camera struct given the create info parameters
 	LVN_API void                        cameraUpdateMatrix(LvnCamera* camera);                                            // updates the camera matrix given the camera position, orientation, aspect ratio, fov, near plane, and far plane are set, note that it will also update the projection and view matrix 
 	LVN_API void                        cameraSetFov(LvnCamera* camera, float fovDeg);                                    // set the fov of the camera in degrees
@@ -1286,6 +1555,15 @@ namespace lvn
 	LVN_API LvnVec3                     cameraGetOrient(LvnCamera* camera);                                               // get the orientation of the camera
 	LVN_API LvnVec3                     cameraGetUpVec(LvnCamera* camera);                                                // get the up vector of the camera
 
+	/* [Profiling] */
+	// zone names are stored as pointers and must stay valid until the session ends (eg. string literals or __func__)
+	LVN_API LvnResult                   profileBeginSession();                                                            // start recording zones on every thread, zones of the previous session are discarded. fails if the library was built without LVN_ENABLE_PROFILING
+	LVN_API LvnResult                   profileEndSession(const char* filepath);                                          // stop recording and write the zones to filepath as Chrome trace event JSON (open in ui.perfetto.dev or chrome://tracing), nullptr to discard them
+	LVN_API bool                        profileIsRecording();
+	LVN_API uint64_t                    profileGetTimeNs();                                                               // monotonic time in nanoseconds used for zone timestamps
+	LVN_API void                        profileRecordZone(const char* name, uint64_t startNs, uint64_t endNs);            // record a zone on the calling thread, usually called by LvnProfileScope
+	LVN_API void                        profileSetThreadName(const char* name);                                           // name of the calling thread in the trace, also set by threadSetName
+
 	/* [Audio] */
 	LVN_API LvnResult                   createSoundFromFile(LvnSound** sound, LvnSoundCreateInfo* createInfo);
 	LVN_API void                        destroySound(LvnSound* sound);
@@ -1325,71 +1603,132 @@ namespace lvn
 
 	/* [Math] */
 	template <typename T>
-	LVN_API T                           min(const T& n1, const T& n2) { return n1 < n2 ? n1 : n2; }
+	LVN_API constexpr T                 min(const T& n1, const T& n2) { return n1 < n2 ? n1 : n2; }
 
 	template <typename T>
-	LVN_API T                           max(const T& n1, const T& n2) { return n1 > n2 ? n1 : n2; }
+	LVN_API constexpr T                 max(const T& n1, const T& n2) { return n1 > n2 ? n1 : n2; }
 
 	template <typename T>
-	LVN_API T                           clamp(const T& val, const T& low, const T& high) { return lvn::max(lvn::min(val, high), low); }
+	LVN_API constexpr T                 clamp(const T& val, const T& low, const T& high) { return lvn::max(lvn::min(val, high), low); }
 
 	template <typename T>
-	LVN_API LvnPair<T>                  midpoint(const T& x1, const T& y1, const T& x2, const T& y2) { return { (x1 + x2) / static_cast<T>(2), (y1 + y2) / static_cast<T>(2) }; }
+	LVN_API constexpr LvnPair<T>        midpoint(const T& x1, const T& y1, const T& x2, const T& y2) { return { (x1 + x2) / static_cast<T>(2), (y1 + y2) / static_cast<T>(2) }; }
 
 	template <typename T>
 	LVN_API T                           distance(const T& x1, const T& y1, const T& x2, const T& y2) { return sqrt(pow((x1 - x2), static_cast<T>(2)) + pow((y1 - y2), static_cast<T>(2))); }
 
 	template<typename T>
-	LVN_API bool                        within(T num, T within, T range) { return num <= (within + range) && num >= (within - range); }
+	LVN_API constexpr bool              within(T num, T within, T range) { return num <= (within + range) && num >= (within - range); }
 	
 	template<typename T>
-	LVN_API bool                        within(T num, T within, T lowerRange, T upperRange) { return num <= (within + upperRange) && num >= (within - lowerRange); }
+	LVN_API constexpr bool              within(T num, T within, T lowerRange, T upperRange) { return num <= (within + upperRange) && num >= (within - lowerRange); }
+
+	// square root that can be used in constant expressions, newton's method is used when evaluated at compile time and sqrt at runtime
+	// the compile time result is correctly rounded like sqrt, numbers that are not positive give 0 and infinity gives infinity
+	template <typename T>
+	LVN_API constexpr T                 sqrtConstexpr(const T& num)
+	{
+		if (!LVN_IS_CONSTANT_EVALUATED())
+			return sqrt(num);
+
+		double n = static_cast<double>(num);
+		if (!(n > 0.0)) { return static_cast<T>(0); }
+		if (n > 1.7976931348623157e308) { return num; }
+
+		// scale by powers of four into [1, 4) so the root is in [1, 2), scaling by powers of two is exact
+		double scale = 1.0;
+		while (n >= 4.0) { n *= 0.25; scale *= 2.0; }
+		while (n < 1.0) { n *= 4.0; scale *= 0.5; }
+
+		// starting above the root, each estimate is smaller than the last until the closest value is reached
+		double x = n;
+		for (int i = 0; i < 64; i++)
+		{
+			const double next = 0.5 * (x + n / x);
+			if (!(next < x)) { break; }
+			x = next;
+		}
+
+		// newton's method can stop one step away from the closest value, the last bit is fixed with integers in units of 2^-52,
+		// the root r is rounded up while n is above the square of r + 1/2 and down while it is at or below the square of r - 1/2,
+		// n * 2^104 - r * r is small so it is computed exactly with wrapping 64 bit arithmetic
+		constexpr double unit = 4503599627370496.0; // 2^52
+		const uint64_t scaledN = static_cast<uint64_t>(n * unit) << 52;
+		uint64_t root = static_cast<uint64_t>(x * unit);
+		auto remainder = [&]() { return static_cast<int64_t>(scaledN - root * root); };
+		while (remainder() > static_cast<int64_t>(root)) { root++; }
+		while (remainder() <= -static_cast<int64_t>(root)) { root--; }
 
-	LVN_API float radians(float deg);          // convert degrees to radians
-	LVN_API float degrees(float rad);          // convert radians to degrees
+		return static_cast<T>(static_cast<double>(root) / unit * scale);
+	}
+
+	LVN_API const char* mathGetSimdInstructionSet(); // instruction set used by the float 4x4 matrix operations ("avx", "sse", "neon" or "scalar"), set by the build so it is the same for the library and application
+
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+	// float 4x4 matrix simd functions, used by the generic templates when not evaluated at compile time, defined after the matrix types
+	inline LvnMat4x4_t<float> simdMat4Multiply(const LvnMat4x4_t<float>& a, const LvnMat4x4_t<float>& b);
+	inline LvnVec4_t<float> simdMat4MultiplyVec(const LvnMat4x4_t<float>& m, const LvnVec4_t<float>& v);
+	inline LvnMat4x4_t<float> simdMat4Inverse(const LvnMat4x4_t<float>& m);
+	inline LvnMat4x4_t<float> simdMat4Transpose(const LvnMat4x4_t<float>& m);
+	inline LvnMat4x4_t<float> simdMat4InverseAffine(const LvnMat4x4_t<float>& m);
+#endif
+
+	LVN_API constexpr float radians(float deg) { return deg * 0.0174532925199f; } // convert degrees to radians, deg * (PI / 180)
+	LVN_API constexpr float degrees(float rad) { return rad * 57.2957795131f; }   // convert radians to degrees, rad * (180 / PI)
 	LVN_API float clampAngle(float rad);       // clamps the given angle in radians to the translated angle between 0 and 2 PI
 	LVN_API float clampAngleDeg(float deg);    // clamps the given angle in degrees to the translated angle between 0 and 2 PI
 	LVN_API float invSqrt(float num);
 
+	// batch functions for large arrays of vectors, the input and output arrays may be the same array
+	LVN_API const char* mathGetBatchInstructionSet(); // instruction set used by the batch functions ("avx2", "sse" or "scalar"), avx2 is selected at runtime if the cpu supports it
+	LVN_API void transformPoints(const LvnMat4& matrix, const LvnVec3* pIn, LvnVec3* pOut, size_t count);      // transforms each point with w = 1, no perspective divide
+	LVN_API void transformDirections(const LvnMat4& matrix, const LvnVec3* pIn, LvnVec3* pOut, size_t count);  // transforms each direction with w = 0, the translation is ignored
+	LVN_API void transformPointsSoA(const LvnMat4& matrix, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+	LVN_API void transformDirectionsSoA(const LvnMat4& matrix, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+	LVN_API void normalizeVectors(const LvnVec3* pIn, LvnVec3* pOut, size_t count);
+	LVN_API void dotVectors(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count);                   // pOut[i] = dot(pA[i], pB[i])
+	LVN_API void vectorsAoSToSoA(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count);  // split an array of vectors into separate x, y, z arrays
+	LVN_API void vectorsSoAToAoS(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count);
+
 	template <typename T>
-	LVN_API LvnVec2_t<T> normalize(const LvnVec2_t<T>& v)
+	LVN_API constexpr LvnVec2_t<T> normalize(const LvnVec2_t<T>& v)
 	{
-		T u = static_cast<T>(1) / sqrt(v.x * v.x + v.y * v.y);
+		T u = static_cast<T>(1) / lvn::sqrtConstexpr(v.x * v.x + v.y * v.y);
 		return LvnVec2_t<T>(v.x * u, v.y * u);
 	}
 
 	template <typename T>
-	LVN_API LvnVec3_t<T> normalize(const LvnVec3_t<T>& v)
+	LVN_API constexpr LvnVec3_t<T> normalize(const LvnVec3_t<T>& v)
 	{
-		T u = static_cast<T>(1) / sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+		T u = static_cast<T>(1) / lvn::sqrtConstexpr(v.x * v.x + v.y * v.y + v.z * v.z);
 		return LvnVec3_t<T>(v.x * u, v.y * u, v.z * u);
 	}
 
 	template <typename T>
-	LVN_API LvnVec4_t<T> normalize(const LvnVec4_t<T>& v)
+	LVN_API constexpr LvnVec4_t<T> normalize(const LvnVec4_t<T>& v)
 	{
-		T u = static_cast<T>(1) / sqrt(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+		T u = static_cast<T>(1) / lvn::sqrtConstexpr(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
 		return LvnVec4_t<T>(v.x * u, v.y * u, v.z * u, v.w * u);
 	}
 
 	template <typename T>
-	LVN_API LvnQuat_t<T> normalize(const LvnQuat_t<T>& quat)
+	LVN_API constexpr LvnQuat_t<T> normalize(const LvnQuat_t<T>& quat)
 	{
 		const T qw = quat.w;
 		const T qx = quat.x;
 		const T qy = quat.y;
 		const T qz = quat.z;
 
-		const float n = static_cast<T>(1) / sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+		const T n = static_cast<T>(1) / lvn::sqrtConstexpr(qx * qx + qy * qy + qz * qz + qw * qw);
 
 		return LvnQuat_t<T>(qw * n, qx * n, qy * n, qz * n);
 	}
 
-	LVN_API LvnVec3f cross(LvnVec3f v1, LvnVec3f v2);
-	LVN_API LvnVec3d cross(LvnVec3d v1, LvnVec3d v2);
+	LVN_API constexpr LvnVec3f cross(LvnVec3f v1, LvnVec3f v2); // defined after the vector types
+	LVN_API constexpr LvnVec3d cross(LvnVec3d v1, LvnVec3d v2);
 
 	template <typename T>
-	LVN_API LvnVec3_t<T> cross(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+	LVN_API constexpr LvnVec3_t<T> cross(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 	{
 		const T cx = v1.y * v2.z - v1.z * v2.y;
 		const T cy = v1.z * v2.x - v1.x * v2.z;
@@ -1398,19 +1737,19 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API T dot(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+	LVN_API constexpr T dot(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 	{
 		return v1.x * v2.x + v1.y * v2.y;
 	}
 
 	template <typename T>
-	LVN_API T dot(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+	LVN_API constexpr T dot(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 	{
 		return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
 	}
 
 	template <typename T>
-	LVN_API T dot(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+	LVN_API constexpr T dot(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 	{
 		return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
 	}
@@ -1422,7 +1761,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat2x2_t<T> inverse(const LvnMat2x2_t<T>& m)
+	LVN_API constexpr LvnMat2x2_t<T> inverse(const LvnMat2x2_t<T>& m)
 	{
 		T oneOverDeterminant = static_cast<T>(1) / (
 			+ m[0][0] * m[1][1]
@@ -1438,7 +1777,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat3x3_t<T> inverse(const LvnMat3x3_t<T>& m)
+	LVN_API constexpr LvnMat3x3_t<T> inverse(const LvnMat3x3_t<T>& m)
 	{
 		T oneOverDeterminant = static_cast<T>(1) / (
 			+ m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
@@ -1460,8 +1799,15 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> inverse(const LvnMat4x4_t<T>& m)
+	LVN_API constexpr LvnMat4x4_t<T> inverse(const LvnMat4x4_t<T>& m)
 	{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+		if constexpr (std::is_same<T, float>::value)
+		{
+			if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4Inverse(m); }
+		}
+#endif
+
 		T coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 		T coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
 		T coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
@@ -1518,7 +1864,58 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> orthoRHZO(T left, T right, T bottom, T top, T zNear, T zFar)
+	LVN_API constexpr LvnMat4x4_t<T> transpose(const LvnMat4x4_t<T>& m)
+	{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+		if constexpr (std::is_same<T, float>::value)
+		{
+			if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4Transpose(m); }
+		}
+#endif
+
+		return LvnMat4x4_t<T>(
+			m[0][0], m[1][0], m[2][0], m[3][0],
+			m[0][1], m[1][1], m[2][1], m[3][1],
+			m[0][2], m[1][2], m[2][2], m[3][2],
+			m[0][3], m[1][3], m[2][3], m[3][3]);
+	}
+
+	// inverse of a matrix with a last row of (0, 0, 0, 1) such as model and view matrices, cheaper than the full inverse
+	template <typename T>
+	LVN_API constexpr LvnMat4x4_t<T> inverseAffine(const LvnMat4x4_t<T>& m)
+	{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+		if constexpr (std::is_same<T, float>::value)
+		{
+			if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4InverseAffine(m); }
+		}
+#endif
+
+		// rows of the inverse of the upper 3x3 are the cross products of its columns divided by the determinant
+		const LvnVec3_t<T> c0(m[0].x, m[0].y, m[0].z);
+		const LvnVec3_t<T> c1(m[1].x, m[1].y, m[1].z);
+		const LvnVec3_t<T> c2(m[2].x, m[2].y, m[2].z);
+		const LvnVec3_t<T> t(m[3].x, m[3].y, m[3].z);
+
+		const LvnVec3_t<T> r0 = lvn::cross(c1, c2);
+		const LvnVec3_t<T> r1 = lvn::cross(c2, c0);
+		const LvnVec3_t<T> r2 = lvn::cross(c0, c1);
+
+		T oneOverDeterminant = static_cast<T>(1) / lvn::dot(c0, r0);
+
+		LvnMat4x4_t<T> inverse(
+			r0.x, r1.x, r2.x, 0,
+			r0.y, r1.y, r2.y, 0,
+			r0.z, r1.z, r2.z, 0,
+			-lvn::dot(r0, t), -lvn::dot(r1, t), -lvn::dot(r2, t), 0);
+
+		inverse = inverse * oneOverDeterminant;
+		inverse[3].w = static_cast<T>(1);
+		return inverse;
+	}
+
+	template <typename T>
+	LVN_API constexpr LvnMat4x4_t<T> orthoRHZO(T left, T right, T bottom, T top, T zNear, T zFar)
 	{
 		LvnMat4x4_t<T> matrix(static_cast<T>(1));
 		matrix[0][0] = static_cast<T>(2) / (right - left);
@@ -1531,7 +1928,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> orthoRHNO(T left, T right, T bottom, T top, T zNear, T zFar)
+	LVN_API constexpr LvnMat4x4_t<T> orthoRHNO(T left, T right, T bottom, T top, T zNear, T zFar)
 	{
 		LvnMat4x4_t<T> matrix(static_cast<T>(1));
 		matrix[0][0] = static_cast<T>(2) / (right - left);
@@ -1544,7 +1941,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> orthoLHZO(T left, T right, T bottom, T top, T zNear, T zFar)
+	LVN_API constexpr LvnMat4x4_t<T> orthoLHZO(T left, T right, T bottom, T top, T zNear, T zFar)
 	{
 		LvnMat4x4_t<T> matrix(static_cast<T>(1));
 		matrix[0][0] = static_cast<T>(2) / (right - left);
@@ -1557,7 +1954,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> orthoLHNO(T left, T right, T bottom, T top, T zNear, T zFar)
+	LVN_API constexpr LvnMat4x4_t<T> orthoLHNO(T left, T right, T bottom, T top, T zNear, T zFar)
 	{
 		LvnMat4x4_t<T> matrix(static_cast<T>(1));
 		matrix[0][0] = static_cast<T>(2) / (right - left);
@@ -1666,7 +2063,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> lookAtRH(const LvnVec3_t<T>& eye, const LvnVec3_t<T>& center, const LvnVec3_t<T>& up)
+	LVN_API constexpr LvnMat4x4_t<T> lookAtRH(const LvnVec3_t<T>& eye, const LvnVec3_t<T>& center, const LvnVec3_t<T>& up)
 	{
 		LvnVec3_t<T> f(lvn::normalize(center - eye));
 		LvnVec3_t<T> s(lvn::normalize(lvn::cross(f, up)));
@@ -1689,7 +2086,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> lookAtLH(const LvnVec3_t<T>& eye, const LvnVec3_t<T>& center, const LvnVec3_t<T>& up)
+	LVN_API constexpr LvnMat4x4_t<T> lookAtLH(const LvnVec3_t<T>& eye, const LvnVec3_t<T>& center, const LvnVec3_t<T>& up)
 	{
 		LvnVec3_t<T> f(lvn::normalize(center - eye));
 		LvnVec3_t<T> s(lvn::normalize(lvn::cross(up, f)));
@@ -1726,7 +2123,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> translate(const LvnMat4x4_t<T>& mat, const LvnVec3_t<T>& vec)
+	LVN_API constexpr LvnMat4x4_t<T> translate(const LvnMat4x4_t<T>& mat, const LvnVec3_t<T>& vec)
 	{
 		LvnMat4x4_t<T> translate(static_cast<T>(1));
 		translate[3][0] = vec.x;
@@ -1737,7 +2134,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> scale(const LvnMat4x4_t<T>& mat, const LvnVec3_t<T>& vec)
+	LVN_API constexpr LvnMat4x4_t<T> scale(const LvnMat4x4_t<T>& mat, const LvnVec3_t<T>& vec)
 	{
 		LvnMat4x4_t<T> scale(static_cast<T>(1));
 		scale[0][0] = vec.x;
@@ -1796,7 +2193,7 @@ namespace lvn
 	}
 
 	template <typename T>
-	LVN_API LvnMat4x4_t<T> quatToMat4(const LvnQuat_t<T> quat)
+	LVN_API constexpr LvnMat4x4_t<T> quatToMat4(const LvnQuat_t<T> quat)
 	{
 		const T w = quat.w;
 		const T x = quat.x;
@@ -1821,12 +2218,73 @@ namespace lvn
 
 /* [Core Struct Implementaion] */
 
+struct LvnAllocationCallbacks
+{
+	void* userData;                                                                 // user data passed to every callback
+	void* (*allocFn)(size_t size, size_t alignment, void* userData);                // allocate size bytes aligned to alignment, returns nullptr on failure
+	void* (*reallocFn)(void* ptr, size_t size, size_t alignment, void* userData);   // reallocate ptr to size bytes aligned to alignment, ptr may be nullptr
+	void  (*freeFn)(void* ptr, void* userData);                                     // free memory returned by allocFn or reallocFn, ptr may be nullptr
+};
+
 struct LvnMemoryBindingInfo
 {
 	LvnStructureType sType;
 	uint64_t count;
 };
 
+struct LvnMemoryTagStats
+{
+	uint64_t liveBytes;            // bytes currently allocated under this tag, includes objects of the sTypes belonging to the tag
+	uint64_t liveCount;            // number of allocations and objects currently alive under this tag
+	uint64_t peakBytes;            // highest liveBytes reached since the context was created
+};
+
+struct LvnStructureTypeMemoryStats
+{
+	uint64_t liveBytes;            // bytes used by objects of this sType that are currently alive
+	uint64_t liveCount;            // number of objects of this sType that are currently alive
+	uint64_t peakCount;            // highest liveCount reached since the context was created
+	uint64_t blockCount;           // number of memory pool blocks holding objects of this sType, 0 if not using the memory pool
+	uint64_t capacity;             // number of objects of this sType the memory pool has memory for
+	uint64_t freeSlots;            // number of slots that were used and freed and are waiting to be reused
+	float fragmentation;           // ratio of freed slots to all slots handed out by the memory pool (0.0 - 1.0)
+};
+
+struct LvnMemoryStats
+{
+	LvnMemoryTagStats tags[Lvn_MemoryTag_Max];                // memory usage of each subsystem, indexed with LvnMemoryTag
+	LvnStructureTypeMemoryStats sTypes[Lvn_Stype_Max];        // memory usage of each object type, indexed with LvnStructureType
+	uint64_t totalLiveBytes;                                  // sum of liveBytes across all tags
+	uint64_t totalPeakBytes;                                  // highest totalLiveBytes reached since the context was created
+};
+
+struct LvnMemoryGrowthInfo
+{
+	LvnStructureType sType;
+	float growthFactor;            // multiplier applied to the number of objects of the next memory block each time this sType grows (eg. 2.0 doubles each block), values <= 1.0 keep a constant block size
+	uint64_t maxCount;             // max number of objects of this sType the memory pool can hold, 0 for no limit
+};
+
+struct LvnThreadPoolCreateInfo
+{
+	uint32_t workerCount;                  // number of worker threads, 0 for one worker per core that is not reserved besides the calling thread
+	LvnThreadAffinityMode affinityMode;
+	const uint32_t* pCores;                // cores assigned to the workers in order (worker i gets pCores[i % coreCount]) when pinning, nullptr to assign the cores that are not reserved
+	uint32_t coreCount;
+	const uint32_t* pReservedCores;        // cores that no worker runs on
+	uint32_t reservedCoreCount;
+	LvnThreadPriority priority;
+	const char* name;                      // workers are named "<name> <index>", nullptr to leave them unnamed
+};
+
+struct LvnThreadWorkerStats
+{
+	uint64_t busyTimeNs;                   // time spent running jobs
+	uint64_t idleTimeNs;                   // time spent looking for jobs or sleeping
+	uint64_t jobCount;                     // number of jobs run
+	int32_t core;                          // core the worker was assigned to, -1 if the worker is not pinned
+};
+
 struct LvnContextCreateInfo
 {
 	std::string                   applicationName;               // name of application or program
@@ -1838,28 +2296,72 @@ struct LvnContextCreateInfo
 		bool                      enableLogging;                 // enable or diable logging
 		bool                      disableCoreLogging;            // whether to disable core logging in the library
 		bool                      enableVulkanValidationLayers;  // enable vulkan validation layer messages when using vulkan
+		bool                      enableAsyncLogging;            // queue log messages and format and output them on a background writer thread instead of the calling thread
+		uint32_t                  asyncQueueSize;                // max number of messages waiting in the async log queue, rounded up to a power of two, 0 to use the default size (4096)
+		LvnLogOverflowPolicy      asyncOverflowPolicy;           // what to do when the async log queue is full
 	}                             logging;
 
 	LvnTextureFormat              frameBufferColorFormat;        // set the color image format of the window framebuffer when rendering
 	LvnClipRegion                 matrixClipRegion;              // set the clip region to the correct coordinate system depending on the api
 	uint32_t                      maxFramesInFlight;             // the max number of frames to be computed after submiting to the graphics queue (vulkan)
+	LvnAllocationCallbacks*       allocationCallbacks;           // optional allocation callbacks used for all memory allocated by the library and its subsystems (vulkan, vma, miniaudio, enet, stb_image, freetype), nullptr to use malloc and free
 	
 	struct
 	{
 		LvnMemAllocMode           memAllocMode;                  // memory allocation mode, how memory should be allocated when creating new object
 		LvnMemoryBindingInfo*     memoryBindings;                // array of object alloc info structs to tell how many objects of each type to allocate if using memory pool
 		uint32_t                  memoryBindingCount;            // number of object alloc inso structs;
-		LvnMemoryBindingInfo*     blockMemoryBindings;           // array of objects alloc info structs of each type to allocate for further memory blocks in case if the first block is full
+		LvnMemoryBindingInfo*     blockMemoryBindings;           // array of objects alloc info structs of each type to allocate for the first further memory block of that type in case if the first block is full
 		uint32_t                  blockMemoryBindingCount;       // number of block object alloc info structs
+		LvnMemoryGrowthInfo*      memoryGrowthInfos;             // array of growth info structs of each type to control how further memory blocks of that type grow, each type grows independently
+		uint32_t                  memoryGrowthInfoCount;         // number of memory growth info structs
+		bool                      reserveVirtualMemory;          // reserve memory blocks as virtual memory and only commit pages when objects are first created in them, lets memory pools be sized for peak usage without using physical memory up front
+		LvnStructureType*         hugePageSTypes;                // array of sTypes whose grown memory blocks should be backed by transparent huge pages (eg. Lvn_Stype_Buffer, Lvn_Stype_Texture), only used with reserveVirtualMemory
+		uint32_t                  hugePageSTypeCount;            // number of sTypes in hugePageSTypes
+		bool                      trackAllocationSites;          // record where each object and memAlloc allocation was created so that allocations still alive are reported when the context is terminated
+		bool                      trackLibraryAllocations;       // count the allocations made by miniaudio, enet and freetype under the audio, network and assets memory tags, each of their allocations gets a small header, when false and no allocation callbacks are set they use malloc and free directly
+		uint64_t                  frameMemorySize;               // initial size in bytes of the memory used by lvn::frameAlloc for each frame in flight, grows to the most used in a frame when exceeded, 0 to use the default size (1 MiB)
 	}                             memoryInfo;
+
+	struct
+	{
+		LvnThreadPoolCreateInfo   jobWorkers;                    // workers of the pool returned by lvn::getJobThreadPool
+		LvnThreadPoolCreateInfo   assetWorkers;                  // workers that read and decode files for async asset loading
+		const uint32_t*           pReservedCores;                // cores that no worker of either pool runs on, keep these free for the render, audio and network threads
+		uint32_t                  reservedCoreCount;             // number of cores in pReservedCores
+		bool                      pinRenderThread;               // pin the thread creating the context (the render thread) to renderThreadCore
+		uint32_t                  renderThreadCore;              // core to pin the render thread to, should be one of the reserved cores
+		LvnThreadPriority         renderThreadPriority;          // scheduling priority of the thread creating the context
+	}                             threading;
 };
 
 /* [Logging] */
+struct LvnLogSinkCreateInfo
+{
+	LvnLogSinkType type;
+	LvnLogLevel logLevel;                // min level of messages written by this sink, the level of the logger is checked first
+	const char* logPatternFormat;        // pattern of messages written by this sink, nullptr to use the pattern of the logger
+
+	// file and binary sink
+	const char* filepath;                // path of the log file, rotated files are named filepath.1, filepath.2, ... with filepath.1 being the newest
+	uint64_t bufferSize;                 // size in bytes of the write buffer, messages are written to the file when the buffer is full or on error/fatal messages, 0 to use the default size (64 KiB)
+	uint64_t maxFileSize;                // rotate the file when it would grow past this size in bytes, 0 for no size rotation
+	uint64_t rotateInterval;             // rotate the file after this many seconds, 0 for no time rotation
+	uint32_t maxFiles;                   // number of rotated files to keep besides the current file
+	LvnLogFsyncPolicy fsyncPolicy;
+	bool appendFile;                     // append to the file if it exists instead of truncating it
+
+	// ring sink
+	uint64_t ringSize;                   // size in bytes of the memory ring, 0 to use the default size (64 KiB)
+};
+
 struct LvnLoggerCreateInfo
 {
 	std::string loggerName;
 	std::string logPatternFormat;
 	LvnLogLevel logLevel;
+	LvnLogSinkCreateInfo* pSinks;        // sinks the logger outputs to, if no sinks are given the logger outputs to stdout
+	uint32_t sinkCount;
 };
 
 struct LvnLogMessage
@@ -2066,6 +2568,8 @@ struct LvnDoublePair
 };
 
 
+struct LvnDataAdoptTag {}; // tag used to construct LvnData by taking ownership of memory allocated with lvn::memAlloc instead of copying it
+
 template<typename T>
 class LvnData
 {
@@ -2079,206 +2583,812 @@ public:
 
 	~LvnData()
 	{
-		free(m_Data);
+		lvn::memFree(m_Data);
 	}
 
 	LvnData(const T* data, size_t size)
 	{
-		void* buff = malloc(size * sizeof(T));
-		if (!buff) { LVN_CORE_ASSERT(false, "malloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
-		memcpy(buff, data, size * sizeof(T));
+		void* buff = lvn::memAlloc(size * sizeof(T)); // nullptr if size is 0
+		if (!buff && size) { LVN_CORE_ASSERT(false, "memAlloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
+		if (size) { memcpy(buff, data, size * sizeof(T)); }
+		m_Data = (T*)buff;
+		m_Size = size;
+		m_MemSize = size * sizeof(T);
+	}
+	explicit LvnData(size_t size)
+	{
+		void* buff = lvn::memAlloc(size * sizeof(T));
+		if (!buff && size) { LVN_CORE_ASSERT(false, "memAlloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
 		m_Data = (T*)buff;
 		m_Size = size;
 		m_MemSize = size * sizeof(T);
 	}
+	LvnData(T* data, size_t size, LvnDataAdoptTag)
+		: m_Data(data), m_Size(size), m_MemSize(size * sizeof(T)) {} // takes ownership of data, data must have been allocated with lvn::memAlloc and will be freed with lvn::memFree
 	LvnData(const LvnData<T>& data)
 	{
-		void* buff = malloc(data.m_MemSize);
-		if (!buff) { LVN_CORE_ASSERT(false, "malloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
-		memcpy(buff, data.m_Data, data.m_MemSize);
+		void* buff = lvn::memAlloc(data.m_MemSize);
+		if (!buff && data.m_MemSize) { LVN_CORE_ASSERT(false, "memAlloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
+		if (data.m_MemSize) { memcpy(buff, data.m_Data, data.m_MemSize); }
 		this->m_Data = (T*)buff;
 		this->m_Size = data.m_Size;
 		this->m_MemSize = data.m_MemSize;
 	}
+	LvnData(LvnData<T>&& data) noexcept
+		: m_Data(data.m_Data), m_Size(data.m_Size), m_MemSize(data.m_MemSize)
+	{
+		data.m_Data = nullptr;
+		data.m_Size = 0;
+		data.m_MemSize = 0;
+	}
 	LvnData<T>& operator=(const LvnData<T>& data)
 	{
-		free(m_Data);
-		void* buff = malloc(data.m_MemSize);
-		if (!buff) { LVN_CORE_ASSERT(false, "malloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
-		memcpy(buff, data.m_Data, data.m_MemSize);
+		if (this == &data) { return *this; }
+
+		lvn::memFree(m_Data);
+		void* buff = lvn::memAlloc(data.m_MemSize);
+		if (!buff && data.m_MemSize) { LVN_CORE_ASSERT(false, "memAlloc failure, failed to allocate memory"); LVN_ASSERT_BREAK; }
+		if (data.m_MemSize) { memcpy(buff, data.m_Data, data.m_MemSize); }
 		this->m_Data = (T*)buff;
 		this->m_Size = data.m_Size;
 		this->m_MemSize = data.m_MemSize;
 
 		return *this;
 	}
+	LvnData<T>& operator=(LvnData<T>&& data) noexcept
+	{
+		if (this == &data) { return *this; }
+
+		lvn::memFree(m_Data);
+		this->m_Data = data.m_Data;
+		this->m_Size = data.m_Size;
+		this->m_MemSize = data.m_MemSize;
+
+		data.m_Data = nullptr;
+		data.m_Size = 0;
+		data.m_MemSize = 0;
+
+		return *this;
+	}
 
 	T& operator[](size_t i)
 	{
 		LVN_CORE_ASSERT(i < m_Size, "element index out of range");
 		return m_Data[i];
 	}
+	const T& operator[](size_t i) const
+	{
+		LVN_CORE_ASSERT(i < m_Size, "element index out of range");
+		return m_Data[i];
+	}
 
+	T* data() { return m_Data; }
 	const T* const data() const { return m_Data; }
 	const size_t size() const { return m_Size; }
 	const size_t memsize() const { return m_MemSize; }
+	bool empty() const { return m_Size == 0; }
 
-	const T* const begin() const { return &m_Data[0]; }
-	const T* const end() const { return &m_Data[m_Size - 1]; }
+	T* begin() { return m_Data; }
+	T* end() { return m_Data + m_Size; }
+	const T* begin() const { return m_Data; }
+	const T* end() const { return m_Data + m_Size; }
 };
 
-class LvnTimer
+// non-owning view over a contiguous array of elements, the viewed memory must outlive the span
+template<typename T>
+class LvnSpan
 {
+private:
+	T* m_Data;
+	size_t m_Size;
+
 public:
-	LvnTimer() : m_Start(std::chrono::high_resolution_clock::now()), m_Now(std::chrono::high_resolution_clock::now()), m_Pause(false) {}
+	LvnSpan()
+		: m_Data(nullptr), m_Size(0) {}
 
-	void     begin() { m_Start = std::chrono::high_resolution_clock::now(); }
-	void     reset() { m_Start = std::chrono::high_resolution_clock::now(); m_Pause = false; }
-	void     pause(bool pause) { m_Pause = pause; }
+	LvnSpan(T* data, size_t size)
+		: m_Data(data), m_Size(size) {}
 
-	float    elapsed() { if (!m_Pause) { m_Now = std::chrono::high_resolution_clock::now(); } return std::chrono::duration_cast<std::chrono::nanoseconds>(m_Now - m_Start).count() * 0.001f * 0.001f * 0.001f; }
-	float    elapsedms() { return elapsed() * 1000.0f; }
+	template<typename U>
+	LvnSpan(LvnData<U>& data)
+		: m_Data(data.data()), m_Size(data.size()) {}
 
-private:
-	std::chrono::time_point<std::chrono::high_resolution_clock> m_Start, m_Now;
-	bool m_Pause;
-};
+	template<typename U>
+	LvnSpan(const LvnData<U>& data)
+		: m_Data(data.data()), m_Size(data.size()) {}
 
-class LvnThreadPool
-{
-private:
-	using LvnTaskFnPtr = void (*)();
+	template<typename U>
+	LvnSpan(std::vector<U>& data)
+		: m_Data(data.data()), m_Size(data.size()) {}
 
-	std::vector<std::thread> m_Workers;
-	std::queue<LvnTaskFnPtr> m_Tasks;
-	std::mutex m_QueueMutex;
-	std::condition_variable m_QueueCondition;
-	bool m_Terminate;
+	template<typename U>
+	LvnSpan(const std::vector<U>& data)
+		: m_Data(data.data()), m_Size(data.size()) {}
 
-	void ThreadFunc()
+	T& operator[](size_t i) const
 	{
-		while (true)
-		{
-			LvnTaskFnPtr fnPtr;
-
-			std::unique_lock<std::mutex> lock(m_QueueMutex);
-			m_QueueCondition.wait(lock, [this]() { return !m_Tasks.empty() || m_Terminate; });
+		LVN_CORE_ASSERT(i < m_Size, "element index out of range");
+		return m_Data[i];
+	}
 
-			if (m_Terminate) { return; }
+	T* data() const { return m_Data; }
+	size_t size() const { return m_Size; }
+	size_t memsize() const { return m_Size * sizeof(T); }
+	bool empty() const { return m_Size == 0; }
 
-			if (!m_Tasks.empty())
-			{
-				fnPtr = m_Tasks.front();
-				m_Tasks.pop();
+	T* begin() const { return m_Data; }
+	T* end() const { return m_Data + m_Size; }
 
-				lock.unlock();
-				fnPtr();
-			}
-		}
+	LvnSpan<T> subspan(size_t offset, size_t count) const
+	{
+		LVN_CORE_ASSERT(offset + count <= m_Size, "subspan range out of range");
+		return LvnSpan<T>(m_Data + offset, count);
 	}
+};
 
+// STL allocator that allocates from the per frame memory with lvn::frameAlloc, deallocate does nothing as memory is reclaimed when the frame is reset
+// containers using this allocator must not outlive the frame they were created in (eg. create a LvnFrameVector inside the render loop instead of keeping it as a member)
+template<typename T>
+class LvnFrameAllocator
+{
 public:
-	LvnThreadPool()
-		: m_Workers(1), m_Tasks(), m_QueueMutex(), m_QueueCondition(), m_Terminate(false)
-	{
-		for (uint32_t i = 0; i < m_Workers.size(); i++)
-			m_Workers[i] = (std::thread(&LvnThreadPool::ThreadFunc, this));
-	}
+	using value_type = T;
 
-	LvnThreadPool(uint32_t workerCount)
-		: m_Tasks(), m_QueueMutex(), m_QueueCondition(), m_Terminate(false)
-	{
-		m_Workers.resize(workerCount > 0 ? workerCount : 1);
+	LvnFrameAllocator() noexcept {}
 
-		for (uint32_t i = 0; i < m_Workers.size(); i++)
-			m_Workers[i] = (std::thread(&LvnThreadPool::ThreadFunc, this));
-	}
+	template<typename U>
+	LvnFrameAllocator(const LvnFrameAllocator<U>&) noexcept {}
 
-	~LvnThreadPool()
-	{
-		m_QueueMutex.lock();
-		m_Terminate = true;
-		m_QueueMutex.unlock();
+	T* allocate(size_t n) { return static_cast<T*>(lvn::frameAlloc(n * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) noexcept {}
 
-		m_QueueCondition.notify_all();
-		for (uint32_t i = 0; i < m_Workers.size(); i++)
-			m_Workers[i].join();
+	template<typename U>
+	bool operator==(const LvnFrameAllocator<U>&) const noexcept { return true; }
 
-		m_Workers.clear();
-	}
+	template<typename U>
+	bool operator!=(const LvnFrameAllocator<U>&) const noexcept { return false; }
+};
 
-	void add_task(LvnTaskFnPtr fnPtr)
-	{
-		std::lock_guard<std::mutex> lock(m_QueueMutex);
-		m_Tasks.push(fnPtr);
-		m_QueueCondition.notify_one();
-	}
+template<typename T>
+using LvnFrameVector = std::vector<T, LvnFrameAllocator<T>>;
 
-	bool busy()
-	{
-		std::lock_guard<std::mutex> lock(m_QueueMutex);
-		return !m_Tasks.empty();
-	}
+// time is kept in integer nanoseconds from lvn::clockNowNs, elapsed() and elapsedms() are only converted to float when returned
+class LvnTimer
+{
+public:
+	LvnTimer() : m_Start(lvn::clockNowNs()), m_Now(m_Start), m_Pause(false) {}
 
-	void wait()
-	{
-		while (LvnThreadPool::busy()) {}
-	}
-};
+	void     begin() { m_Start = lvn::clockNowNs(); }
+	void     reset() { m_Start = lvn::clockNowNs(); m_Pause = false; }
+	void     pause(bool pause) { m_Pause = pause; }
 
+	uint64_t elapsed_ns() { if (!m_Pause) { m_Now = lvn::clockNowNs(); } return m_Now - m_Start; }
+	double   elapsed_seconds() { return lvn::clockNsToSeconds(elapsed_ns()); }
+	float    elapsed() { return static_cast<float>(elapsed_seconds()); }
+	float    elapsedms() { return static_cast<float>(lvn::clockNsToMs(elapsed_ns())); }
 
-// ---------------------------------------------
-// [SECTION]: Vectors & Matrices
-// ---------------------------------------------
+private:
+	uint64_t m_Start, m_Now;
+	bool m_Pause;
+};
 
-template<typename T>
-struct LvnVec2_t
+// records the time from construction to destruction as a zone, use through LVN_PROFILE_SCOPE and LVN_PROFILE_FUNCTION
+class LvnProfileScope
 {
-	union { T x, r, s; };
-	union { T y, g, t; };
+private:
+	const char* m_Name;
+	uint64_t m_Start;
 
-	LvnVec2_t() {}
-	LvnVec2_t(const T& n)
-		: x(n), y(n) {}
-	LvnVec2_t(const T& nx, const T& ny)
-		: x(nx), y(ny) {}
-	LvnVec2_t(const LvnVec3_t<T>& v)
+public:
+	LvnProfileScope(const char* name)
+		: m_Name(nullptr), m_Start(0)
 	{
-		this->x = v.x;
-		this->y = v.y;
+		if (!lvn::profileIsRecording()) { return; }
+		m_Name = name;
+		m_Start = lvn::profileGetTimeNs();
 	}
-	LvnVec2_t(const LvnVec4_t<T>& v)
+
+	~LvnProfileScope()
 	{
-		this->x = v.x;
-		this->y = v.y;
+		if (m_Name) { lvn::profileRecordZone(m_Name, m_Start, lvn::profileGetTimeNs()); }
 	}
 
+	LvnProfileScope(const LvnProfileScope&) = delete;
+	LvnProfileScope& operator=(const LvnProfileScope&) = delete;
+};
+
+// counts the unfinished jobs that were submitted with it, pass it to LvnThreadPool::wait to wait for just those jobs
+class LvnJobCounter
+{
+private:
+	std::atomic<uint32_t> m_Count;
+
+	friend class LvnThreadPool;
+
+public:
+	LvnJobCounter() : m_Count(0) {}
+	LvnJobCounter(const LvnJobCounter&) = delete;
+	LvnJobCounter& operator=(const LvnJobCounter&) = delete;
+
+	uint32_t count() const { return m_Count.load(std::memory_order_acquire); }
+	bool done() const { return count() == 0; }
+};
+
+/*
+  Work stealing job system
+
+  Each worker owns a deque (Chase-Lev) of jobs. The owner pushes and pops jobs at the bottom
+  without locking while idle workers steal from the top of the other deques, so jobs spawned by
+  a job stay on the same worker until someone else runs out of work. Jobs submitted from threads
+  outside the pool go into a shared queue that every worker checks before stealing.
+
+  Threads that wait on the pool (wait, parallel_for) run queued jobs instead of spinning, so
+  waiting from inside a job cannot deadlock the pool. Workers with nothing to do sleep until a
+  job is submitted.
 
-	LvnVec2_t<T>& operator+=(const LvnVec2_t<T>& v)
+  Pools created with an LvnThreadPoolCreateInfo can pin their workers to cores or to the cores
+  sharing a last level cache, keep off reserved cores and run at a different priority. Each
+  worker records its busy and idle time so that the worker count of each pool can be tuned.
+*/
+class LvnThreadPool
+{
+private:
+	struct LvnJob
 	{
-		this->x += v.x;
-		this->y += v.y;
-		return *this;
-	}
-	LvnVec2_t<T>& operator-=(const LvnVec2_t<T>& v)
+		std::function<void()> func;
+		LvnJobCounter* counter;
+	};
+
+	class LvnJobDeque
 	{
-		this->x -= v.x;
-		this->y -= v.y;
+	private:
+		struct Array
+		{
+			int64_t capacity;
+			std::atomic<LvnJob*>* jobs;
+
+			Array(int64_t cap) : capacity(cap), jobs(static_cast<std::atomic<LvnJob*>*>(lvn::memAlloc(sizeof(std::atomic<LvnJob*>) * cap)))
+			{
+				for (int64_t i = 0; i < cap; i++)
+					new (&jobs[i]) std::atomic<LvnJob*>(nullptr);
+			}
+			~Array() { lvn::memFree(jobs); }
+
+			LvnJob* get(int64_t i) const { return jobs[i & (capacity - 1)].load(std::memory_order_relaxed); }
+			void put(int64_t i, LvnJob* job) { jobs[i & (capacity - 1)].store(job, std::memory_order_relaxed); }
+		};
+
+		std::atomic<int64_t> m_Top, m_Bottom;
+		std::atomic<Array*> m_Array;
+		std::vector<Array*> m_Retired; // thieves may still read from old arrays, freed with the deque
+
+	public:
+		LvnJobDeque() : m_Top(0), m_Bottom(0), m_Array(create_internal<Array>(256)) {}
+		~LvnJobDeque()
+		{
+			destroy_internal(m_Array.load());
+			for (Array* array : m_Retired)
+				destroy_internal(array);
+		}
+
+		// owner thread only
+		void push(LvnJob* job)
+		{
+			int64_t b = m_Bottom.load(std::memory_order_relaxed);
+			int64_t t = m_Top.load(std::memory_order_acquire);
+			Array* array = m_Array.load(std::memory_order_relaxed);
+
+			if (b - t > array->capacity - 1)
+			{
+				Array* grown = create_internal<Array>(array->capacity * 2);
+				for (int64_t i = t; i < b; i++)
+					grown->put(i, array->get(i));
+
+				m_Retired.push_back(array);
+				m_Array.store(grown, std::memory_order_release);
+				array = grown;
+			}
+
+			array->put(b, job);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(b + 1, std::memory_order_relaxed);
+		}
+
+		// owner thread only
+		LvnJob* pop()
+		{
+			int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+			Array* array = m_Array.load(std::memory_order_relaxed);
+			m_Bottom.store(b, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t t = m_Top.load(std::memory_order_relaxed);
+
+			if (t > b) // empty
+			{
+				m_Bottom.store(b + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			LvnJob* job = array->get(b);
+			if (t == b) // last job, race against thieves for it
+			{
+				if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+				m_Bottom.store(b + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		// any thread
+		LvnJob* steal()
+		{
+			int64_t t = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t b = m_Bottom.load(std::memory_order_acquire);
+
+			if (t >= b) { return nullptr; }
+
+			Array* array = m_Array.load(std::memory_order_acquire);
+			LvnJob* job = array->get(t);
+			if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr; // lost the race to another thief or the owner
+
+			return job;
+		}
+	};
+
+	struct LvnWorkerInfo
+	{
+		LvnThreadPool* pool;
+		uint32_t index;
+	};
+
+	// written by the owning worker only, aligned so that workers do not share cache lines
+	struct alignas(64) LvnWorkerStatCounters
+	{
+		std::atomic<uint64_t> busyTimeNs;
+		std::atomic<uint64_t> idleTimeNs;
+		std::atomic<uint64_t> jobCount;
+		int32_t core;
+		std::vector<uint32_t> affinity;   // cores the worker may run on, empty to leave the affinity unchanged
+	};
+
+	std::vector<std::thread> m_Workers;
+	std::vector<LvnJobDeque*> m_Deques;
+	std::vector<LvnWorkerStatCounters*> m_Stats;
+	LvnThreadPriority m_Priority;
+	std::string m_Name;
+	std::deque<LvnJob*> m_SharedJobs;     // jobs submitted from threads outside the pool
+	std::mutex m_SharedMutex;
+	std::mutex m_SleepMutex;
+	std::condition_variable m_SleepCondition;
+	std::atomic<int64_t> m_Queued;        // jobs submitted but not yet taken by a thread
+	std::atomic<int64_t> m_Unfinished;    // jobs submitted but not yet finished
+	std::atomic<uint32_t> m_Sleeping;
+	std::atomic<bool> m_Terminate;
+
+	static LvnWorkerInfo& worker_info()
+	{
+		static thread_local LvnWorkerInfo s_WorkerInfo = { nullptr, 0 };
+		return s_WorkerInfo;
+	}
+
+	// index of the calling thread's deque, or -1 if the thread is not a worker of this pool
+	int64_t worker_index()
+	{
+		LvnWorkerInfo& info = worker_info();
+		return info.pool == this ? static_cast<int64_t>(info.index) : -1;
+	}
+
+	void submit(LvnJob* job)
+	{
+		if (job->counter) { job->counter->m_Count.fetch_add(1, std::memory_order_relaxed); }
+		m_Unfinished.fetch_add(1, std::memory_order_relaxed);
+
+		int64_t index = worker_index();
+		if (index >= 0)
+		{
+			m_Deques[index]->push(job);
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(m_SharedMutex);
+			m_SharedJobs.push_back(job);
+		}
+
+		m_Queued.fetch_add(1, std::memory_order_seq_cst);
+
+		// lock so that the notify cannot land between a worker checking for jobs and going to sleep
+		if (m_Sleeping.load(std::memory_order_seq_cst) > 0)
+		{
+			{ std::lock_guard<std::mutex> lock(m_SleepMutex); }
+			m_SleepCondition.notify_one();
+		}
+	}
+
+	LvnJob* find_job(int64_t index)
+	{
+		if (m_Queued.load(std::memory_order_acquire) <= 0) { return nullptr; }
+
+		LvnJob* job = nullptr;
+		if (index >= 0)
+			job = m_Deques[index]->pop();
+
+		if (!job)
+		{
+			std::lock_guard<std::mutex> lock(m_SharedMutex);
+			if (!m_SharedJobs.empty())
+			{
+				job = m_SharedJobs.front();
+				m_SharedJobs.pop_front();
+			}
+		}
+
+		// steal starting from the next worker so that thieves spread out over the deques
+		uint32_t workerCount = static_cast<uint32_t>(m_Deques.size());
+		for (uint32_t i = 1; !job && i <= workerCount; i++)
+		{
+			uint32_t victim = static_cast<uint32_t>((index + i) % workerCount);
+			if (victim != index)
+				job = m_Deques[victim]->steal();
+		}
+
+		if (job) { m_Queued.fetch_sub(1, std::memory_order_relaxed); }
+		return job;
+	}
+
+	// pool internals are allocated with lvn::memAlloc so that they use the context allocation callbacks, memAlloc aligns to
+	// alignof(std::max_align_t) so over aligned types (eg. the cache line aligned stat counters) are placed inside a larger allocation
+	// with the pointer to free stored in front of the object
+	template <typename T, typename... Args>
+	static T* create_internal(Args&&... args)
+	{
+		void* memptr = lvn::memAlloc(sizeof(void*) + alignof(T) + sizeof(T));
+		uintptr_t objptr = (reinterpret_cast<uintptr_t>(memptr) + sizeof(void*) + alignof(T) - 1) & ~static_cast<uintptr_t>(alignof(T) - 1);
+		reinterpret_cast<void**>(objptr)[-1] = memptr;
+		return new (reinterpret_cast<void*>(objptr)) T(std::forward<Args>(args)...);
+	}
+
+	template <typename T>
+	static void destroy_internal(T* obj)
+	{
+		void* memptr = reinterpret_cast<void**>(obj)[-1];
+		obj->~T();
+		lvn::memFree(memptr);
+	}
+
+	static LvnJob* create_job(std::function<void()>&& func, LvnJobCounter* counter)
+	{
+		return new (lvn::memAlloc(sizeof(LvnJob))) LvnJob{ std::move(func), counter };
+	}
+
+	static void destroy_job(LvnJob* job)
+	{
+		job->~LvnJob();
+		lvn::memFree(job);
+	}
+
+	void execute(LvnJob* job)
+	{
+		job->func();
+
+		if (job->counter) { job->counter->m_Count.fetch_sub(1, std::memory_order_release); }
+		destroy_job(job);
+
+		m_Unfinished.fetch_sub(1, std::memory_order_release);
+	}
+
+	static uint64_t elapsed_ns(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+
+	void worker_thread(uint32_t index)
+	{
+		worker_info() = { this, index };
+
+		LvnWorkerStatCounters* stats = m_Stats[index];
+		if (!stats->affinity.empty())
+			lvn::threadSetAffinity(stats->affinity.data(), static_cast<uint32_t>(stats->affinity.size()));
+		if (m_Priority != Lvn_ThreadPriority_Normal)
+			lvn::threadSetPriority(m_Priority);
+		if (!m_Name.empty())
+			lvn::threadSetName((m_Name + " " + std::to_string(index)).c_str());
+
+		// time between jobs, including sleeping, is counted as idle
+		std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+
+		while (true)
+		{
+			if (LvnJob* job = find_job(index))
+			{
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				execute(job);
+				std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+				stats->idleTimeNs.fetch_add(elapsed_ns(last, start), std::memory_order_relaxed);
+				stats->busyTimeNs.fetch_add(elapsed_ns(start, end), std::memory_order_relaxed);
+				stats->jobCount.fetch_add(1, std::memory_order_relaxed);
+				last = end;
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+
+			// queued jobs are finished before the workers exit
+			if (m_Terminate.load() && m_Queued.load() <= 0)
+			{
+				stats->idleTimeNs.fetch_add(elapsed_ns(last, std::chrono::steady_clock::now()), std::memory_order_relaxed);
+				return;
+			}
+
+			m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+			m_SleepCondition.wait(lock, [this]() { return m_Queued.load(std::memory_order_seq_cst) > 0 || m_Terminate.load(); });
+			m_Sleeping.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	void start(uint32_t workerCount, const LvnThreadPoolCreateInfo* createInfo = nullptr)
+	{
+		uint32_t coreCount = 0;
+		std::vector<bool> reserved;
+		std::vector<uint32_t> allowed; // cores that are not reserved
+
+		if (createInfo)
+		{
+			coreCount = lvn::threadGetCoreCount();
+			reserved.resize(coreCount, false);
+			for (uint32_t i = 0; i < createInfo->reservedCoreCount; i++)
+				if (createInfo->pReservedCores[i] < coreCount) { reserved[createInfo->pReservedCores[i]] = true; }
+
+			for (uint32_t i = 0; i < coreCount; i++)
+				if (!reserved[i]) { allowed.push_back(i); }
+
+			// every core is reserved, ignore the reservation instead of leaving the workers nowhere to run
+			if (allowed.empty())
+			{
+				reserved.assign(coreCount, false);
+				for (uint32_t i = 0; i < coreCount; i++)
+					allowed.push_back(i);
+			}
+
+			if (workerCount == 0)
+				workerCount = allowed.size() > 1 ? static_cast<uint32_t>(allowed.size()) - 1 : 1;
+		}
+
+		m_Workers.resize(workerCount > 0 ? workerCount : 1);
+		for (uint32_t i = 0; i < m_Workers.size(); i++)
+		{
+			m_Deques.push_back(create_internal<LvnJobDeque>());
+
+			LvnWorkerStatCounters* stats = create_internal<LvnWorkerStatCounters>();
+			stats->busyTimeNs.store(0);
+			stats->idleTimeNs.store(0);
+			stats->jobCount.store(0);
+			stats->core = -1;
+			m_Stats.push_back(stats);
+
+			if (!createInfo) { continue; }
+
+			if (createInfo->affinityMode == Lvn_ThreadAffinityMode_None)
+			{
+				if (allowed.size() < coreCount)
+					stats->affinity = allowed;
+				continue;
+			}
+
+			uint32_t core = (createInfo->pCores && createInfo->coreCount > 0)
+				? createInfo->pCores[i % createInfo->coreCount]
+				: allowed[i % allowed.size()];
+			stats->core = static_cast<int32_t>(core);
+
+			if (createInfo->affinityMode == Lvn_ThreadAffinityMode_Core)
+			{
+				stats->affinity.push_back(core);
+			}
+			else if (createInfo->affinityMode == Lvn_ThreadAffinityMode_CacheDomain)
+			{
+				std::vector<uint32_t> domain(coreCount > 0 ? coreCount : 1);
+				uint32_t domainCount = lvn::threadGetCacheDomainCores(core, domain.data(), static_cast<uint32_t>(domain.size()));
+				for (uint32_t j = 0; j < domainCount; j++)
+					if (domain[j] == core || (domain[j] < coreCount && !reserved[domain[j]])) { stats->affinity.push_back(domain[j]); }
+			}
+		}
+
+		for (uint32_t i = 0; i < m_Workers.size(); i++)
+			m_Workers[i] = std::thread(&LvnThreadPool::worker_thread, this, i);
+	}
+
+	// runs one queued job on the calling thread, yields if there is nothing to run
+	void help()
+	{
+		if (LvnJob* job = find_job(worker_index()))
+			execute(job);
+		else
+			std::this_thread::yield();
+	}
+
+public:
+	// one worker per hardware thread besides the calling thread
+	LvnThreadPool()
+		: m_Priority(Lvn_ThreadPriority_Normal), m_Queued(0), m_Unfinished(0), m_Sleeping(0), m_Terminate(false)
+	{
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		start(hardwareThreads > 1 ? hardwareThreads - 1 : 1);
+	}
+
+	LvnThreadPool(uint32_t workerCount)
+		: m_Priority(Lvn_ThreadPriority_Normal), m_Queued(0), m_Unfinished(0), m_Sleeping(0), m_Terminate(false)
+	{
+		start(workerCount);
+	}
+
+	LvnThreadPool(const LvnThreadPoolCreateInfo& createInfo)
+		: m_Priority(createInfo.priority), m_Name(createInfo.name ? createInfo.name : ""), m_Queued(0), m_Unfinished(0), m_Sleeping(0), m_Terminate(false)
+	{
+		start(createInfo.workerCount, &createInfo);
+	}
+
+	LvnThreadPool(const LvnThreadPool&) = delete;
+	LvnThreadPool& operator=(const LvnThreadPool&) = delete;
+
+	~LvnThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Terminate.store(true);
+		}
+
+		m_SleepCondition.notify_all();
+		for (uint32_t i = 0; i < m_Workers.size(); i++)
+			m_Workers[i].join();
+
+		for (LvnJobDeque* deque : m_Deques)
+			destroy_internal(deque);
+		for (LvnWorkerStatCounters* stats : m_Stats)
+			destroy_internal(stats);
+
+		m_Workers.clear();
+		m_Deques.clear();
+		m_Stats.clear();
+	}
+
+	// func can be a function pointer, lambda or any callable taking no arguments, counter is optional
+	template<typename F>
+	void add_task(F&& func, LvnJobCounter* counter = nullptr)
+	{
+		submit(create_job(std::function<void()>(std::forward<F>(func)), counter));
+	}
+
+	// calls func(userData) on a worker thread, counter is optional
+	void add_job(void (*func)(void*), void* userData, LvnJobCounter* counter = nullptr)
+	{
+		submit(create_job([func, userData]() { func(userData); }, counter));
+	}
+
+	// calls func(i) for every i in [begin, end) split into chunks of grainSize indices, the calling thread runs
+	// the first chunk and helps with the rest until all are finished. grainSize 0 picks a size that gives each thread a few chunks
+	template<typename F>
+	void parallel_for(uint64_t begin, uint64_t end, F&& func, uint64_t grainSize = 0)
+	{
+		if (begin >= end) { return; }
+
+		uint64_t count = end - begin;
+		if (grainSize == 0)
+		{
+			uint64_t chunks = (m_Workers.size() + 1) * 4;
+			grainSize = (count + chunks - 1) / chunks;
+		}
+
+		LvnJobCounter counter;
+		for (uint64_t chunk = begin + grainSize; chunk < end; chunk += grainSize)
+		{
+			uint64_t chunkEnd = std::min(chunk + grainSize, end);
+			add_task([&func, chunk, chunkEnd]() { for (uint64_t i = chunk; i < chunkEnd; i++) { func(i); } }, &counter);
+		}
+
+		for (uint64_t i = begin, firstEnd = std::min(begin + grainSize, end); i < firstEnd; i++)
+			func(i);
+
+		wait(counter);
+	}
+
+	// true while any submitted job has not finished
+	bool busy()
+	{
+		return m_Unfinished.load(std::memory_order_acquire) > 0;
+	}
+
+	// waits until every submitted job has finished, runs queued jobs while waiting. must not be called from inside a job, wait on a counter instead
+	void wait()
+	{
+		while (busy())
+			help();
+	}
+
+	// waits until the jobs submitted with counter have finished, runs queued jobs while waiting
+	void wait(LvnJobCounter& counter)
+	{
+		while (!counter.done())
+			help();
+	}
+
+	uint32_t worker_count() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+	// busy and idle time of a worker since the pool was created or reset_worker_stats was called, a job
+	// that is running is counted once it finishes
+	LvnThreadWorkerStats worker_stats(uint32_t index) const
+	{
+		LvnThreadWorkerStats workerStats{};
+		if (index >= m_Stats.size()) { return workerStats; }
+
+		const LvnWorkerStatCounters* stats = m_Stats[index];
+		workerStats.busyTimeNs = stats->busyTimeNs.load(std::memory_order_relaxed);
+		workerStats.idleTimeNs = stats->idleTimeNs.load(std::memory_order_relaxed);
+		workerStats.jobCount = stats->jobCount.load(std::memory_order_relaxed);
+		workerStats.core = stats->core;
+		return workerStats;
+	}
+
+	void reset_worker_stats()
+	{
+		for (LvnWorkerStatCounters* stats : m_Stats)
+		{
+			stats->busyTimeNs.store(0, std::memory_order_relaxed);
+			stats->idleTimeNs.store(0, std::memory_order_relaxed);
+			stats->jobCount.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+
+
+// ---------------------------------------------
+// [SECTION]: Vectors & Matrices
+// ---------------------------------------------
+
+template<typename T>
+struct LvnVec2_t
+{
+	union { T x, r, s; };
+	union { T y, g, t; };
+
+	LvnVec2_t() = default;
+	constexpr LvnVec2_t(const T& n)
+		: x(n), y(n) {}
+	constexpr LvnVec2_t(const T& nx, const T& ny)
+		: x(nx), y(ny) {}
+	constexpr LvnVec2_t(const LvnVec3_t<T>& v)
+		: x(v.x), y(v.y) {}
+	constexpr LvnVec2_t(const LvnVec4_t<T>& v)
+		: x(v.x), y(v.y) {}
+
+
+	constexpr LvnVec2_t<T>& operator+=(const LvnVec2_t<T>& v)
+	{
+		this->x += v.x;
+		this->y += v.y;
+		return *this;
+	}
+	constexpr LvnVec2_t<T>& operator-=(const LvnVec2_t<T>& v)
+	{
+		this->x -= v.x;
+		this->y -= v.y;
 		return *this;
 	}
-	LvnVec2_t<T>& operator*=(const LvnVec2_t<T>& v)
+	constexpr LvnVec2_t<T>& operator*=(const LvnVec2_t<T>& v)
 	{
 		this->x *= v.x;
 		this->y *= v.y;
 		return *this;
 	}
-	LvnVec2_t<T>& operator/=(const LvnVec2_t<T>& v)
+	constexpr LvnVec2_t<T>& operator/=(const LvnVec2_t<T>& v)
 	{
 		this->x /= v.x;
 		this->y /= v.y;
 		return *this;
 	}
-	T& operator[](int i)
+	constexpr T& operator[](int i)
 	{
 		switch (i)
 		{
@@ -2289,7 +3399,7 @@ struct LvnVec2_t
 			return y;
 		}
 	}
-	T& operator[](int i) const
+	constexpr const T& operator[](int i) const
 	{
 		switch (i)
 		{
@@ -2303,72 +3413,72 @@ struct LvnVec2_t
 };
 
 template <typename T>
-LvnVec2_t<T> operator+(const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator+(const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(v.x, v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator-(const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator-(const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t(-v.x, -v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator+(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+constexpr LvnVec2_t<T> operator+(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 {
 	return LvnVec2_t<T>(v1.x + v2.x, v1.y + v2.y);
 }
 template <typename T>
-LvnVec2_t<T> operator-(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+constexpr LvnVec2_t<T> operator-(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 {
 	return LvnVec2_t<T>(v1.x - v2.x, v1.y - v2.y);
 }
 template <typename T>
-LvnVec2_t<T> operator*(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+constexpr LvnVec2_t<T> operator*(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 {
 	return LvnVec2_t<T>(v1.x * v2.x, v1.y * v2.y);
 }
 template <typename T>
-LvnVec2_t<T> operator/(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+constexpr LvnVec2_t<T> operator/(const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 {
 	return LvnVec2_t<T>(v1.x / v2.x, v1.y / v2.y);
 }
 template <typename T>
-LvnVec2_t<T> operator+(const T& s, const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator+(const T& s, const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(s + v.x, s + v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator-(const T& s, const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator-(const T& s, const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(s - v.x, s - v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator*(const T& s, const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator*(const T& s, const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(s * v.x, s * v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator/(const T& s, const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator/(const T& s, const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(s / v.x, s / v.y);
 }
 template <typename T>
-LvnVec2_t<T> operator+(const LvnVec2_t<T>& v, const T& s)
+constexpr LvnVec2_t<T> operator+(const LvnVec2_t<T>& v, const T& s)
 {
 	return LvnVec2_t<T>(v.x + s, v.y + s);
 }
 template <typename T>
-LvnVec2_t<T> operator-(const LvnVec2_t<T>& v, const T& s)
+constexpr LvnVec2_t<T> operator-(const LvnVec2_t<T>& v, const T& s)
 {
 	return LvnVec2_t<T>(v.x - s, v.y - s);
 }
 template <typename T>
-LvnVec2_t<T> operator*(const LvnVec2_t<T>& v, const T& s)
+constexpr LvnVec2_t<T> operator*(const LvnVec2_t<T>& v, const T& s)
 {
 	return LvnVec2_t<T>(v.x * s, v.y * s);
 }
 template <typename T>
-LvnVec2_t<T> operator/(const LvnVec2_t<T>& v, const T& s)
+constexpr LvnVec2_t<T> operator/(const LvnVec2_t<T>& v, const T& s)
 {
 	return LvnVec2_t<T>(v.x / s, v.y / s);
 }
@@ -2381,53 +3491,49 @@ struct LvnVec3_t
 	union { T y, g, t; };
 	union { T z, b, p; };
 
-	LvnVec3_t() {}
-	LvnVec3_t(const T& n)
+	LvnVec3_t() = default;
+	constexpr LvnVec3_t(const T& n)
 		: x(n), y(n), z(n) {}
-	LvnVec3_t(const T& nx, const T& ny, const T& nz)
+	constexpr LvnVec3_t(const T& nx, const T& ny, const T& nz)
 		: x(nx), y(ny), z(nz) {}
-	LvnVec3_t(const T& n_x, const LvnVec2_t<T>& n_yz)
-		: x(n_x), y(n_yz.y), z(n_yz.z) {}
-	LvnVec3_t(const LvnVec2_t<T>& n_xy, const T& n_z)
+	constexpr LvnVec3_t(const T& n_x, const LvnVec2_t<T>& n_yz)
+		: x(n_x), y(n_yz.x), z(n_yz.y) {}
+	constexpr LvnVec3_t(const LvnVec2_t<T>& n_xy, const T& n_z)
 		: x(n_xy.x), y(n_xy.y), z(n_z) {}
-	LvnVec3_t(const LvnVec2_t<T>& n_xy)
+	constexpr LvnVec3_t(const LvnVec2_t<T>& n_xy)
 		: x(n_xy.x), y(n_xy.y), z(T(0)) {}
-	LvnVec3_t(const LvnVec4_t<T>& v)
-	{
-		this->x = v.x;
-		this->y = v.y;
-		this->z = v.z;
-	}
+	constexpr LvnVec3_t(const LvnVec4_t<T>& v)
+		: x(v.x), y(v.y), z(v.z) {}
 
-	LvnVec3_t<T>& operator+=(const LvnVec3_t<T>& v)
+	constexpr LvnVec3_t<T>& operator+=(const LvnVec3_t<T>& v)
 	{
 		this->x += v.x;
 		this->y += v.y;
 		this->z += v.z;
 		return *this;
 	}
-	LvnVec3_t<T>& operator-=(const LvnVec3_t<T>& v)
+	constexpr LvnVec3_t<T>& operator-=(const LvnVec3_t<T>& v)
 	{
 		this->x -= v.x;
 		this->y -= v.y;
 		this->z -= v.z;
 		return *this;
 	}
-	LvnVec3_t<T>& operator*=(const LvnVec3_t<T>& v)
+	constexpr LvnVec3_t<T>& operator*=(const LvnVec3_t<T>& v)
 	{
 		this->x *= v.x;
 		this->y *= v.y;
 		this->z *= v.z;
 		return *this;
 	}
-	LvnVec3_t<T>& operator/=(const LvnVec3_t<T>& v)
+	constexpr LvnVec3_t<T>& operator/=(const LvnVec3_t<T>& v)
 	{
 		this->x /= v.x;
 		this->y /= v.y;
 		this->z /= v.z;
 		return *this;
 	}
-	T& operator[](int i)
+	constexpr T& operator[](int i)
 	{
 		switch (i)
 		{
@@ -2440,7 +3546,7 @@ struct LvnVec3_t
 			return z;
 		}
 	}
-	T& operator[](int i) const
+	constexpr const T& operator[](int i) const
 	{
 		switch (i)
 		{
@@ -2456,72 +3562,72 @@ struct LvnVec3_t
 };
 
 template <typename T>
-LvnVec3_t<T> operator+(const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator+(const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(v.x, v.y, v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator-(const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator-(const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t(-v.x, -v.y, -v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator+(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+constexpr LvnVec3_t<T> operator+(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 {
 	return LvnVec3_t<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
 }
 template <typename T>
-LvnVec3_t<T> operator-(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+constexpr LvnVec3_t<T> operator-(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 {
 	return LvnVec3_t<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
 }
 template <typename T>
-LvnVec3_t<T> operator*(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+constexpr LvnVec3_t<T> operator*(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 {
 	return LvnVec3_t<T>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
 }
 template <typename T>
-LvnVec3_t<T> operator/(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+constexpr LvnVec3_t<T> operator/(const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 {
 	return LvnVec3_t<T>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
 }
 template <typename T>
-LvnVec3_t<T> operator+(const T& s, const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator+(const T& s, const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(s + v.x, s + v.y, s + v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator-(const T& s, const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator-(const T& s, const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(s - v.x, s - v.y, s - v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator*(const T& s, const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator*(const T& s, const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(s * v.x, s * v.y, s * v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator/(const T& s, const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator/(const T& s, const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(s / v.x, s / v.y, s / v.z);
 }
 template <typename T>
-LvnVec3_t<T> operator+(const LvnVec3_t<T>& v, const T& s)
+constexpr LvnVec3_t<T> operator+(const LvnVec3_t<T>& v, const T& s)
 {
 	return LvnVec3_t<T>(v.x + s, v.y + s, v.z + s);
 }
 template <typename T>
-LvnVec3_t<T> operator-(const LvnVec3_t<T>& v, const T& s)
+constexpr LvnVec3_t<T> operator-(const LvnVec3_t<T>& v, const T& s)
 {
 	return LvnVec3_t<T>(v.x - s, v.y - s, v.z - s);
 }
 template <typename T>
-LvnVec3_t<T> operator*(const LvnVec3_t<T>& v, const T& s)
+constexpr LvnVec3_t<T> operator*(const LvnVec3_t<T>& v, const T& s)
 {
 	return LvnVec3_t<T>(v.x * s, v.y * s, v.z * s);
 }
 template <typename T>
-LvnVec3_t<T> operator/(const LvnVec3_t<T>& v, const T& s)
+constexpr LvnVec3_t<T> operator/(const LvnVec3_t<T>& v, const T& s)
 {
 	return LvnVec3_t<T>(v.x / s, v.y / s, v.z / s);
 }
@@ -2535,68 +3641,68 @@ struct LvnVec4_t
 	union { T z, b, p; };
 	union { T w, a, q; };
 
-	LvnVec4_t() {}
-	LvnVec4_t(const T& n)
+	LvnVec4_t() = default;
+	constexpr LvnVec4_t(const T& n)
 		: x(n), y(n), z(n), w(n) {}
-	LvnVec4_t(const T& nx, const T& ny, const T& nz, const T& nw)
+	constexpr LvnVec4_t(const T& nx, const T& ny, const T& nz, const T& nw)
 		: x(nx), y(ny), z(nz), w(nw) {}
-	LvnVec4_t(const T& n_x, const T& n_y, const LvnVec2_t<T>& n_zw)
-		: x(n_x), y(n_y), z(n_zw.z), w(n_zw.w) {}
-	LvnVec4_t(const LvnVec2_t<T>& n_xy, const T& n_z, const T& n_w)
+	constexpr LvnVec4_t(const T& n_x, const T& n_y, const LvnVec2_t<T>& n_zw)
+		: x(n_x), y(n_y), z(n_zw.x), w(n_zw.y) {}
+	constexpr LvnVec4_t(const LvnVec2_t<T>& n_xy, const T& n_z, const T& n_w)
 		: x(n_xy.x), y(n_xy.y), z(n_z), w(n_w) {}
-	LvnVec4_t(const T& n_x, const LvnVec2_t<T>& n_yz, const T& n_w)
-		: x(n_x), y(n_yz.y), z(n_yz.z), w(n_w) {}
-	LvnVec4_t(const LvnVec3_t<T>& n_xyz, const T& n_w)
+	constexpr LvnVec4_t(const T& n_x, const LvnVec2_t<T>& n_yz, const T& n_w)
+		: x(n_x), y(n_yz.x), z(n_yz.y), w(n_w) {}
+	constexpr LvnVec4_t(const LvnVec3_t<T>& n_xyz, const T& n_w)
 		: x(n_xyz.x), y(n_xyz.y), z(n_xyz.z), w(n_w) {}
-	LvnVec4_t(const T& n_x, const LvnVec3_t<T>& n_yzw)
-		: x(n_x), y(n_yzw.y), z(n_yzw.z), w(n_yzw.w) {}
-	LvnVec4_t(const LvnVec2_t<T>& n_xy)
+	constexpr LvnVec4_t(const T& n_x, const LvnVec3_t<T>& n_yzw)
+		: x(n_x), y(n_yzw.x), z(n_yzw.y), w(n_yzw.z) {}
+	constexpr LvnVec4_t(const LvnVec2_t<T>& n_xy)
 		: x(n_xy.x), y(n_xy.y), z(0), w(T(0)) {}
-	LvnVec4_t(const LvnVec3_t<T>& n_xyz)
+	constexpr LvnVec4_t(const LvnVec3_t<T>& n_xyz)
 		: x(n_xyz.x), y(n_xyz.y), z(n_xyz.z), w(T(0)) {}
 
-	LvnVec4_t<T> operator+()
+	constexpr LvnVec4_t<T> operator+()
 	{
 		return { this->x, this->y, this->z, this->w };
 	}
-	LvnVec4_t<T> operator-()
+	constexpr LvnVec4_t<T> operator-()
 	{
 		return { -this->x, -this->y, -this->z, -this->w };
 	}
-	LvnVec4_t<T> operator+(LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T> operator+(LvnVec4_t<T>& v)
 	{
 		return { this->x + v.x, this->y + v.y, this->z + v.z, this->w + v.w };
 	}
-	LvnVec4_t<T> operator-(LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T> operator-(LvnVec4_t<T>& v)
 	{
 		return { this->x - v.x, this->y - v.y, this->z - v.z, this->w - v.w };
 	}
-	LvnVec4_t<T> operator*(LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T> operator*(LvnVec4_t<T>& v)
 	{
 		return { this->x * v.x, this->y * v.y, this->z * v.z, this->w * v.w };
 	}
-	LvnVec4_t<T> operator/(LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T> operator/(LvnVec4_t<T>& v)
 	{
 		return { this->x / v.x, this->y / v.y, this->z / v.z, this->w / v.w };
 	}
-	LvnVec4_t<T> operator+(const LvnVec4_t<T>& v) const
+	constexpr LvnVec4_t<T> operator+(const LvnVec4_t<T>& v) const
 	{
 		return { this->x + v.x, this->y + v.y, this->z + v.z, this->w + v.w };
 	}
-	LvnVec4_t<T> operator-(const LvnVec4_t<T>& v) const
+	constexpr LvnVec4_t<T> operator-(const LvnVec4_t<T>& v) const
 	{
 		return { this->x - v.x, this->y - v.y, this->z - v.z, this->w - v.w };
 	}
-	LvnVec4_t<T> operator*(const LvnVec4_t<T>& v) const
+	constexpr LvnVec4_t<T> operator*(const LvnVec4_t<T>& v) const
 	{
 		return { this->x * v.x, this->y * v.y, this->z * v.z, this->w * v.w };
 	}
-	LvnVec4_t<T> operator/(const LvnVec4_t<T>& v) const
+	constexpr LvnVec4_t<T> operator/(const LvnVec4_t<T>& v) const
 	{
 		return { this->x / v.x, this->y / v.y, this->z / v.z, this->w / v.w };
 	}
 
-	LvnVec4_t<T>& operator+=(const LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T>& operator+=(const LvnVec4_t<T>& v)
 	{
 		this->x += v.x;
 		this->y += v.y;
@@ -2604,7 +3710,7 @@ struct LvnVec4_t
 		this->w += v.w;
 		return *this;
 	}
-	LvnVec4_t<T>& operator-=(const LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T>& operator-=(const LvnVec4_t<T>& v)
 	{
 		this->x -= v.x;
 		this->y -= v.y;
@@ -2612,7 +3718,7 @@ struct LvnVec4_t
 		this->w -= v.w;
 		return *this;
 	}
-	LvnVec4_t<T>& operator*=(const LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T>& operator*=(const LvnVec4_t<T>& v)
 	{
 		this->x *= v.x;
 		this->y *= v.y;
@@ -2620,7 +3726,7 @@ struct LvnVec4_t
 		this->w *= v.w;
 		return *this;
 	}
-	LvnVec4_t<T>& operator/=(const LvnVec4_t<T>& v)
+	constexpr LvnVec4_t<T>& operator/=(const LvnVec4_t<T>& v)
 	{
 		this->x /= v.x;
 		this->y /= v.y;
@@ -2628,7 +3734,7 @@ struct LvnVec4_t
 		this->w /= v.w;
 		return *this;
 	}
-	T& operator[](int i)
+	constexpr T& operator[](int i)
 	{
 		switch (i)
 		{
@@ -2643,7 +3749,7 @@ struct LvnVec4_t
 			return w;
 		}
 	}
-	T& operator[](int i) const
+	constexpr const T& operator[](int i) const
 	{
 		switch (i)
 		{
@@ -2661,72 +3767,72 @@ struct LvnVec4_t
 };
 
 template <typename T>
-LvnVec4_t<T> operator+(const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator+(const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t<T>(v.x, v.y, v.z, v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator-(const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator-(const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t(-v.x, -v.y, -v.z, -v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator+(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+constexpr LvnVec4_t<T> operator+(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 {
 	return LvnVec4_t<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w);
 }
 template <typename T>
-LvnVec4_t<T> operator-(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+constexpr LvnVec4_t<T> operator-(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 {
 	return LvnVec4_t<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w);
 }
 template <typename T>
-LvnVec4_t<T> operator*(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+constexpr LvnVec4_t<T> operator*(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 {
 	return LvnVec4_t<T>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z, v1.w * v2.w);
 }
 template <typename T>
-LvnVec4_t<T> operator/(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+constexpr LvnVec4_t<T> operator/(const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 {
 	return LvnVec4_t<T>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w / v2.w);
 }
 template <typename T>
-LvnVec4_t<T> operator+(const T& s, const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator+(const T& s, const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t<T>(s + v.x, s + v.y, s + v.z, s + v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator-(const T& s, const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator-(const T& s, const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t<T>(s - v.x, s - v.y, s - v.z, s - v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator*(const T& s, const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator*(const T& s, const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t<T>(s * v.x, s * v.y, s * v.z, s * v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator/(const T& s, const LvnVec4_t<T>& v)
+constexpr LvnVec4_t<T> operator/(const T& s, const LvnVec4_t<T>& v)
 {
 	return LvnVec4_t<T>(s / v.x, s / v.y, s / v.z, s / v.w);
 }
 template <typename T>
-LvnVec4_t<T> operator+(const LvnVec4_t<T>& v, const T& s)
+constexpr LvnVec4_t<T> operator+(const LvnVec4_t<T>& v, const T& s)
 {
 	return LvnVec4_t<T>(v.x + s, v.y + s, v.z + s, v.w + s);
 }
 template <typename T>
-LvnVec4_t<T> operator-(const LvnVec4_t<T>& v, const T& s)
+constexpr LvnVec4_t<T> operator-(const LvnVec4_t<T>& v, const T& s)
 {
 	return LvnVec4_t<T>(v.x - s, v.y - s, v.z - s, v.w - s);
 }
 template <typename T>
-LvnVec4_t<T> operator*(const LvnVec4_t<T>& v, const T& s)
+constexpr LvnVec4_t<T> operator*(const LvnVec4_t<T>& v, const T& s)
 {
 	return LvnVec4_t<T>(v.x * s, v.y * s, v.z * s, v.w * s);
 }
 template <typename T>
-LvnVec4_t<T> operator/(const LvnVec4_t<T>& v, const T& s)
+constexpr LvnVec4_t<T> operator/(const LvnVec4_t<T>& v, const T& s)
 {
 	return LvnVec4_t<T>(v.x / s, v.y / s, v.z / s, v.w / s);
 }
@@ -2737,88 +3843,79 @@ struct LvnMat2x2_t
 {
 	LvnVec2_t<T> value[2];
 
-	static int length() { return 2; }
+	static constexpr int length() { return 2; }
 
-	LvnMat2x2_t()
-	{
-		this->value[0] = { 1, 0 };
-		this->value[1] = { 0, 1 };
-	}
-	LvnMat2x2_t(const T& n)
-	{
-		this->value[0] = { n, 0 };
-		this->value[1] = { 0, n };
-	}
-	LvnMat2x2_t
+	constexpr LvnMat2x2_t()
+		: value{ { 1, 0 }, { 0, 1 } } {}
+	constexpr LvnMat2x2_t(const T& n)
+		: value{ { n, 0 }, { 0, n } } {}
+	constexpr LvnMat2x2_t
 	(
 		const T& x0, const T& y0,
 		const T& x1, const T& y1
 	)
-	{
-		this->value[0] = { x0, y0 };
-		this->value[1] = { x1, y1 };
-	}
-	LvnMat2x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1)
+		: value{ { x0, y0 }, { x1, y1 } } {}
+	constexpr LvnMat2x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1)
 		: value{ v0, v1 } {}
-	LvnMat2x2_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
-	LvnMat2x2_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat2x2_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]) } {}
 
-	LvnVec2_t<T>& operator[](int i)
+	constexpr LvnVec2_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec2_t<T> operator[](int i) const
+	constexpr LvnVec2_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat2x2_t<T> operator+()
+	constexpr LvnMat2x2_t<T> operator+()
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x2_t<T> operator-()
+	constexpr LvnMat2x2_t<T> operator-()
 	{
 		return LvnMat2x2_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x2_t<T> operator+(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x2_t<T> operator+(const LvnMat2x2_t<T>& m)
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x2_t<T> operator-(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x2_t<T> operator-(const LvnMat2x2_t<T>& m)
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat2x2_t<T> operator*(const T& s)
+	constexpr LvnMat2x2_t<T> operator*(const T& s)
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] * s,
 			this->value[1] * s);
 	}
-	LvnMat2x2_t<T> operator*(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x2_t<T> operator*(const LvnMat2x2_t<T>& m)
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2826,7 +3923,7 @@ struct LvnMat2x2_t
 			this->value[0].x * m.value[1].x + this->value[1].x * m.value[1].y,
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x2_t<T>& m)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2836,7 +3933,7 @@ struct LvnMat2x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x2_t<T>& m)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2849,37 +3946,37 @@ struct LvnMat2x2_t
 			this->value[0].y * m.value[3].x + this->value[1].y * m.value[3].y);
 	}
 
-	LvnMat2x2_t<T> operator+() const
+	constexpr LvnMat2x2_t<T> operator+() const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x2_t<T> operator-() const
+	constexpr LvnMat2x2_t<T> operator-() const
 	{
 		return LvnMat2x2_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x2_t<T> operator+(const LvnMat2x2_t<T>& m) const
+	constexpr LvnMat2x2_t<T> operator+(const LvnMat2x2_t<T>& m) const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x2_t<T> operator-(const LvnMat2x2_t<T>& m) const
+	constexpr LvnMat2x2_t<T> operator-(const LvnMat2x2_t<T>& m) const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat2x2_t<T> operator*(const T& n) const
+	constexpr LvnMat2x2_t<T> operator*(const T& n) const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0] * n,
 			this->value[1] * n);
 	}
-	LvnMat2x2_t<T> operator*(const LvnMat2x2_t<T>& m) const
+	constexpr LvnMat2x2_t<T> operator*(const LvnMat2x2_t<T>& m) const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2887,7 +3984,7 @@ struct LvnMat2x2_t
 			this->value[0].x * m.value[1].x + this->value[1].x * m.value[1].y,
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x2_t<T>& m) const
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x2_t<T>& m) const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2897,7 +3994,7 @@ struct LvnMat2x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x2_t<T>& m) const
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x2_t<T>& m) const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -2912,14 +4009,14 @@ struct LvnMat2x2_t
 };
 
 template<typename T>
-LvnVec2_t<T> operator*(const LvnMat2x2_t<T>& m, const LvnVec2_t<T>& v)
+constexpr LvnVec2_t<T> operator*(const LvnMat2x2_t<T>& m, const LvnVec2_t<T>& v)
 {
 	return LvnVec2_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y,
 		m.value[0].y * v.x + m.value[1].y * v.y);
 }
 template<typename T>
-LvnVec2_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat2x2_t<T>& m)
+constexpr LvnVec2_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat2x2_t<T>& m)
 {
 	return LvnVec2_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y,
@@ -2931,97 +4028,85 @@ struct LvnMat3x3_t
 {
 	LvnVec3_t<T> value[3];
 
-	static int length() { return 3; }
+	static constexpr int length() { return 3; }
 
-	LvnMat3x3_t()
-	{
-		this->value[0] = { 1, 0, 0 };
-		this->value[1] = { 0, 1, 0 };
-		this->value[2] = { 0, 0, 1 };
-	}
-	LvnMat3x3_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0 };
-		this->value[1] = { 0, n, 0 };
-		this->value[2] = { 0, 0, n };
-	}
-	LvnMat3x3_t
+	constexpr LvnMat3x3_t()
+		: value{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } } {}
+	constexpr LvnMat3x3_t(const T& n)
+		: value{ { n, 0, 0 }, { 0, n, 0 }, { 0, 0, n } } {}
+	constexpr LvnMat3x3_t
 	(
 		const T& x0, const T& y0, const T& z0,
 		const T& x1, const T& y1, const T& z1,
 		const T& x2, const T& y2, const T& z2
 	)
-	{
-		this->value[0] = { x0, y0, z0 };
-		this->value[1] = { x1, y1, z1 };
-		this->value[2] = { x2, y2, z2 };
-	}
-	LvnMat3x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
+		: value{ { x0, y0, z0 }, { x1, y1, z1 }, { x2, y2, z2 } } {}
+	constexpr LvnMat3x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2)
 		: value{ v0, v1, v2 } {}
-	LvnMat3x3_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(0, 0, 1) } {}
-	LvnMat3x3_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]) } {}
-	LvnMat3x3_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]) } {}
-	LvnMat3x3_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(0, 0, 1) } {}
-	LvnMat3x3_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(0, 0, 1) } {}
-	LvnMat3x3_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(m.value[2], 1) } {}
-	LvnMat3x3_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]) } {}
-	LvnMat3x3_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(m.value[2], 1) } {}
-	LvnMat3x3_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat3x3_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]) } {}
 
-	LvnVec3_t<T>& operator[](int i)
+	constexpr LvnVec3_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec3_t<T> operator[](int i) const
+	constexpr LvnVec3_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat3x3_t<T> operator+()
+	constexpr LvnMat3x3_t<T> operator+()
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x3_t<T> operator-()
+	constexpr LvnMat3x3_t<T> operator-()
 	{
 		return LvnMat3x3_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x3_t<T> operator+(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x3_t<T> operator+(const LvnMat3x3_t<T>& m)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x3_t<T> operator-(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x3_t<T> operator-(const LvnMat3x3_t<T>& m)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat3x3_t<T> operator*(const T& s)
+	constexpr LvnMat3x3_t<T> operator*(const T& s)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0] * s,
 			this->value[1] * s,
 			this->value[2] * s);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x3_t<T>& m)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3034,7 +4119,7 @@ struct LvnMat3x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y + this->value[2].z * m.value[2].z);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x3_t<T>& m)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3044,7 +4129,7 @@ struct LvnMat3x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x3_t<T>& m)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3061,35 +4146,35 @@ struct LvnMat3x3_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z);
 	}
 
-	LvnMat3x3_t<T> operator+() const
+	constexpr LvnMat3x3_t<T> operator+() const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x3_t<T> operator-() const
+	constexpr LvnMat3x3_t<T> operator-() const
 	{
 		return LvnMat3x3_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x3_t<T> operator+(const LvnMat3x3_t<T>& m) const
+	constexpr LvnMat3x3_t<T> operator+(const LvnMat3x3_t<T>& m) const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x3_t<T> operator-(const LvnMat3x3_t<T>& m) const
+	constexpr LvnMat3x3_t<T> operator-(const LvnMat3x3_t<T>& m) const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x3_t<T>& m) const
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x3_t<T>& m) const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3102,7 +4187,7 @@ struct LvnMat3x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y + this->value[2].z * m.value[2].z);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x3_t<T>& m) const
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x3_t<T>& m) const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3112,7 +4197,7 @@ struct LvnMat3x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x3_t<T>& m) const
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x3_t<T>& m) const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3131,7 +4216,7 @@ struct LvnMat3x3_t
 };
 
 template<typename T>
-LvnVec3_t<T> operator*(const LvnMat3x3_t<T>& m, const LvnVec3_t<T>& v)
+constexpr LvnVec3_t<T> operator*(const LvnMat3x3_t<T>& m, const LvnVec3_t<T>& v)
 {
 	return LvnVec3_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z,
@@ -3139,7 +4224,7 @@ LvnVec3_t<T> operator*(const LvnMat3x3_t<T>& m, const LvnVec3_t<T>& v)
 		m.value[0].z * v.x + m.value[1].z * v.y + m.value[2].z * v.z);
 }
 template<typename T>
-LvnVec3_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat3x3_t<T>& m)
+constexpr LvnVec3_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat3x3_t<T>& m)
 {
 	return LvnVec3_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z,
@@ -3152,66 +4237,51 @@ struct LvnMat4x4_t
 {
 	LvnVec4_t<T> value[4];
 
-	static int length() { return 4; }
+	static constexpr int length() { return 4; }
 
-	LvnMat4x4_t()
-	{
-		this->value[0] = { 1, 0, 0, 0 };
-		this->value[1] = { 0, 1, 0, 0 };
-		this->value[2] = { 0, 0, 1, 0 };
-		this->value[3] = { 0, 0, 0, 1 };
-	}
-	LvnMat4x4_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0, 0 };
-		this->value[1] = { 0, n, 0, 0 };
-		this->value[2] = { 0, 0, n, 0 };
-		this->value[3] = { 0, 0, 0, n };
-	}
-	LvnMat4x4_t
+	constexpr LvnMat4x4_t()
+		: value{ { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } } {}
+	constexpr LvnMat4x4_t(const T& n)
+		: value{ { n, 0, 0, 0 }, { 0, n, 0, 0 }, { 0, 0, n, 0 }, { 0, 0, 0, n } } {}
+	constexpr LvnMat4x4_t
 	(
 		const T& x0, const T& y0, const T& z0, const T& w0,
 		const T& x1, const T& y1, const T& z1, const T& w1,
 		const T& x2, const T& y2, const T& z2, const T& w2,
 		const T& x3, const T& y3, const T& z3, const T& w3
 	)
-	{
-		this->value[0] = { x0, y0, z0, w0 };
-		this->value[1] = { x1, y1, z1, w1 };
-		this->value[2] = { x2, y2, z2, w2 };
-		this->value[3] = { x3, y3, z3, w3 };
-	}
-	LvnMat4x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2, const LvnVec4_t<T>& v3)
+		: value{ { x0, y0, z0, w0 }, { x1, y1, z1, w1 }, { x2, y2, z2, w2 }, { x3, y3, z3, w3 } } {}
+	constexpr LvnMat4x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2, const LvnVec4_t<T>& v3)
 		: value{ v0, v1, v2, v3 } {}
-	LvnMat4x4_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(0, 0, 1, 0), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(m.value[2], 0), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(m.value[2]), LvnVec4_t<T>(m.value[3]) } {}
-	LvnMat4x4_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(0, 0, 1, 0), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(0, 0, 1, 0), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(m.value[2], 0, 0), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(m.value[2]), LvnVec4_t<T>(0, 0, 0, 1) } {}
-	LvnMat4x4_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(m.value[2], 1, 0), LvnVec4_t<T>(m.value[3], 0, 1) } {}
-	LvnMat4x4_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x4_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(m.value[2], 0), LvnVec4_t<T>(m.value[3], 1) } {}
 
-	LvnVec4_t<T>& operator[](int i)
+	constexpr LvnVec4_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec4_t<T> operator[](int i) const
+	constexpr LvnVec4_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat4x4_t<T> operator+()
+	constexpr LvnMat4x4_t<T> operator+()
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0],
@@ -3219,7 +4289,7 @@ struct LvnMat4x4_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x4_t<T> operator-()
+	constexpr LvnMat4x4_t<T> operator-()
 	{
 		return LvnMat4x4_t<T>(
 			-this->value[0],
@@ -3227,7 +4297,7 @@ struct LvnMat4x4_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x4_t<T> operator+(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x4_t<T> operator+(const LvnMat4x4_t<T>& m)
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0] + m.value[0],
@@ -3235,7 +4305,7 @@ struct LvnMat4x4_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x4_t<T> operator-(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x4_t<T> operator-(const LvnMat4x4_t<T>& m)
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0] - m.value[0],
@@ -3243,7 +4313,7 @@ struct LvnMat4x4_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat4x4_t<T> operator*(const T& s)
+	constexpr LvnMat4x4_t<T> operator*(const T& s)
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0] * s,
@@ -3251,8 +4321,15 @@ struct LvnMat4x4_t
 			this->value[2] * s,
 			this->value[3] * s);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x4_t<T>& m)
 	{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+		if constexpr (std::is_same<T, float>::value)
+		{
+			if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4Multiply(*this, m); }
+		}
+#endif
+
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
 			this->value[0].y * m.value[0].x + this->value[1].y * m.value[0].y + this->value[2].y * m.value[0].z + this->value[3].y * m.value[0].w,
@@ -3271,7 +4348,7 @@ struct LvnMat4x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z + this->value[3].z * m.value[3].w,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y + this->value[2].w * m.value[3].z + this->value[3].w * m.value[3].w);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x4_t<T>& m)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -3283,7 +4360,7 @@ struct LvnMat4x4_t
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z + this->value[3].z * m.value[1].w,
 			this->value[0].w * m.value[1].x + this->value[1].w * m.value[1].y + this->value[2].w * m.value[1].z + this->value[3].w * m.value[1].w);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x4_t<T>& m)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -3300,7 +4377,7 @@ struct LvnMat4x4_t
 			this->value[0].w * m.value[2].x + this->value[1].w * m.value[2].y + this->value[2].w * m.value[2].z + this->value[3].w * m.value[2].w);
 	}
 
-	LvnMat4x4_t<T> operator+() const
+	constexpr LvnMat4x4_t<T> operator+() const
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0],
@@ -3308,7 +4385,7 @@ struct LvnMat4x4_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x4_t<T> operator-() const
+	constexpr LvnMat4x4_t<T> operator-() const
 	{
 		return LvnMat4x4_t<T>(
 			-this->value[0],
@@ -3316,7 +4393,7 @@ struct LvnMat4x4_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x4_t<T> operator+(const LvnMat4x4_t<T>& m) const
+	constexpr LvnMat4x4_t<T> operator+(const LvnMat4x4_t<T>& m) const
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0] + m.value[0],
@@ -3324,7 +4401,7 @@ struct LvnMat4x4_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x4_t<T> operator-(const LvnMat4x4_t<T>& m) const
+	constexpr LvnMat4x4_t<T> operator-(const LvnMat4x4_t<T>& m) const
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0] - m.value[0],
@@ -3332,8 +4409,15 @@ struct LvnMat4x4_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x4_t<T>& m) const
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x4_t<T>& m) const
 	{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+		if constexpr (std::is_same<T, float>::value)
+		{
+			if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4Multiply(*this, m); }
+		}
+#endif
+
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
 			this->value[0].y * m.value[0].x + this->value[1].y * m.value[0].y + this->value[2].y * m.value[0].z + this->value[3].y * m.value[0].w,
@@ -3352,7 +4436,7 @@ struct LvnMat4x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z + this->value[3].z * m.value[3].w,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y + this->value[2].w * m.value[3].z + this->value[3].w * m.value[3].w);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x4_t<T>& m) const
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x4_t<T>& m) const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -3364,7 +4448,7 @@ struct LvnMat4x4_t
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z + this->value[3].z * m.value[1].w,
 			this->value[0].w * m.value[1].x + this->value[1].w * m.value[1].y + this->value[2].w * m.value[1].z + this->value[3].w * m.value[1].w);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x4_t<T>& m) const
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x4_t<T>& m) const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -3382,9 +4466,16 @@ struct LvnMat4x4_t
 	}
 };
 
-template<typename T>
-LvnVec4_t<T> operator*(const LvnMat4x4_t<T>& m, const LvnVec4_t<T>& v)
-{
+template<typename T>
+constexpr LvnVec4_t<T> operator*(const LvnMat4x4_t<T>& m, const LvnVec4_t<T>& v)
+{
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+	if constexpr (std::is_same<T, float>::value)
+	{
+		if (!LVN_IS_CONSTANT_EVALUATED()) { return lvn::simdMat4MultiplyVec(m, v); }
+	}
+#endif
+
 	return LvnVec4_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z + m.value[3].x * v.w,
 		m.value[0].y * v.x + m.value[1].y * v.y + m.value[2].y * v.z + m.value[3].y * v.w,
@@ -3392,7 +4483,7 @@ LvnVec4_t<T> operator*(const LvnMat4x4_t<T>& m, const LvnVec4_t<T>& v)
 		m.value[0].w * v.x + m.value[1].w * v.y + m.value[2].w * v.z + m.value[3].w * v.w);
 }
 template<typename T>
-LvnVec4_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat4x4_t<T>& m)
+constexpr LvnVec4_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat4x4_t<T>& m)
 {
 	return LvnVec4_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z + v.w * m.value[0].w,
@@ -3406,88 +4497,79 @@ struct LvnMat2x3_t
 {
 	LvnVec3_t<T> value[2];
 
-	static int length() { return 2; }
+	static constexpr int length() { return 2; }
 
-	LvnMat2x3_t()
-	{
-		this->value[0] = { 1, 0, 0 };
-		this->value[1] = { 0, 1, 0 };
-	}
-	LvnMat2x3_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0 };
-		this->value[1] = { 0, n, 0 };
-	}
-	LvnMat2x3_t
+	constexpr LvnMat2x3_t()
+		: value{ { 1, 0, 0 }, { 0, 1, 0 } } {}
+	constexpr LvnMat2x3_t(const T& n)
+		: value{ { n, 0, 0 }, { 0, n, 0 } } {}
+	constexpr LvnMat2x3_t
 	(
 		const T& x0, const T& y0, const T& z0,
 		const T& x1, const T& y1, const T& z1
 	)
-	{
-		this->value[0] = { x0, y0, z0 };
-		this->value[1] = { x1, y1, z1 };
-	}
-	LvnMat2x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1)
+		: value{ { x0, y0, z0 }, { x1, y1, z1 } } {}
+	constexpr LvnMat2x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1)
 		: value{ v0, v1 } {}
-	LvnMat2x3_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0) } {}
-	LvnMat2x3_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
-	LvnMat2x3_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
-	LvnMat2x3_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
-	LvnMat2x3_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
-	LvnMat2x3_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0) } {}
-	LvnMat2x3_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
-	LvnMat2x3_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0) } {}
-	LvnMat2x3_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat2x3_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]) } {}
 
-	LvnVec3_t<T>& operator[](int i)
+	constexpr LvnVec3_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec3_t<T> operator[](int i) const
+	constexpr LvnVec3_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat2x3_t<T> operator+()
+	constexpr LvnMat2x3_t<T> operator+()
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x3_t<T> operator-()
+	constexpr LvnMat2x3_t<T> operator-()
 	{
 		return LvnMat2x3_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x3_t<T> operator+(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x3_t<T> operator+(const LvnMat2x3_t<T>& m)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x3_t<T> operator-(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x3_t<T> operator-(const LvnMat2x3_t<T>& m)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat2x3_t<T> operator*(const T& s)
+	constexpr LvnMat2x3_t<T> operator*(const T& s)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0] * s,
 			this->value[1] * s);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x2_t<T>& m)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3497,7 +4579,7 @@ struct LvnMat2x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x2_t<T>& m)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3510,7 +4592,7 @@ struct LvnMat2x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x2_t<T>& m)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3527,31 +4609,31 @@ struct LvnMat2x3_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y);
 	}
 
-	LvnMat2x3_t<T> operator+() const
+	constexpr LvnMat2x3_t<T> operator+() const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x3_t<T> operator-() const
+	constexpr LvnMat2x3_t<T> operator-() const
 	{
 		return LvnMat2x3_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x3_t<T> operator+(const LvnMat2x3_t<T>& m) const
+	constexpr LvnMat2x3_t<T> operator+(const LvnMat2x3_t<T>& m) const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x3_t<T> operator-(const LvnMat2x3_t<T>& m) const
+	constexpr LvnMat2x3_t<T> operator-(const LvnMat2x3_t<T>& m) const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x2_t<T>& m) const
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x2_t<T>& m) const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3561,7 +4643,7 @@ struct LvnMat2x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x2_t<T>& m) const
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x2_t<T>& m) const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3574,7 +4656,7 @@ struct LvnMat2x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x2_t<T>& m) const
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x2_t<T>& m) const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3593,7 +4675,7 @@ struct LvnMat2x3_t
 };
 
 template<typename T>
-LvnVec3_t<T> operator*(const LvnMat2x3_t<T>& m, const LvnVec2_t<T>& v)
+constexpr LvnVec3_t<T> operator*(const LvnMat2x3_t<T>& m, const LvnVec2_t<T>& v)
 {
 	return LvnVec3_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y,
@@ -3601,7 +4683,7 @@ LvnVec3_t<T> operator*(const LvnMat2x3_t<T>& m, const LvnVec2_t<T>& v)
 		m.value[0].z * v.x + m.value[1].z * v.y);
 }
 template<typename T>
-LvnVec2_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat2x3_t<T>& m)
+constexpr LvnVec2_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat2x3_t<T>& m)
 {
 	return LvnVec2_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z,
@@ -3613,88 +4695,79 @@ struct LvnMat2x4_t
 {
 	LvnVec4_t<T> value[2];
 
-	static int length() { return 2; }
+	static constexpr int length() { return 2; }
 
-	LvnMat2x4_t()
-	{
-		this->value[0] = { 1, 0, 0, 0 };
-		this->value[1] = { 0, 1, 0, 0 };
-	}
-	LvnMat2x4_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0, 0 };
-		this->value[1] = { 0, n, 0, 0 };
-	}
-	LvnMat2x4_t
+	constexpr LvnMat2x4_t()
+		: value{ { 1, 0, 0, 0 }, { 0, 1, 0, 0 } } {}
+	constexpr LvnMat2x4_t(const T& n)
+		: value{ { n, 0, 0, 0 }, { 0, n, 0, 0 } } {}
+	constexpr LvnMat2x4_t
 	(
 		const T& x0, const T& y0, const T& z0, const T& w0,
 		const T& x1, const T& y1, const T& z1, const T& w1
 	)
-	{
-		this->value[0] = { x0, y0, z0, w0 };
-		this->value[1] = { x1, y1, z1, w1 };
-	}
-	LvnMat2x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1)
+		: value{ { x0, y0, z0, w0 }, { x1, y1, z1, w1 } } {}
+	constexpr LvnMat2x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1)
 		: value{ v0, v1 } {}
-	LvnMat2x4_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]) } {}
-	LvnMat2x4_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0) } {}
-	LvnMat2x4_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]) } {}
-	LvnMat2x4_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0) } {}
-	LvnMat2x4_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]) } {}
-	LvnMat2x4_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0) } {}
-	LvnMat2x4_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]) } {}
-	LvnMat2x4_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0) } {}
-	LvnMat2x4_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat2x4_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0) } {}
 
-	LvnVec4_t<T>& operator[](int i)
+	constexpr LvnVec4_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec4_t<T> operator[](int i) const
+	constexpr LvnVec4_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat2x4_t<T> operator+()
+	constexpr LvnMat2x4_t<T> operator+()
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x4_t<T> operator-()
+	constexpr LvnMat2x4_t<T> operator-()
 	{
 		return LvnMat2x4_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x4_t<T> operator+(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x4_t<T> operator+(const LvnMat2x4_t<T>& m)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x4_t<T> operator-(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x4_t<T> operator-(const LvnMat2x4_t<T>& m)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat2x4_t<T> operator*(const T& s)
+	constexpr LvnMat2x4_t<T> operator*(const T& s)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0] * s,
 			this->value[1] * s);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x2_t<T>& m)
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3714,7 +4787,7 @@ struct LvnMat2x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x2_t<T>& m)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3726,7 +4799,7 @@ struct LvnMat2x4_t
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y,
 			this->value[0].w * m.value[1].x + this->value[1].w * m.value[1].y);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x2_t<T>& m)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3743,31 +4816,31 @@ struct LvnMat2x4_t
 			this->value[0].w * m.value[2].x + this->value[1].w * m.value[2].y);
 	}
 
-	LvnMat2x4_t<T> operator+() const
+	constexpr LvnMat2x4_t<T> operator+() const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0],
 			this->value[1]);
 	}
-	LvnMat2x4_t<T> operator-() const
+	constexpr LvnMat2x4_t<T> operator-() const
 	{
 		return LvnMat2x4_t<T>(
 			-this->value[0],
 			-this->value[1]);
 	}
-	LvnMat2x4_t<T> operator+(const LvnMat2x4_t<T>& m) const
+	constexpr LvnMat2x4_t<T> operator+(const LvnMat2x4_t<T>& m) const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1]);
 	}
-	LvnMat2x4_t<T> operator-(const LvnMat2x4_t<T>& m) const
+	constexpr LvnMat2x4_t<T> operator-(const LvnMat2x4_t<T>& m) const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1]);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x2_t<T>& m) const
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x2_t<T>& m) const
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3787,7 +4860,7 @@ struct LvnMat2x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x2_t<T>& m) const
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x2_t<T>& m) const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3799,7 +4872,7 @@ struct LvnMat2x4_t
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y,
 			this->value[0].w * m.value[1].x + this->value[1].w * m.value[1].y);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x2_t<T>& m) const
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x2_t<T>& m) const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y,
@@ -3818,7 +4891,7 @@ struct LvnMat2x4_t
 };
 
 template<typename T>
-LvnVec4_t<T> operator*(const LvnMat2x4_t<T>& m, const LvnVec2_t<T>& v)
+constexpr LvnVec4_t<T> operator*(const LvnMat2x4_t<T>& m, const LvnVec2_t<T>& v)
 {
 	return LvnVec4_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y,
@@ -3827,7 +4900,7 @@ LvnVec4_t<T> operator*(const LvnMat2x4_t<T>& m, const LvnVec2_t<T>& v)
 		m.value[0].w * v.x + m.value[1].w * v.y);
 }
 template<typename T>
-LvnVec2_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat2x4_t<T>& m)
+constexpr LvnVec2_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat2x4_t<T>& m)
 {
 	return LvnVec2_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z + v.w * m.value[0].w,
@@ -3839,97 +4912,85 @@ struct LvnMat3x2_t
 {
 	LvnVec2_t<T> value[3];
 
-	static int length() { return 3; }
+	static constexpr int length() { return 3; }
 
-	LvnMat3x2_t()
-	{
-		this->value[0] = { 1, 0 };
-		this->value[1] = { 0, 1 };
-		this->value[2] = { 0, 0 };
-	}
-	LvnMat3x2_t(const T& n)
-	{
-		this->value[0] = { n, 0 };
-		this->value[1] = { 0, n };
-		this->value[2] = { 0, 0 };
-	}
-	LvnMat3x2_t
+	constexpr LvnMat3x2_t()
+		: value{ { 1, 0 }, { 0, 1 }, { 0, 0 } } {}
+	constexpr LvnMat3x2_t(const T& n)
+		: value{ { n, 0 }, { 0, n }, { 0, 0 } } {}
+	constexpr LvnMat3x2_t
 	(
 		const T& x0, const T& y0,
 		const T& x1, const T& y1,
 		const T& x2, const T& y2
 	)
-	{
-		this->value[0] = { x0, y0 };
-		this->value[1] = { x1, y1 };
-		this->value[2] = { x2, y2 };
-	}
-	LvnMat3x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
+		: value{ { x0, y0 }, { x1, y1 }, { x2, y2 } } {}
+	constexpr LvnMat3x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2)
 		: value{ v0, v1, v2 } {}
-	LvnMat3x2_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat3x2_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
-	LvnMat3x2_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
-	LvnMat3x2_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat3x2_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat3x2_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
-	LvnMat3x2_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
-	LvnMat3x2_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
-	LvnMat3x2_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat3x2_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]) } {}
 
-	LvnVec2_t<T>& operator[](int i)
+	constexpr LvnVec2_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec2_t<T> operator[](int i) const
+	constexpr LvnVec2_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat3x2_t<T> operator+()
+	constexpr LvnMat3x2_t<T> operator+()
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x2_t<T> operator-()
+	constexpr LvnMat3x2_t<T> operator-()
 	{
 		return LvnMat3x2_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x2_t<T> operator+(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x2_t<T> operator+(const LvnMat3x2_t<T>& m)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x2_t<T> operator-(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x2_t<T> operator-(const LvnMat3x2_t<T>& m)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat3x2_t<T> operator*(const T& s)
+	constexpr LvnMat3x2_t<T> operator*(const T& s)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0] * s,
 			this->value[1] * s,
 			this->value[2] * s);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x3_t<T>& m)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3939,7 +5000,7 @@ struct LvnMat3x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y + this->value[2].x * m.value[2].z,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x3_t<T>& m)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3952,35 +5013,35 @@ struct LvnMat3x2_t
 			this->value[0].y * m.value[3].x + this->value[1].y * m.value[3].y + this->value[2].y * m.value[3].z);
 	}
 
-	LvnMat3x2_t<T> operator+() const
+	constexpr LvnMat3x2_t<T> operator+() const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x2_t<T> operator-() const
+	constexpr LvnMat3x2_t<T> operator-() const
 	{
 		return LvnMat3x2_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x2_t<T> operator+(const LvnMat3x2_t<T>& m) const
+	constexpr LvnMat3x2_t<T> operator+(const LvnMat3x2_t<T>& m) const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x2_t<T> operator-(const LvnMat3x2_t<T>& m) const
+	constexpr LvnMat3x2_t<T> operator-(const LvnMat3x2_t<T>& m) const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x3_t<T>& m) const
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x3_t<T>& m) const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -3990,7 +5051,7 @@ struct LvnMat3x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y + this->value[2].x * m.value[2].z,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x3_t<T>& m) const
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x3_t<T>& m) const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -4005,14 +5066,14 @@ struct LvnMat3x2_t
 };
 
 template<typename T>
-LvnVec2_t<T> operator*(const LvnMat3x2_t<T>& m, const LvnVec3_t<T>& v)
+constexpr LvnVec2_t<T> operator*(const LvnMat3x2_t<T>& m, const LvnVec3_t<T>& v)
 {
 	return LvnVec2_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z,
 		m.value[0].y * v.x + m.value[1].y * v.y + m.value[2].y * v.z);
 }
 template<typename T>
-LvnVec3_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat3x2_t<T>& m)
+constexpr LvnVec3_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat3x2_t<T>& m)
 {
 	return LvnVec3_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y,
@@ -4025,97 +5086,85 @@ struct LvnMat3x4_t
 {
 	LvnVec4_t<T> value[3];
 
-	static int length() { return 3; }
+	static constexpr int length() { return 3; }
 
-	LvnMat3x4_t()
-	{
-		this->value[0] = { 1, 0, 0, 0 };
-		this->value[1] = { 0, 1, 0, 0 };
-		this->value[2] = { 0, 0, 1, 0 };
-	}
-	LvnMat3x4_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0, 0 };
-		this->value[1] = { 0, n, 0, 0 };
-		this->value[2] = { 0, 0, n, 0 };
-	}
-	LvnMat3x4_t
+	constexpr LvnMat3x4_t()
+		: value{ { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 } } {}
+	constexpr LvnMat3x4_t(const T& n)
+		: value{ { n, 0, 0, 0 }, { 0, n, 0, 0 }, { 0, 0, n, 0 } } {}
+	constexpr LvnMat3x4_t
 	(
 		const T& x0, const T& y0, const T& z0,
 		const T& x1, const T& y1, const T& z1,
 		const T& x2, const T& y2, const T& z2
 	)
-	{
-		this->value[0] = { x0, y0, z0 };
-		this->value[1] = { x1, y1, z1 };
-		this->value[2] = { x2, y2, z2 };
-	}
-	LvnMat3x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
+		: value{ { x0, y0, z0 }, { x1, y1, z1 }, { x2, y2, z2 } } {}
+	constexpr LvnMat3x4_t(const LvnVec4_t<T>& v0, const LvnVec4_t<T>& v1, const LvnVec4_t<T>& v2)
 		: value{ v0, v1, v2 } {}
-	LvnMat3x4_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(0, 0, 1, 0) } {}
-	LvnMat3x4_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(m.value[2], 0) } {}
-	LvnMat3x4_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(m.value[2]) } {}
-	LvnMat3x4_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(0, 0, 1, 0) } {}
-	LvnMat3x4_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(0, 0, 1, 0) } {}
-	LvnMat3x4_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(m.value[2], 1, 0) } {}
-	LvnMat3x4_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0]), LvnVec4_t<T>(m.value[1]), LvnVec4_t<T>(m.value[2]) } {}
-	LvnMat3x4_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0, 0), LvnVec4_t<T>(m.value[1], 0, 0), LvnVec4_t<T>(m.value[2], 1, 0) } {}
-	LvnMat3x4_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat3x4_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec4_t<T>(m.value[0], 0), LvnVec4_t<T>(m.value[1], 0), LvnVec4_t<T>(m.value[2], 0) } {}
 
-	LvnVec4_t<T>& operator[](int i)
+	constexpr LvnVec4_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec4_t<T> operator[](int i) const
+	constexpr LvnVec4_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat3x4_t<T> operator+()
+	constexpr LvnMat3x4_t<T> operator+()
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x4_t<T> operator-()
+	constexpr LvnMat3x4_t<T> operator-()
 	{
 		return LvnMat3x4_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x4_t<T> operator+(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x4_t<T> operator+(const LvnMat3x4_t<T>& m)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x4_t<T> operator-(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x4_t<T> operator-(const LvnMat3x4_t<T>& m)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat3x4_t<T> operator*(const T& s)
+	constexpr LvnMat3x4_t<T> operator*(const T& s)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0] * s,
 			this->value[1] * s,
 			this->value[2] * s);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x3_t<T>& m)
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -4135,7 +5184,7 @@ struct LvnMat3x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y + this->value[2].w * m.value[3].z);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x3_t<T>& m)
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].x + this->value[2].x * m.value[0].x,
@@ -4147,7 +5196,7 @@ struct LvnMat3x4_t
 			this->value[0].z * m.value[1].z + this->value[1].z * m.value[1].z + this->value[2].z * m.value[1].z,
 			this->value[0].w * m.value[1].w + this->value[1].w * m.value[1].w + this->value[2].w * m.value[1].w);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x3_t<T>& m)
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -4164,35 +5213,35 @@ struct LvnMat3x4_t
 			this->value[0].w * m.value[2].x + this->value[1].w * m.value[2].y + this->value[2].w * m.value[2].z);
 	}
 
-	LvnMat3x4_t<T> operator+() const
+	constexpr LvnMat3x4_t<T> operator+() const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0],
 			this->value[1],
 			this->value[2]);
 	}
-	LvnMat3x4_t<T> operator-() const
+	constexpr LvnMat3x4_t<T> operator-() const
 	{
 		return LvnMat3x4_t<T>(
 			-this->value[0],
 			-this->value[1],
 			-this->value[2]);
 	}
-	LvnMat3x4_t<T> operator+(const LvnMat3x4_t<T>& m) const
+	constexpr LvnMat3x4_t<T> operator+(const LvnMat3x4_t<T>& m) const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0] + m.value[0],
 			this->value[1] + m.value[1],
 			this->value[2] + m.value[2]);
 	}
-	LvnMat3x4_t<T> operator-(const LvnMat3x4_t<T>& m) const
+	constexpr LvnMat3x4_t<T> operator-(const LvnMat3x4_t<T>& m) const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0] - m.value[0],
 			this->value[1] - m.value[1],
 			this->value[2] - m.value[2]);
 	}
-	LvnMat4x4_t<T> operator*(const LvnMat4x3_t<T>& m) const
+	constexpr LvnMat4x4_t<T> operator*(const LvnMat4x3_t<T>& m) const
 	{
 		return LvnMat4x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -4212,7 +5261,7 @@ struct LvnMat3x4_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z,
 			this->value[0].w * m.value[3].x + this->value[1].w * m.value[3].y + this->value[2].w * m.value[3].z);
 	}
-	LvnMat2x4_t<T> operator*(const LvnMat2x3_t<T>& m) const
+	constexpr LvnMat2x4_t<T> operator*(const LvnMat2x3_t<T>& m) const
 	{
 		return LvnMat2x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].x + this->value[2].x * m.value[0].x,
@@ -4224,7 +5273,7 @@ struct LvnMat3x4_t
 			this->value[0].z * m.value[1].z + this->value[1].z * m.value[1].z + this->value[2].z * m.value[1].z,
 			this->value[0].w * m.value[1].w + this->value[1].w * m.value[1].w + this->value[2].w * m.value[1].w);
 	}
-	LvnMat3x4_t<T> operator*(const LvnMat3x3_t<T>& m) const
+	constexpr LvnMat3x4_t<T> operator*(const LvnMat3x3_t<T>& m) const
 	{
 		return LvnMat3x4_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z,
@@ -4243,7 +5292,7 @@ struct LvnMat3x4_t
 };
 
 template<typename T>
-LvnVec4_t<T> operator*(const LvnMat3x4_t<T>& m, const LvnVec3_t<T>& v)
+constexpr LvnVec4_t<T> operator*(const LvnMat3x4_t<T>& m, const LvnVec3_t<T>& v)
 {
 	return LvnVec4_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z,
@@ -4252,7 +5301,7 @@ LvnVec4_t<T> operator*(const LvnMat3x4_t<T>& m, const LvnVec3_t<T>& v)
 		m.value[0].w * v.x + m.value[1].w * v.y + m.value[2].w * v.z);
 }
 template<typename T>
-LvnVec3_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat3x4_t<T>& m)
+constexpr LvnVec3_t<T> operator*(const LvnVec4_t<T>& v, const LvnMat3x4_t<T>& m)
 {
 	return LvnVec3_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z + v.w * m.value[0].w,
@@ -4265,66 +5314,51 @@ struct LvnMat4x2_t
 {
 	LvnVec2_t<T> value[4];
 
-	static int length() { return 4; }
+	static constexpr int length() { return 4; }
 
-	LvnMat4x2_t()
-	{
-		this->value[0] = { 1, 0 };
-		this->value[1] = { 0, 1 };
-		this->value[2] = { 0, 0 };
-		this->value[3] = { 0, 0 };
-	}
-	LvnMat4x2_t(const T& n)
-	{
-		this->value[0] = { n, 0 };
-		this->value[1] = { 0, n };
-		this->value[2] = { 0, 0 };
-		this->value[3] = { 0, 0 };
-	}
-	LvnMat4x2_t
+	constexpr LvnMat4x2_t()
+		: value{ { 1, 0 }, { 0, 1 }, { 0, 0 }, { 0, 0 } } {}
+	constexpr LvnMat4x2_t(const T& n)
+		: value{ { n, 0 }, { 0, n }, { 0, 0 }, { 0, 0 } } {}
+	constexpr LvnMat4x2_t
 	(
 		const T& x0, const T& y0,
 		const T& x1, const T& y1,
 		const T& x2, const T& y2,
 		const T& x3, const T& y3
 	)
-	{
-		this->value[0] = { x0, y0 };
-		this->value[1] = { x1, y1 };
-		this->value[2] = { x2, y2 };
-		this->value[3] = { x3, y3 };
-	}
-	LvnMat4x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2, const LvnVec2_t<T>& v3)
+		: value{ { x0, y0 }, { x1, y1 }, { x2, y2 }, { x3, y3 } } {}
+	constexpr LvnMat4x2_t(const LvnVec2_t<T>& v0, const LvnVec2_t<T>& v1, const LvnVec2_t<T>& v2, const LvnVec2_t<T>& v3)
 		: value{ v0, v1, v2, v3 } {}
-	LvnMat4x2_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(m.value[3]) } {}
-	LvnMat4x2_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(0, 0), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(0, 0) } {}
-	LvnMat4x2_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(m.value[3]) } {}
-	LvnMat4x2_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x2_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec2_t<T>(m.value[0]), LvnVec2_t<T>(m.value[1]), LvnVec2_t<T>(m.value[2]), LvnVec2_t<T>(m.value[3]) } {}
 
-	LvnVec2_t<T>& operator[](int i)
+	constexpr LvnVec2_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec2_t<T> operator[](int i) const
+	constexpr LvnVec2_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat4x2_t<T> operator+()
+	constexpr LvnMat4x2_t<T> operator+()
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0],
@@ -4332,7 +5366,7 @@ struct LvnMat4x2_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x2_t<T> operator-()
+	constexpr LvnMat4x2_t<T> operator-()
 	{
 		return LvnMat4x2_t<T>(
 			-this->value[0],
@@ -4340,7 +5374,7 @@ struct LvnMat4x2_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x2_t<T> operator+(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x2_t<T> operator+(const LvnMat4x2_t<T>& m)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0] + m.value[0],
@@ -4348,7 +5382,7 @@ struct LvnMat4x2_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x2_t<T> operator-(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x2_t<T> operator-(const LvnMat4x2_t<T>& m)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0] - m.value[0],
@@ -4356,7 +5390,7 @@ struct LvnMat4x2_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat4x2_t<T> operator*(const T& s)
+	constexpr LvnMat4x2_t<T> operator*(const T& s)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0] * s,
@@ -4364,7 +5398,7 @@ struct LvnMat4x2_t
 			this->value[2] * s,
 			this->value[3] * s);
 	}
-	LvnMat2x2_t<T> operator*(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x2_t<T> operator*(const LvnMat2x4_t<T>& m)
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4372,7 +5406,7 @@ struct LvnMat4x2_t
 			this->value[0].x * m.value[1].x + this->value[1].x * m.value[1].y + this->value[2].x * m.value[1].z + this->value[3].x * m.value[1].w,
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z + this->value[3].y * m.value[1].w);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x4_t<T>& m)
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4382,7 +5416,7 @@ struct LvnMat4x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y + this->value[2].x * m.value[2].z + this->value[3].x * m.value[2].w,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z + this->value[3].y * m.value[2].w);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x4_t<T>& m)
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4395,7 +5429,7 @@ struct LvnMat4x2_t
 			this->value[0].y * m.value[3].x + this->value[1].y * m.value[3].y + this->value[2].y * m.value[3].z + this->value[3].y * m.value[3].w);
 	}
 
-	LvnMat4x2_t<T> operator+() const
+	constexpr LvnMat4x2_t<T> operator+() const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0],
@@ -4403,7 +5437,7 @@ struct LvnMat4x2_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x2_t<T> operator-() const
+	constexpr LvnMat4x2_t<T> operator-() const
 	{
 		return LvnMat4x2_t<T>(
 			-this->value[0],
@@ -4411,7 +5445,7 @@ struct LvnMat4x2_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x2_t<T> operator+(const LvnMat4x2_t<T>& m) const
+	constexpr LvnMat4x2_t<T> operator+(const LvnMat4x2_t<T>& m) const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0] + m.value[0],
@@ -4419,7 +5453,7 @@ struct LvnMat4x2_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x2_t<T> operator-(const LvnMat4x2_t<T>& m) const
+	constexpr LvnMat4x2_t<T> operator-(const LvnMat4x2_t<T>& m) const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0] - m.value[0],
@@ -4427,7 +5461,7 @@ struct LvnMat4x2_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat2x2_t<T> operator*(const LvnMat2x4_t<T>& m) const
+	constexpr LvnMat2x2_t<T> operator*(const LvnMat2x4_t<T>& m) const
 	{
 		return LvnMat2x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4435,7 +5469,7 @@ struct LvnMat4x2_t
 			this->value[0].x * m.value[1].x + this->value[1].x * m.value[1].y + this->value[2].x * m.value[1].z + this->value[3].x * m.value[1].w,
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z + this->value[3].y * m.value[1].w);
 	}
-	LvnMat3x2_t<T> operator*(const LvnMat3x4_t<T>& m) const
+	constexpr LvnMat3x2_t<T> operator*(const LvnMat3x4_t<T>& m) const
 	{
 		return LvnMat3x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4445,7 +5479,7 @@ struct LvnMat4x2_t
 			this->value[0].x * m.value[2].x + this->value[1].x * m.value[2].y + this->value[2].x * m.value[2].z + this->value[3].x * m.value[2].w,
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z + this->value[3].y * m.value[2].w);
 	}
-	LvnMat4x2_t<T> operator*(const LvnMat4x4_t<T>& m) const
+	constexpr LvnMat4x2_t<T> operator*(const LvnMat4x4_t<T>& m) const
 	{
 		return LvnMat4x2_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4460,14 +5494,14 @@ struct LvnMat4x2_t
 };
 
 template<typename T>
-LvnVec2_t<T> operator*(const LvnMat4x2_t<T>& m, const LvnVec4_t<T>& v)
+constexpr LvnVec2_t<T> operator*(const LvnMat4x2_t<T>& m, const LvnVec4_t<T>& v)
 {
 	return LvnVec2_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z + m.value[3].x * v.w,
 		m.value[0].y * v.x + m.value[1].y * v.y + m.value[2].y * v.z + m.value[3].y * v.w);
 }
 template<typename T>
-LvnVec4_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat4x2_t<T>& m)
+constexpr LvnVec4_t<T> operator*(const LvnVec2_t<T>& v, const LvnMat4x2_t<T>& m)
 {
 	return LvnVec4_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y,
@@ -4481,66 +5515,51 @@ struct LvnMat4x3_t
 {
 	LvnVec3_t<T> value[4];
 
-	static int length() { return 4; }
+	static constexpr int length() { return 4; }
 
-	LvnMat4x3_t()
-	{
-		this->value[0] = { 1, 0, 0 };
-		this->value[1] = { 0, 1, 0 };
-		this->value[2] = { 0, 0, 1 };
-		this->value[3] = { 0, 0, 0 };
-	}
-	LvnMat4x3_t(const T& n)
-	{
-		this->value[0] = { n, 0, 0 };
-		this->value[1] = { 0, n, 0 };
-		this->value[2] = { 0, 0, n };
-		this->value[3] = { 0, 0, 0 };
-	}
-	LvnMat4x3_t
+	constexpr LvnMat4x3_t()
+		: value{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 }, { 0, 0, 0 } } {}
+	constexpr LvnMat4x3_t(const T& n)
+		: value{ { n, 0, 0 }, { 0, n, 0 }, { 0, 0, n }, { 0, 0, 0 } } {}
+	constexpr LvnMat4x3_t
 	(
 		const T& x0, const T& y0, const T& z0,
 		const T& x1, const T& y1, const T& z1,
 		const T& x2, const T& y2, const T& z2,
 		const T& x3, const T& y3, const T& z3
 	)
-	{
-		this->value[0] = { x0, y0, z0 };
-		this->value[1] = { x1, y1, z1 };
-		this->value[2] = { x2, y2, z2 };
-		this->value[3] = { x3, y3, z3 };
-	}
-	LvnMat4x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2, const LvnVec3_t<T>& v3)
+		: value{ { x0, y0, z0 }, { x1, y1, z1 }, { x2, y2, z2 }, { x3, y3, z3 } } {}
+	constexpr LvnMat4x3_t(const LvnVec3_t<T>& v0, const LvnVec3_t<T>& v1, const LvnVec3_t<T>& v2, const LvnVec3_t<T>& v3)
 		: value{ v0, v1, v2, v3 } {}
-	LvnMat4x3_t(const LvnMat2x2_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat2x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(0, 0, 1), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat3x3_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat3x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat4x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]), LvnVec3_t<T>(m.value[3]) } {}
-	LvnMat4x3_t(const LvnMat2x3_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat2x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(0, 0, 1), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat2x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(0, 0, 1), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat3x2_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat3x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(m.value[2], 1), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat3x4_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]), LvnVec3_t<T>(0, 0, 0) } {}
-	LvnMat4x3_t(const LvnMat4x2_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat4x2_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0], 0), LvnVec3_t<T>(m.value[1], 0), LvnVec3_t<T>(m.value[2], 1), LvnVec3_t<T>(m.value[3], 0) } {}
-	LvnMat4x3_t(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x3_t(const LvnMat4x3_t<T>& m)
 		: value{ LvnVec3_t<T>(m.value[0]), LvnVec3_t<T>(m.value[1]), LvnVec3_t<T>(m.value[2]), LvnVec3_t<T>(m.value[3]) } {}
 
-	LvnVec3_t<T>& operator[](int i)
+	constexpr LvnVec3_t<T>& operator[](int i)
 	{
 		return this->value[i];
 	}
-	LvnVec3_t<T> operator[](int i) const
+	constexpr LvnVec3_t<T> operator[](int i) const
 	{
 		return this->value[i];
 	}
 
-	LvnMat4x3_t<T> operator+()
+	constexpr LvnMat4x3_t<T> operator+()
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0],
@@ -4548,7 +5567,7 @@ struct LvnMat4x3_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x3_t<T> operator-()
+	constexpr LvnMat4x3_t<T> operator-()
 	{
 		return LvnMat4x3_t<T>(
 			-this->value[0],
@@ -4556,7 +5575,7 @@ struct LvnMat4x3_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x3_t<T> operator+(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x3_t<T> operator+(const LvnMat4x3_t<T>& m)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0] + m.value[0],
@@ -4564,7 +5583,7 @@ struct LvnMat4x3_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x3_t<T> operator-(const LvnMat4x3_t<T>& m)
+	constexpr LvnMat4x3_t<T> operator-(const LvnMat4x3_t<T>& m)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0] - m.value[0],
@@ -4572,7 +5591,7 @@ struct LvnMat4x3_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat4x3_t<T> operator*(const T& s)
+	constexpr LvnMat4x3_t<T> operator*(const T& s)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0] * s,
@@ -4580,7 +5599,7 @@ struct LvnMat4x3_t
 			this->value[2] * s,
 			this->value[3] * s);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x4_t<T>& m)
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x4_t<T>& m)
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4590,7 +5609,7 @@ struct LvnMat4x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z + this->value[3].y * m.value[1].w,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z + this->value[3].z * m.value[1].w);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x4_t<T>& m)
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x4_t<T>& m)
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4603,7 +5622,7 @@ struct LvnMat4x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z + this->value[3].y * m.value[2].w,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y + this->value[2].z * m.value[2].z + this->value[3].z * m.value[2].w);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x4_t<T>& m)
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x4_t<T>& m)
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4620,7 +5639,7 @@ struct LvnMat4x3_t
 			this->value[0].z * m.value[3].x + this->value[1].z * m.value[3].y + this->value[2].z * m.value[3].z + this->value[3].z * m.value[3].w);
 	}
 
-	LvnMat4x3_t<T> operator+() const
+	constexpr LvnMat4x3_t<T> operator+() const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0],
@@ -4628,7 +5647,7 @@ struct LvnMat4x3_t
 			this->value[2],
 			this->value[3]);
 	}
-	LvnMat4x3_t<T> operator-() const
+	constexpr LvnMat4x3_t<T> operator-() const
 	{
 		return LvnMat4x3_t<T>(
 			-this->value[0],
@@ -4636,7 +5655,7 @@ struct LvnMat4x3_t
 			-this->value[2],
 			-this->value[3]);
 	}
-	LvnMat4x3_t<T> operator+(const LvnMat4x3_t<T>& m) const
+	constexpr LvnMat4x3_t<T> operator+(const LvnMat4x3_t<T>& m) const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0] + m.value[0],
@@ -4644,7 +5663,7 @@ struct LvnMat4x3_t
 			this->value[2] + m.value[2],
 			this->value[3] + m.value[3]);
 	}
-	LvnMat4x3_t<T> operator-(const LvnMat4x3_t<T>& m) const
+	constexpr LvnMat4x3_t<T> operator-(const LvnMat4x3_t<T>& m) const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0] - m.value[0],
@@ -4652,7 +5671,7 @@ struct LvnMat4x3_t
 			this->value[2] - m.value[2],
 			this->value[3] - m.value[3]);
 	}
-	LvnMat2x3_t<T> operator*(const LvnMat2x4_t<T>& m) const
+	constexpr LvnMat2x3_t<T> operator*(const LvnMat2x4_t<T>& m) const
 	{
 		return LvnMat2x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4662,7 +5681,7 @@ struct LvnMat4x3_t
 			this->value[0].y * m.value[1].x + this->value[1].y * m.value[1].y + this->value[2].y * m.value[1].z + this->value[3].y * m.value[1].w,
 			this->value[0].z * m.value[1].x + this->value[1].z * m.value[1].y + this->value[2].z * m.value[1].z + this->value[3].z * m.value[1].w);
 	}
-	LvnMat3x3_t<T> operator*(const LvnMat3x4_t<T>& m) const
+	constexpr LvnMat3x3_t<T> operator*(const LvnMat3x4_t<T>& m) const
 	{
 		return LvnMat3x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4675,7 +5694,7 @@ struct LvnMat4x3_t
 			this->value[0].y * m.value[2].x + this->value[1].y * m.value[2].y + this->value[2].y * m.value[2].z + this->value[3].y * m.value[2].w,
 			this->value[0].z * m.value[2].x + this->value[1].z * m.value[2].y + this->value[2].z * m.value[2].z + this->value[3].z * m.value[2].w);
 	}
-	LvnMat4x3_t<T> operator*(const LvnMat4x4_t<T>& m) const
+	constexpr LvnMat4x3_t<T> operator*(const LvnMat4x4_t<T>& m) const
 	{
 		return LvnMat4x3_t<T>(
 			this->value[0].x * m.value[0].x + this->value[1].x * m.value[0].y + this->value[2].x * m.value[0].z + this->value[3].x * m.value[0].w,
@@ -4694,7 +5713,7 @@ struct LvnMat4x3_t
 };
 
 template<typename T>
-LvnVec3_t<T> operator*(const LvnMat4x3_t<T>& m, const LvnVec4_t<T>& v)
+constexpr LvnVec3_t<T> operator*(const LvnMat4x3_t<T>& m, const LvnVec4_t<T>& v)
 {
 	return LvnVec3_t<T>(
 		m.value[0].x * v.x + m.value[1].x * v.y + m.value[2].x * v.z + m.value[3].x * v.w,
@@ -4702,7 +5721,7 @@ LvnVec3_t<T> operator*(const LvnMat4x3_t<T>& m, const LvnVec4_t<T>& v)
 		m.value[0].z * v.x + m.value[1].z * v.y + m.value[2].z * v.z + m.value[3].z * v.w);
 }
 template<typename T>
-LvnVec4_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat4x3_t<T>& m)
+constexpr LvnVec4_t<T> operator*(const LvnVec3_t<T>& v, const LvnMat4x3_t<T>& m)
 {
 	return LvnVec4_t<T>(
 		v.x * m.value[0].x + v.y * m.value[0].y + v.z * m.value[0].z,
@@ -4720,14 +5739,30 @@ struct LvnQuat_t
 		struct { T r, i, j, k; };
 	};
 
-	LvnQuat_t()
+	constexpr LvnQuat_t()
 		: w(0), x(0), y(0), z(0) {}
 
-	LvnQuat_t(const T& nw, const T& nx, const T& ny, const T& nz)
+	constexpr LvnQuat_t(const T& nw, const T& nx, const T& ny, const T& nz)
 		: w(nw), x(nx), y(ny), z(nz) {}
 
 
-	T& operator[](int i)
+	constexpr T& operator[](int i)
+	{
+		switch (i)
+		{
+		default:
+		case 0:
+			return w;
+		case 1:
+			return x;
+		case 2:
+			return y;
+		case 3:
+			return z;
+		}
+	}
+
+	constexpr const T& operator[](int i) const
 	{
 		switch (i)
 		{
@@ -4744,6 +5779,248 @@ struct LvnQuat_t
 	}
 };
 
+namespace lvn
+{
+	LVN_API constexpr LvnVec3f cross(LvnVec3f v1, LvnVec3f v2) { return lvn::cross<float>(v1, v2); }
+	LVN_API constexpr LvnVec3d cross(LvnVec3d v1, LvnVec3d v2) { return lvn::cross<double>(v1, v2); }
+}
+
+// float 4x4 matrix simd functions, each column of four floats is loaded into one register
+// the generic templates call these at runtime and use their scalar code in constant expressions or when no simd instruction set is available
+#if defined(LVN_MATH_SIMD_SSE) || defined(LVN_MATH_SIMD_NEON)
+
+namespace lvn
+{
+#if defined(LVN_MATH_SIMD_SSE)
+	typedef __m128 LvnSimdF32x4;
+
+	inline LvnSimdF32x4 simdLoad(const LvnVec4_t<float>& v) { return _mm_loadu_ps(&v.x); }
+	inline void simdStore(LvnVec4_t<float>& v, LvnSimdF32x4 s) { _mm_storeu_ps(&v.x, s); }
+	inline LvnSimdF32x4 simdSplat(float n) { return _mm_set1_ps(n); }
+	inline LvnSimdF32x4 simdSet(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+	inline LvnSimdF32x4 simdAdd(LvnSimdF32x4 a, LvnSimdF32x4 b) { return _mm_add_ps(a, b); }
+	inline LvnSimdF32x4 simdSub(LvnSimdF32x4 a, LvnSimdF32x4 b) { return _mm_sub_ps(a, b); }
+	inline LvnSimdF32x4 simdMul(LvnSimdF32x4 a, LvnSimdF32x4 b) { return _mm_mul_ps(a, b); }
+	inline LvnSimdF32x4 simdMulAdd(LvnSimdF32x4 a, LvnSimdF32x4 b, LvnSimdF32x4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+	template <int L>
+	inline LvnSimdF32x4 simdLane(LvnSimdF32x4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(L, L, L, L)); }
+	inline float simdHorizontalAdd(LvnSimdF32x4 v)
+	{
+		LvnSimdF32x4 sum = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		return _mm_cvtss_f32(sum);
+	}
+
+	// (m2p, m2p, m1p, m1p) * (m3q, m3q, m3q, m2q) - (m3p, m3p, m3p, m2p) * (m2q, m2q, m1q, m1q), matches the fac vectors of the generic inverse
+	template <int P, int Q>
+	inline LvnSimdF32x4 simdInverseFactor(LvnSimdF32x4 c1, LvnSimdF32x4 c2, LvnSimdF32x4 c3)
+	{
+		LvnSimdF32x4 q32 = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(Q, Q, Q, Q));
+		LvnSimdF32x4 p32 = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(P, P, P, P));
+		LvnSimdF32x4 p21 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(P, P, P, P));
+		LvnSimdF32x4 q21 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(Q, Q, Q, Q));
+		LvnSimdF32x4 q3332 = _mm_shuffle_ps(q32, q32, _MM_SHUFFLE(2, 0, 0, 0));
+		LvnSimdF32x4 p3332 = _mm_shuffle_ps(p32, p32, _MM_SHUFFLE(2, 0, 0, 0));
+		return _mm_sub_ps(_mm_mul_ps(p21, q3332), _mm_mul_ps(p3332, q21));
+	}
+
+	// (m1c, m0c, m0c, m0c)
+	template <int C>
+	inline LvnSimdF32x4 simdInverseVec(LvnSimdF32x4 c0, LvnSimdF32x4 c1)
+	{
+		LvnSimdF32x4 v = _mm_shuffle_ps(c1, c0, _MM_SHUFFLE(C, C, C, C));
+		return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 0));
+	}
+
+	inline LvnSimdF32x4 simdFirstLanes(LvnSimdF32x4 a, LvnSimdF32x4 b, LvnSimdF32x4 c, LvnSimdF32x4 d)
+	{
+		return _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(c, d, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	inline void simdTranspose(LvnSimdF32x4& c0, LvnSimdF32x4& c1, LvnSimdF32x4& c2, LvnSimdF32x4& c3) { _MM_TRANSPOSE4_PS(c0, c1, c2, c3); }
+
+#elif defined(LVN_MATH_SIMD_NEON)
+	typedef float32x4_t LvnSimdF32x4;
+
+	inline LvnSimdF32x4 simdLoad(const LvnVec4_t<float>& v) { return vld1q_f32(&v.x); }
+	inline void simdStore(LvnVec4_t<float>& v, LvnSimdF32x4 s) { vst1q_f32(&v.x, s); }
+	inline LvnSimdF32x4 simdSplat(float n) { return vdupq_n_f32(n); }
+	inline LvnSimdF32x4 simdSet(float x, float y, float z, float w) { const float v[4] = { x, y, z, w }; return vld1q_f32(v); }
+	inline LvnSimdF32x4 simdAdd(LvnSimdF32x4 a, LvnSimdF32x4 b) { return vaddq_f32(a, b); }
+	inline LvnSimdF32x4 simdSub(LvnSimdF32x4 a, LvnSimdF32x4 b) { return vsubq_f32(a, b); }
+	inline LvnSimdF32x4 simdMul(LvnSimdF32x4 a, LvnSimdF32x4 b) { return vmulq_f32(a, b); }
+	inline LvnSimdF32x4 simdMulAdd(LvnSimdF32x4 a, LvnSimdF32x4 b, LvnSimdF32x4 c) { return vmlaq_f32(c, a, b); }
+	template <int L>
+	inline LvnSimdF32x4 simdLane(LvnSimdF32x4 v) { return vdupq_n_f32(vgetq_lane_f32(v, L)); }
+	inline float simdHorizontalAdd(LvnSimdF32x4 v)
+	{
+		float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+		return vget_lane_f32(vpadd_f32(sum, sum), 0);
+	}
+
+	// neon has no general shuffle, the vectors are built from lanes
+	template <int P, int Q>
+	inline LvnSimdF32x4 simdInverseFactor(LvnSimdF32x4 c1, LvnSimdF32x4 c2, LvnSimdF32x4 c3)
+	{
+		float m1p = vgetq_lane_f32(c1, P), m2p = vgetq_lane_f32(c2, P), m3p = vgetq_lane_f32(c3, P);
+		float m1q = vgetq_lane_f32(c1, Q), m2q = vgetq_lane_f32(c2, Q), m3q = vgetq_lane_f32(c3, Q);
+		return vsubq_f32(
+			vmulq_f32(lvn::simdSet(m2p, m2p, m1p, m1p), lvn::simdSet(m3q, m3q, m3q, m2q)),
+			vmulq_f32(lvn::simdSet(m3p, m3p, m3p, m2p), lvn::simdSet(m2q, m2q, m1q, m1q)));
+	}
+
+	template <int C>
+	inline LvnSimdF32x4 simdInverseVec(LvnSimdF32x4 c0, LvnSimdF32x4 c1)
+	{
+		float m0c = vgetq_lane_f32(c0, C);
+		return vsetq_lane_f32(vgetq_lane_f32(c1, C), vdupq_n_f32(m0c), 0);
+	}
+
+	inline LvnSimdF32x4 simdFirstLanes(LvnSimdF32x4 a, LvnSimdF32x4 b, LvnSimdF32x4 c, LvnSimdF32x4 d)
+	{
+		return lvn::simdSet(vgetq_lane_f32(a, 0), vgetq_lane_f32(b, 0), vgetq_lane_f32(c, 0), vgetq_lane_f32(d, 0));
+	}
+
+	inline void simdTranspose(LvnSimdF32x4& c0, LvnSimdF32x4& c1, LvnSimdF32x4& c2, LvnSimdF32x4& c3)
+	{
+		float32x4x2_t t01 = vtrnq_f32(c0, c1);
+		float32x4x2_t t23 = vtrnq_f32(c2, c3);
+		c0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+		c1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+		c2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		c3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+#endif
+
+	inline LvnSimdF32x4 simdMat4MulVec(LvnSimdF32x4 c0, LvnSimdF32x4 c1, LvnSimdF32x4 c2, LvnSimdF32x4 c3, LvnSimdF32x4 v)
+	{
+		LvnSimdF32x4 r = lvn::simdMul(c0, lvn::simdLane<0>(v));
+		r = lvn::simdMulAdd(c1, lvn::simdLane<1>(v), r);
+		r = lvn::simdMulAdd(c2, lvn::simdLane<2>(v), r);
+		return lvn::simdMulAdd(c3, lvn::simdLane<3>(v), r);
+	}
+
+	inline LvnMat4x4_t<float> simdMat4Multiply(const LvnMat4x4_t<float>& a, const LvnMat4x4_t<float>& b)
+	{
+		LvnMat4x4_t<float> result;
+
+#if defined(LVN_MATH_SIMD_AVX)
+		// two columns of b at a time, each 128 bit lane holds one column
+		const __m128 a0 = _mm_loadu_ps(&a.value[0].x), a1 = _mm_loadu_ps(&a.value[1].x), a2 = _mm_loadu_ps(&a.value[2].x), a3 = _mm_loadu_ps(&a.value[3].x);
+		const __m256 aa0 = _mm256_insertf128_ps(_mm256_castps128_ps256(a0), a0, 1);
+		const __m256 aa1 = _mm256_insertf128_ps(_mm256_castps128_ps256(a1), a1, 1);
+		const __m256 aa2 = _mm256_insertf128_ps(_mm256_castps128_ps256(a2), a2, 1);
+		const __m256 aa3 = _mm256_insertf128_ps(_mm256_castps128_ps256(a3), a3, 1);
+
+		for (int i = 0; i < 4; i += 2)
+		{
+			__m256 bb = _mm256_loadu_ps(&b.value[i].x);
+			__m256 r = _mm256_mul_ps(aa0, _mm256_permute_ps(bb, 0x00));
+			r = _mm256_add_ps(r, _mm256_mul_ps(aa1, _mm256_permute_ps(bb, 0x55)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(aa2, _mm256_permute_ps(bb, 0xAA)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(aa3, _mm256_permute_ps(bb, 0xFF)));
+			_mm256_storeu_ps(&result.value[i].x, r);
+		}
+#else
+		const LvnSimdF32x4 a0 = lvn::simdLoad(a.value[0]), a1 = lvn::simdLoad(a.value[1]), a2 = lvn::simdLoad(a.value[2]), a3 = lvn::simdLoad(a.value[3]);
+
+		for (int i = 0; i < 4; i++)
+			lvn::simdStore(result.value[i], lvn::simdMat4MulVec(a0, a1, a2, a3, lvn::simdLoad(b.value[i])));
+#endif
+
+		return result;
+	}
+
+	inline LvnVec4_t<float> simdMat4MultiplyVec(const LvnMat4x4_t<float>& m, const LvnVec4_t<float>& v)
+	{
+		LvnVec4_t<float> result;
+		lvn::simdStore(result, lvn::simdMat4MulVec(lvn::simdLoad(m.value[0]), lvn::simdLoad(m.value[1]), lvn::simdLoad(m.value[2]), lvn::simdLoad(m.value[3]), lvn::simdLoad(v)));
+		return result;
+	}
+
+	inline LvnMat4x4_t<float> simdMat4Inverse(const LvnMat4x4_t<float>& m)
+	{
+		const LvnSimdF32x4 c0 = lvn::simdLoad(m.value[0]), c1 = lvn::simdLoad(m.value[1]), c2 = lvn::simdLoad(m.value[2]), c3 = lvn::simdLoad(m.value[3]);
+
+		const LvnSimdF32x4 fac0 = lvn::simdInverseFactor<2, 3>(c1, c2, c3);
+		const LvnSimdF32x4 fac1 = lvn::simdInverseFactor<1, 3>(c1, c2, c3);
+		const LvnSimdF32x4 fac2 = lvn::simdInverseFactor<1, 2>(c1, c2, c3);
+		const LvnSimdF32x4 fac3 = lvn::simdInverseFactor<0, 3>(c1, c2, c3);
+		const LvnSimdF32x4 fac4 = lvn::simdInverseFactor<0, 2>(c1, c2, c3);
+		const LvnSimdF32x4 fac5 = lvn::simdInverseFactor<0, 1>(c1, c2, c3);
+
+		const LvnSimdF32x4 vec0 = lvn::simdInverseVec<0>(c0, c1);
+		const LvnSimdF32x4 vec1 = lvn::simdInverseVec<1>(c0, c1);
+		const LvnSimdF32x4 vec2 = lvn::simdInverseVec<2>(c0, c1);
+		const LvnSimdF32x4 vec3 = lvn::simdInverseVec<3>(c0, c1);
+
+		const LvnSimdF32x4 signA = lvn::simdSet(+1.0f, -1.0f, +1.0f, -1.0f);
+		const LvnSimdF32x4 signB = lvn::simdSet(-1.0f, +1.0f, -1.0f, +1.0f);
+
+		const LvnSimdF32x4 inv0 = lvn::simdMul(signA, lvn::simdAdd(lvn::simdSub(lvn::simdMul(vec1, fac0), lvn::simdMul(vec2, fac1)), lvn::simdMul(vec3, fac2)));
+		const LvnSimdF32x4 inv1 = lvn::simdMul(signB, lvn::simdAdd(lvn::simdSub(lvn::simdMul(vec0, fac0), lvn::simdMul(vec2, fac3)), lvn::simdMul(vec3, fac4)));
+		const LvnSimdF32x4 inv2 = lvn::simdMul(signA, lvn::simdAdd(lvn::simdSub(lvn::simdMul(vec0, fac1), lvn::simdMul(vec1, fac3)), lvn::simdMul(vec3, fac5)));
+		const LvnSimdF32x4 inv3 = lvn::simdMul(signB, lvn::simdAdd(lvn::simdSub(lvn::simdMul(vec0, fac2), lvn::simdMul(vec1, fac4)), lvn::simdMul(vec2, fac5)));
+
+		const LvnSimdF32x4 row0 = lvn::simdFirstLanes(inv0, inv1, inv2, inv3);
+		const LvnSimdF32x4 oneOverDeterminant = lvn::simdSplat(1.0f / lvn::simdHorizontalAdd(lvn::simdMul(c0, row0)));
+
+		LvnMat4x4_t<float> result;
+		lvn::simdStore(result.value[0], lvn::simdMul(inv0, oneOverDeterminant));
+		lvn::simdStore(result.value[1], lvn::simdMul(inv1, oneOverDeterminant));
+		lvn::simdStore(result.value[2], lvn::simdMul(inv2, oneOverDeterminant));
+		lvn::simdStore(result.value[3], lvn::simdMul(inv3, oneOverDeterminant));
+		return result;
+	}
+
+	inline LvnMat4x4_t<float> simdMat4Transpose(const LvnMat4x4_t<float>& m)
+	{
+		LvnSimdF32x4 c0 = lvn::simdLoad(m.value[0]), c1 = lvn::simdLoad(m.value[1]), c2 = lvn::simdLoad(m.value[2]), c3 = lvn::simdLoad(m.value[3]);
+		lvn::simdTranspose(c0, c1, c2, c3);
+
+		LvnMat4x4_t<float> result;
+		lvn::simdStore(result.value[0], c0);
+		lvn::simdStore(result.value[1], c1);
+		lvn::simdStore(result.value[2], c2);
+		lvn::simdStore(result.value[3], c3);
+		return result;
+	}
+
+	inline LvnMat4x4_t<float> simdMat4InverseAffine(const LvnMat4x4_t<float>& m)
+	{
+		// transposing the cross products of the columns gives the columns of the inverse 3x3, scaled by the determinant
+		const LvnVec3_t<float> c0(m[0].x, m[0].y, m[0].z);
+		const LvnVec3_t<float> c1(m[1].x, m[1].y, m[1].z);
+		const LvnVec3_t<float> c2(m[2].x, m[2].y, m[2].z);
+		const LvnVec3_t<float> r0 = lvn::cross(c1, c2);
+		const LvnVec3_t<float> r1 = lvn::cross(c2, c0);
+		const LvnVec3_t<float> r2 = lvn::cross(c0, c1);
+
+		const LvnSimdF32x4 oneOverDeterminant = lvn::simdSplat(1.0f / lvn::dot(c0, r0));
+		LvnSimdF32x4 i0 = lvn::simdMul(lvn::simdSet(r0.x, r0.y, r0.z, 0.0f), oneOverDeterminant);
+		LvnSimdF32x4 i1 = lvn::simdMul(lvn::simdSet(r1.x, r1.y, r1.z, 0.0f), oneOverDeterminant);
+		LvnSimdF32x4 i2 = lvn::simdMul(lvn::simdSet(r2.x, r2.y, r2.z, 0.0f), oneOverDeterminant);
+		LvnSimdF32x4 i3 = lvn::simdSplat(0.0f);
+		lvn::simdTranspose(i0, i1, i2, i3);
+
+		// translation is the inverse 3x3 applied to the negated translation
+		const LvnSimdF32x4 t = lvn::simdLoad(m.value[3]);
+		LvnSimdF32x4 translation = lvn::simdMul(i0, lvn::simdLane<0>(t));
+		translation = lvn::simdMulAdd(i1, lvn::simdLane<1>(t), translation);
+		translation = lvn::simdMulAdd(i2, lvn::simdLane<2>(t), translation);
+		translation = lvn::simdSub(lvn::simdSet(0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+		LvnMat4x4_t<float> result;
+		lvn::simdStore(result.value[0], i0);
+		lvn::simdStore(result.value[1], i1);
+		lvn::simdStore(result.value[2], i2);
+		lvn::simdStore(result.value[3], translation);
+		return result;
+	}
+}
+
+#endif
+
 // ---------------------------------------------
 // [SECTION]: Struct Implementaion
 // ---------------------------------------------
@@ -4763,6 +6040,72 @@ struct LvnRenderInitInfo
 	uint32_t            maxFramesInFlight;
 };
 
+struct LvnGpuPipelineStatistics
+{
+	uint64_t inputAssemblyVertices;        // vertices read by the input assembler
+	uint64_t inputAssemblyPrimitives;      // primitives read by the input assembler
+	uint64_t vertexShaderInvocations;
+	uint64_t clippingInvocations;          // primitives entering the clipping stage
+	uint64_t clippingPrimitives;           // primitives leaving the clipping stage
+	uint64_t fragmentShaderInvocations;
+};
+
+struct LvnGpuTiming
+{
+	const char* name;                      // name given to renderCmdBeginGpuRegion, "renderPass" or "frameBuffer" for passes timed automatically
+	LvnFrameBuffer* frameBuffer;           // frame buffer of an automatically timed frame buffer pass, nullptr otherwise
+	uint32_t depth;                        // nesting depth of the region, 0 if the region is not inside another region
+	double gpuTimeMs;                      // gpu time from the start to the end of the region
+	bool hasStatistics;                    // statistics are only collected for regions that are not nested
+	LvnGpuPipelineStatistics statistics;
+};
+
+#define LVN_FRAME_STATS_HISTORY_SIZE 128
+
+struct LvnFrameStats
+{
+	uint64_t frameNumber;                  // number of renderBeginNextFrame calls on the window before this frame
+
+	uint32_t drawCalls;                    // all draw calls, indexed and non-indexed
+	uint32_t indexedDrawCalls;
+	uint32_t instancedDrawCalls;           // draw calls made with renderCmdDrawInstanced or renderCmdDrawIndexedInstanced
+	uint64_t instances;                    // instances drawn, draw calls that are not instanced count as one instance
+	uint64_t vertices;                     // vertices submitted by non-indexed draw calls, multiplied by the instance count
+	uint64_t indices;                      // indices submitted by indexed draw calls, multiplied by the instance count
+
+	uint32_t pipelineBinds;
+	uint32_t descriptorSetBinds;           // each descriptor set of renderCmdBindDescriptorSets is counted
+	uint32_t vertexBufferBinds;
+	uint32_t indexBufferBinds;
+
+	uint64_t bufferUploadBytes;            // bytes uploaded with bufferUpdateVertexData and bufferUpdateIndexData, counted for the window that last began a frame
+	uint64_t uniformUploadBytes;           // bytes uploaded with updateUniformBufferData
+
+	uint32_t renderPasses;                 // renderCmdBeginRenderPass and renderCmdEndRenderPass pairs
+	uint32_t frameBufferPasses;            // renderCmdBeginFrameBuffer and renderCmdEndFrameBuffer pairs
+};
+
+struct LvnFramePacerCreateInfo
+{
+	double targetHz;                       // frames per second to limit to, 0 does not limit
+	uint64_t spinNs;                       // time before the frame is due that is spent spinning instead of sleeping, 0 uses a default of 1 ms (2 ms on windows where sleeps are less precise)
+	uint32_t historySize;                  // number of recent frames used for the percentiles, 0 uses a default of 240
+};
+
+struct LvnFramePacerStats
+{
+	uint64_t frameCount;                   // frames paced since the pacer was created
+	uint64_t missedFrames;                 // frames that started later than one full interval after they were due
+	uint32_t sampleCount;                  // frames in the history used for the values below
+	double targetMs;
+	double lastWorkMs;                     // time between framePacerBeginFrame and the end of framePacerEndFrame of the last frame, 0 if framePacerEndFrame is not used
+	double averageFrameMs;                 // average time between the start of two frames
+	double jitterP50Ms;                    // difference between the actual and target frame time
+	double jitterP95Ms;
+	double jitterP99Ms;
+	double jitterMaxMs;
+};
+
 struct LvnPipelineInputAssembly
 {
 	LvnTopologyType topology;
@@ -5009,12 +6352,19 @@ struct LvnMaterial
 	LvnTexture* emissive;
 };
 
+struct LvnMeshBounds
+{
+	LvnVec3 min;          // smallest corner of the axis aligned bounding box of the mesh vertices in model space
+	LvnVec3 max;          // largest corner of the axis aligned bounding box of the mesh vertices in model space
+};
+
 struct LvnMesh
 {
 	LvnBuffer* buffer;    // single buffer that contains both vertex and index buffer
 	LvnDescriptorSet* descriptorSet;
 	LvnMaterial material; // material to hold shader and texture data
 	LvnMat4 modelMatrix;  // model matrix of mesh
+	LvnMeshBounds bounds; // bounds of the mesh vertices, set when loading models
 
 	uint32_t vertexCount; // number of vertices in this mesh
 	uint32_t indexCount;  // number of indices in this mesh
@@ -5033,6 +6383,328 @@ struct LvnModel
 	LvnMat4 modelMatrix;
 };
 
+struct LvnMeshDrawRange
+{
+	uint32_t firstIndex;  // first index to draw in the index buffer
+	uint32_t indexCount;  // number of indices to draw
+	uint32_t vertexCount; // number of vertices referenced by the indices
+};
+
+// 32 bit handle to a mesh in a LvnMeshStore, the low 20 bits are the slot index and the high 12 bits are the generation of the slot
+// handles of removed meshes are detected as invalid until the generation of their slot wraps around, generation 0 is never used so a zero initialized handle is always invalid
+struct LvnMeshHandle
+{
+	uint32_t id;
+
+	bool operator==(const LvnMeshHandle& other) const { return id == other.id; }
+	bool operator!=(const LvnMeshHandle& other) const { return id != other.id; }
+};
+
+// optional structure of arrays storage for meshes, each mesh property is kept in its own tightly packed array so that
+// loops over many meshes (eg. culling with bounds, uploading transforms) only touch the data they use
+// meshes are stored densely and removing a mesh moves the last mesh into its place, use handles to refer to meshes across removals
+// the store only references the mesh buffers and textures of materials, they must be destroyed separately (eg. with lvn::freeModel)
+class LvnMeshStore
+{
+public:
+	static constexpr uint32_t IndexBits = 20;
+	static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+	static constexpr uint32_t GenerationMask = (1u << (32 - IndexBits)) - 1;
+	static constexpr uint32_t MaxMeshes = IndexMask;
+	static constexpr LvnMeshHandle NullHandle = { UINT32_MAX };
+
+private:
+	static constexpr uint32_t FreeSlot = UINT32_MAX; // m_SlotToDense value of slots without a mesh
+
+	// dense arrays, element i of each array belongs to the same mesh
+	std::vector<LvnMat4> m_Transforms;
+	std::vector<LvnMeshBounds> m_Bounds;
+	std::vector<LvnMeshDrawRange> m_DrawRanges;
+	std::vector<uint32_t> m_MaterialIds;
+	std::vector<LvnBuffer*> m_Buffers;
+	std::vector<uint32_t> m_DenseToSlot;
+
+	// sparse slots that handles index into
+	std::vector<uint32_t> m_SlotToDense;
+	std::vector<uint32_t> m_SlotGenerations;
+	std::vector<uint32_t> m_FreeSlots;
+
+	// materials are shared by meshes that use the same material and ref counted, slots of released materials are reused
+	std::vector<LvnMaterial> m_Materials;
+	std::vector<uint32_t> m_MaterialRefCounts;
+	std::vector<uint32_t> m_FreeMaterials;
+	std::vector<uint64_t> m_MaterialHashes;
+	std::unordered_multimap<uint64_t, uint32_t> m_MaterialLookup; // material hash to the ids of materials with that hash
+
+	// generation of a slot after a mesh is removed from it, skips 0 when wrapping around
+	static uint32_t next_generation(uint32_t generation)
+	{
+		generation = (generation + 1) & GenerationMask;
+		return generation ? generation : 1;
+	}
+
+	// FNV-1a over the material fields that same_material compares, -0.0 is hashed as 0.0 since they compare equal
+	static uint64_t hash_material(const LvnMaterial& material)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto hashBytes = [&hash](const void* value, size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(value);
+			for (size_t i = 0; i < size; i++) { hash = (hash ^ bytes[i]) * 1099511628211ull; }
+		};
+
+		const float values[] = { material.vBaseColor.x, material.vBaseColor.y, material.vBaseColor.z, material.fMetallic,
+			material.fRoughness, material.fNormal, material.fOcclusion, material.fEmissiveStrength };
+		for (float value : values) { value += 0.0f; hashBytes(&value, sizeof(float)); }
+
+		const LvnTexture* textures[] = { material.albedo, material.metallicRoughnessOcclusion, material.normal, material.emissive };
+		hashBytes(textures, sizeof(textures));
+		return hash;
+	}
+
+	static bool same_material(const LvnMaterial& a, const LvnMaterial& b)
+	{
+		return a.vBaseColor.x == b.vBaseColor.x && a.vBaseColor.y == b.vBaseColor.y && a.vBaseColor.z == b.vBaseColor.z &&
+			a.fMetallic == b.fMetallic && a.fRoughness == b.fRoughness && a.fNormal == b.fNormal && a.fOcclusion == b.fOcclusion &&
+			a.fEmissiveStrength == b.fEmissiveStrength && a.albedo == b.albedo && a.metallicRoughnessOcclusion == b.metallicRoughnessOcclusion &&
+			a.normal == b.normal && a.emissive == b.emissive;
+	}
+
+	// returns the id of a material in use that is equal to the given material, UINT32_MAX if there is none
+	uint32_t find_material(const LvnMaterial& material, uint64_t hash) const
+	{
+		auto range = m_MaterialLookup.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (m_MaterialRefCounts[it->second] > 0 && same_material(m_Materials[it->second], material))
+				return it->second;
+		}
+
+		return UINT32_MAX;
+	}
+
+	void acquire_material(uint32_t materialId)
+	{
+		if (materialId < m_MaterialRefCounts.size()) { m_MaterialRefCounts[materialId]++; }
+	}
+
+	void release_material(uint32_t materialId)
+	{
+		if (materialId >= m_MaterialRefCounts.size() || m_MaterialRefCounts[materialId] == 0) { return; }
+
+		if (--m_MaterialRefCounts[materialId] == 0)
+		{
+			auto range = m_MaterialLookup.equal_range(m_MaterialHashes[materialId]);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				if (it->second == materialId) { m_MaterialLookup.erase(it); break; }
+			}
+
+			m_Materials[materialId] = {};
+			m_FreeMaterials.push_back(materialId);
+		}
+	}
+
+	uint32_t slot_of(LvnMeshHandle handle) const
+	{
+		LVN_CORE_ASSERT(valid(handle), "mesh handle is invalid, the mesh was removed or the handle belongs to another store");
+		return handle.id & IndexMask;
+	}
+
+public:
+	LvnMeshHandle add(LvnBuffer* buffer, const LvnMat4& transform, const LvnMeshBounds& bounds, const LvnMeshDrawRange& drawRange, uint32_t materialId)
+	{
+		uint32_t slot;
+		if (!m_FreeSlots.empty())
+		{
+			slot = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			LVN_CORE_ASSERT(m_SlotToDense.size() < MaxMeshes, "mesh store is full, cannot add more meshes");
+			slot = static_cast<uint32_t>(m_SlotToDense.size());
+			m_SlotToDense.push_back(FreeSlot);
+			m_SlotGenerations.push_back(1);
+		}
+
+		m_SlotToDense[slot] = static_cast<uint32_t>(m_Transforms.size());
+		acquire_material(materialId);
+
+		m_Transforms.push_back(transform);
+		m_Bounds.push_back(bounds);
+		m_DrawRanges.push_back(drawRange);
+		m_MaterialIds.push_back(materialId);
+		m_Buffers.push_back(buffer);
+		m_DenseToSlot.push_back(slot);
+
+		return { (m_SlotGenerations[slot] << IndexBits) | slot };
+	}
+
+	// adds the mesh and its material, returns the handle of the added mesh
+	// the material is shared with meshes already in the store that use an equal material (eg. meshes of the same model)
+	LvnMeshHandle add(const LvnMesh& mesh)
+	{
+		uint64_t hash = hash_material(mesh.material);
+		uint32_t materialId = find_material(mesh.material, hash);
+		if (materialId == UINT32_MAX) { materialId = add_material(mesh.material, hash); }
+
+		return add(mesh.buffer, mesh.modelMatrix, mesh.bounds, { 0, mesh.indexCount, mesh.vertexCount }, materialId);
+	}
+
+	// adds every mesh of the model, pHandles is optional and must have room for model.meshes.size() handles
+	void add_model(const LvnModel& model, LvnMeshHandle* pHandles = nullptr)
+	{
+		reserve(static_cast<uint32_t>(m_Transforms.size() + model.meshes.size()));
+
+		for (size_t i = 0; i < model.meshes.size(); i++)
+		{
+			LvnMeshHandle handle = add(model.meshes[i]);
+			if (pHandles) { pHandles[i] = handle; }
+		}
+	}
+
+	void remove(LvnMeshHandle handle)
+	{
+		uint32_t slot = slot_of(handle);
+		uint32_t dense = m_SlotToDense[slot];
+		uint32_t last = static_cast<uint32_t>(m_Transforms.size()) - 1;
+
+		release_material(m_MaterialIds[dense]);
+
+		// move the last mesh into the removed mesh so the arrays stay packed
+		if (dense != last)
+		{
+			m_Transforms[dense] = m_Transforms[last];
+			m_Bounds[dense] = m_Bounds[last];
+			m_DrawRanges[dense] = m_DrawRanges[last];
+			m_MaterialIds[dense] = m_MaterialIds[last];
+			m_Buffers[dense] = m_Buffers[last];
+			m_DenseToSlot[dense] = m_DenseToSlot[last];
+			m_SlotToDense[m_DenseToSlot[dense]] = dense;
+		}
+
+		m_Transforms.pop_back();
+		m_Bounds.pop_back();
+		m_DrawRanges.pop_back();
+		m_MaterialIds.pop_back();
+		m_Buffers.pop_back();
+		m_DenseToSlot.pop_back();
+
+		m_SlotToDense[slot] = FreeSlot;
+		m_SlotGenerations[slot] = next_generation(m_SlotGenerations[slot]);
+		m_FreeSlots.push_back(slot);
+	}
+
+	bool valid(LvnMeshHandle handle) const
+	{
+		uint32_t slot = handle.id & IndexMask;
+		return slot < m_SlotToDense.size() && m_SlotToDense[slot] != FreeSlot && m_SlotGenerations[slot] == (handle.id >> IndexBits);
+	}
+
+	// adds a material that meshes can refer to by its id, the material is released when the last mesh using it is removed
+	uint32_t add_material(const LvnMaterial& material) { return add_material(material, hash_material(material)); }
+
+	uint32_t add_material(const LvnMaterial& material, uint64_t hash)
+	{
+		uint32_t materialId;
+		if (!m_FreeMaterials.empty())
+		{
+			materialId = m_FreeMaterials.back();
+			m_FreeMaterials.pop_back();
+			m_Materials[materialId] = material;
+			m_MaterialHashes[materialId] = hash;
+		}
+		else
+		{
+			materialId = static_cast<uint32_t>(m_Materials.size());
+			m_Materials.push_back(material);
+			m_MaterialRefCounts.push_back(0);
+			m_MaterialHashes.push_back(hash);
+		}
+
+		m_MaterialLookup.emplace(hash, materialId);
+		return materialId;
+	}
+
+	// changes the material the mesh uses, the previous material is released if no other mesh uses it
+	void set_material_id(LvnMeshHandle handle, uint32_t materialId)
+	{
+		uint32_t& meshMaterialId = m_MaterialIds[index(handle)];
+		acquire_material(materialId);
+		release_material(meshMaterialId);
+		meshMaterialId = materialId;
+	}
+
+	void reserve(uint32_t count)
+	{
+		m_Transforms.reserve(count);
+		m_Bounds.reserve(count);
+		m_DrawRanges.reserve(count);
+		m_MaterialIds.reserve(count);
+		m_Buffers.reserve(count);
+		m_DenseToSlot.reserve(count);
+		m_SlotToDense.reserve(count);
+		m_SlotGenerations.reserve(count);
+	}
+
+	// removes all meshes and materials, handles given out before are invalidated
+	void clear()
+	{
+		for (uint32_t i = 0; i < m_DenseToSlot.size(); i++)
+		{
+			uint32_t slot = m_DenseToSlot[i];
+			m_SlotToDense[slot] = FreeSlot;
+			m_SlotGenerations[slot] = next_generation(m_SlotGenerations[slot]);
+			m_FreeSlots.push_back(slot);
+		}
+
+		m_Transforms.clear();
+		m_Bounds.clear();
+		m_DrawRanges.clear();
+		m_MaterialIds.clear();
+		m_Buffers.clear();
+		m_DenseToSlot.clear();
+		m_Materials.clear();
+		m_MaterialRefCounts.clear();
+		m_FreeMaterials.clear();
+		m_MaterialHashes.clear();
+		m_MaterialLookup.clear();
+	}
+
+	uint32_t size() const { return static_cast<uint32_t>(m_Transforms.size()); }
+	bool empty() const { return m_Transforms.empty(); }
+
+	// dense index of the mesh, valid until a mesh is removed
+	uint32_t index(LvnMeshHandle handle) const { return m_SlotToDense[slot_of(handle)]; }
+	LvnMeshHandle handle(uint32_t index) const { uint32_t slot = m_DenseToSlot[index]; return { (m_SlotGenerations[slot] << IndexBits) | slot }; }
+
+	LvnMat4& transform(LvnMeshHandle handle) { return m_Transforms[index(handle)]; }
+	const LvnMat4& transform(LvnMeshHandle handle) const { return m_Transforms[index(handle)]; }
+	LvnMeshBounds& bounds(LvnMeshHandle handle) { return m_Bounds[index(handle)]; }
+	const LvnMeshBounds& bounds(LvnMeshHandle handle) const { return m_Bounds[index(handle)]; }
+	LvnMeshDrawRange& draw_range(LvnMeshHandle handle) { return m_DrawRanges[index(handle)]; }
+	const LvnMeshDrawRange& draw_range(LvnMeshHandle handle) const { return m_DrawRanges[index(handle)]; }
+	uint32_t material_id(LvnMeshHandle handle) const { return m_MaterialIds[index(handle)]; }
+	LvnBuffer*& buffer(LvnMeshHandle handle) { return m_Buffers[index(handle)]; }
+	LvnBuffer* buffer(LvnMeshHandle handle) const { return m_Buffers[index(handle)]; }
+	LvnMaterial& material(uint32_t materialId) { return m_Materials[materialId]; } // changes are not seen by add(mesh) when it looks for an equal material to share
+	const LvnMaterial& material(uint32_t materialId) const { return m_Materials[materialId]; }
+
+	// dense arrays indexed by the dense mesh index
+	LvnSpan<LvnMat4> transforms() { return m_Transforms; }
+	LvnSpan<const LvnMat4> transforms() const { return m_Transforms; }
+	LvnSpan<LvnMeshBounds> bounds() { return m_Bounds; }
+	LvnSpan<const LvnMeshBounds> bounds() const { return m_Bounds; }
+	LvnSpan<LvnMeshDrawRange> draw_ranges() { return m_DrawRanges; }
+	LvnSpan<const LvnMeshDrawRange> draw_ranges() const { return m_DrawRanges; }
+	LvnSpan<const uint32_t> material_ids() const { return m_MaterialIds; } // use set_material_id to change the material of a mesh so that materials stay ref counted
+	LvnSpan<LvnBuffer*> buffers() { return m_Buffers; }
+	LvnSpan<LvnBuffer* const> buffers() const { return m_Buffers; }
+	LvnSpan<LvnMaterial> materials() { return m_Materials; } // indexed by material id, slots of released materials are zeroed until reused
+	LvnSpan<const LvnMaterial> materials() const { return m_Materials; }
+};
+
 struct LvnCamera
 {
 	LvnMat4 projectionMatrix;    // projection matrix
@@ -22,6 +22,7 @@ namespace ogls
 	static GLenum             getDataFormat(LvnColorImageFormat texFormat);
 	static void               getDepthFormat(LvnDepthImageFormat texFormat, GLenum* format, GLenum* attachmentType);
 	static LvnResult          updateFrameBuffer(OglFramebufferData* frameBufferData);
+	static bool               hasExtension(const char* name);
 
 	static LvnResult checkErrorCode()
 	{
@@ -457,6 +458,22 @@ namespace ogls
 		return Lvn_Result_Success;
 	}
 
+	// glad is generated without extensions, so extensions are looked up in the list of the current context
+	static bool hasExtension(const char* name)
+	{
+		GLint extensionCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+		for (GLint i = 0; i < extensionCount; i++)
+		{
+			const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+			if (extension && strcmp(extension, name) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
 } /* namespace ogls */
 
 
@@ -531,6 +548,14 @@ LvnResult oglsImplCreateContext(LvnGraphicsContext* graphicsContext)
 	graphicsContext->frameBufferSetClearColor = oglsImplFrameBufferSetClearColor;
 	graphicsContext->findSupportedDepthImageFormat = oglsImplFindSupportedDepthImageFormat;
 
+	graphicsContext->gpuTimingCreate = oglsImplGpuTimingCreate;
+	graphicsContext->gpuTimingDestroy = oglsImplGpuTimingDestroy;
+	graphicsContext->gpuTimingCmdResetFrame = oglsImplGpuTimingCmdResetFrame;
+	graphicsContext->gpuTimingCmdWriteTimestamp = oglsImplGpuTimingCmdWriteTimestamp;
+	graphicsContext->gpuTimingCmdBeginStatistics = oglsImplGpuTimingCmdBeginStatistics;
+	graphicsContext->gpuTimingCmdEndStatistics = oglsImplGpuTimingCmdEndStatistics;
+	graphicsContext->gpuTimingGetResults = oglsImplGpuTimingGetResults;
+
 
 	// NOTE: opengl does not support any enumerated physical devices so we just create a dummy device
 	LvnPhysicalDeviceInfo info{};
@@ -751,7 +776,7 @@ LvnResult oglsImplCreateDescriptorLayout(LvnDescriptorLayout* descriptorLayout,
 
 LvnResult oglsImplCreateDescriptorSet(LvnDescriptorSet* descriptorSet, LvnDescriptorLayout* descriptorLayout)
 {
-	descriptorSet->singleSet = lvn::memAlloc(sizeof(OglDescriptorSet));
+	descriptorSet->singleSet = lvn::memAlloc(sizeof(OglDescriptorSet), Lvn_MemoryTag_Graphics);
 	memcpy(descriptorSet->singleSet, descriptorLayout->descriptorLayout, sizeof(OglDescriptorSet));
 
 	return Lvn_Result_Success;
@@ -771,7 +796,7 @@ LvnResult oglsImplCreatePipeline(LvnPipeline* pipeline, LvnPipelineCreateInfo* c
 	}
 
 	pipeline->id = shaderProgram;
-	pipeline->nativePipeline = lvn::memAlloc(sizeof(OglPipelineEnums));
+	pipeline->nativePipeline = lvn::memAlloc(sizeof(OglPipelineEnums), Lvn_MemoryTag_Graphics);
 
 	OglPipelineEnums* pipelineEnums = static_cast<OglPipelineEnums*>(pipeline->nativePipeline);
 
@@ -1323,6 +1348,127 @@ LvnDepthImageFormat oglsImplFindSupportedDepthImageFormat(LvnDepthImageFormat* p
 	return pDepthImageFormats[0];
 }
 
+// in the same order as the members of LvnGpuPipelineStatistics
+static const GLenum s_GpuTimingStatisticTargets[] =
+{
+	GL_VERTICES_SUBMITTED,
+	GL_PRIMITIVES_SUBMITTED,
+	GL_VERTEX_SHADER_INVOCATIONS,
+	GL_CLIPPING_INPUT_PRIMITIVES,
+	GL_CLIPPING_OUTPUT_PRIMITIVES,
+	GL_FRAGMENT_SHADER_INVOCATIONS,
+};
+
+static const uint32_t s_GpuTimingStatisticCount = sizeof(s_GpuTimingStatisticTargets) / sizeof(GLenum);
+
+// opengl keeps a few frames queued in the driver, results are read back once the frame comes around again
+static const uint32_t s_GpuTimingFrameCount = 3;
+
+LvnResult oglsImplGpuTimingCreate(LvnWindow* window, LvnGpuTimingData* gpuTiming)
+{
+	// GL_VERTICES_SUBMITTED and the other statistics queries are core in opengl 4.6 and available earlier through ARB_pipeline_statistics_query
+	if (gpuTiming->pipelineStatistics && !GLAD_GL_VERSION_4_6 && !ogls::hasExtension("GL_ARB_pipeline_statistics_query"))
+	{
+		LVN_CORE_WARN("[opengl] pipeline statistics queries require opengl 4.6 or ARB_pipeline_statistics_query, only timestamps will be collected");
+		gpuTiming->pipelineStatistics = false;
+	}
+
+	OglGpuTimingData* queryData = new (lvn::memAlloc(sizeof(OglGpuTimingData), Lvn_MemoryTag_Graphics)) OglGpuTimingData();
+
+	gpuTiming->frames.resize(s_GpuTimingFrameCount);
+
+	queryData->timestampQueries.resize(s_GpuTimingFrameCount * LVN_GPU_TIMING_MAX_REGIONS * 2);
+	glGenQueries(static_cast<GLsizei>(queryData->timestampQueries.size()), queryData->timestampQueries.data());
+
+	if (gpuTiming->pipelineStatistics)
+	{
+		queryData->statisticsQueries.resize(s_GpuTimingFrameCount * LVN_GPU_TIMING_MAX_REGIONS * s_GpuTimingStatisticCount);
+		glGenQueries(static_cast<GLsizei>(queryData->statisticsQueries.size()), queryData->statisticsQueries.data());
+	}
+
+	gpuTiming->queryData = queryData;
+	return Lvn_Result_Success;
+}
+
+void oglsImplGpuTimingDestroy(LvnWindow* window, LvnGpuTimingData* gpuTiming)
+{
+	OglGpuTimingData* queryData = static_cast<OglGpuTimingData*>(gpuTiming->queryData);
+	if (!queryData) { return; }
+
+	glDeleteQueries(static_cast<GLsizei>(queryData->timestampQueries.size()), queryData->timestampQueries.data());
+	if (!queryData->statisticsQueries.empty())
+		glDeleteQueries(static_cast<GLsizei>(queryData->statisticsQueries.size()), queryData->statisticsQueries.data());
+
+	queryData->~OglGpuTimingData();
+	lvn::memFree(queryData);
+	gpuTiming->queryData = nullptr;
+}
+
+void oglsImplGpuTimingCmdResetFrame(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex)
+{
+	// opengl queries do not need to be reset before they are reused
+}
+
+void oglsImplGpuTimingCmdWriteTimestamp(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	OglGpuTimingData* queryData = static_cast<OglGpuTimingData*>(gpuTiming->queryData);
+
+	// timestamps are used instead of GL_TIME_ELAPSED so that regions can be nested
+	glQueryCounter(queryData->timestampQueries[frameIndex * LVN_GPU_TIMING_MAX_REGIONS * 2 + queryIndex], GL_TIMESTAMP);
+}
+
+void oglsImplGpuTimingCmdBeginStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	OglGpuTimingData* queryData = static_cast<OglGpuTimingData*>(gpuTiming->queryData);
+	uint32_t* queries = &queryData->statisticsQueries[(frameIndex * LVN_GPU_TIMING_MAX_REGIONS + queryIndex) * s_GpuTimingStatisticCount];
+
+	for (uint32_t i = 0; i < s_GpuTimingStatisticCount; i++)
+		glBeginQuery(s_GpuTimingStatisticTargets[i], queries[i]);
+}
+
+void oglsImplGpuTimingCmdEndStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	for (uint32_t i = 0; i < s_GpuTimingStatisticCount; i++)
+		glEndQuery(s_GpuTimingStatisticTargets[i]);
+}
+
+bool oglsImplGpuTimingGetResults(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint64_t* pTimestampsNs, LvnGpuPipelineStatistics* pStatistics)
+{
+	OglGpuTimingData* queryData = static_cast<OglGpuTimingData*>(gpuTiming->queryData);
+	const LvnGpuTimingFrame& frame = gpuTiming->frames[frameIndex];
+
+	const uint32_t* timestampQueries = &queryData->timestampQueries[frameIndex * LVN_GPU_TIMING_MAX_REGIONS * 2];
+	const uint32_t* statisticsQueries = queryData->statisticsQueries.empty() ? nullptr : &queryData->statisticsQueries[frameIndex * LVN_GPU_TIMING_MAX_REGIONS * s_GpuTimingStatisticCount];
+	uint32_t statisticsQueryCount = statisticsQueries ? frame.statisticsCount * s_GpuTimingStatisticCount : 0;
+
+	// check that every query is available first so that reading the results never stalls
+	for (uint32_t i = 0; i < frame.timestampCount; i++)
+	{
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(timestampQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) { return false; }
+	}
+	for (uint32_t i = 0; i < statisticsQueryCount; i++)
+	{
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(statisticsQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) { return false; }
+	}
+
+	// GL_TIMESTAMP is already in nanoseconds
+	for (uint32_t i = 0; i < frame.timestampCount; i++)
+		glGetQueryObjectui64v(timestampQueries[i], GL_QUERY_RESULT, &pTimestampsNs[i]);
+
+	for (uint32_t i = 0; i < statisticsQueryCount; i++)
+	{
+		GLuint64 value;
+		glGetQueryObjectui64v(statisticsQueries[i], GL_QUERY_RESULT, &value);
+		reinterpret_cast<uint64_t*>(&pStatistics[i / s_GpuTimingStatisticCount])[i % s_GpuTimingStatisticCount] = value;
+	}
+
+	return true;
+}
+
 void setOglWindowContextValues()
 {
 	OglBackends* oglBackends = s_OglBackends;
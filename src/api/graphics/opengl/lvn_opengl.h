@@ -66,6 +66,14 @@ namespace lvn
 
 	LvnDepthImageFormat oglsImplFindSupportedDepthImageFormat(LvnDepthImageFormat* pDepthImageFormats, uint32_t count);
 
+	LvnResult oglsImplGpuTimingCreate(LvnWindow* window, LvnGpuTimingData* gpuTiming);
+	void oglsImplGpuTimingDestroy(LvnWindow* window, LvnGpuTimingData* gpuTiming);
+	void oglsImplGpuTimingCmdResetFrame(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex);
+	void oglsImplGpuTimingCmdWriteTimestamp(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	void oglsImplGpuTimingCmdBeginStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	void oglsImplGpuTimingCmdEndStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	bool oglsImplGpuTimingGetResults(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint64_t* pTimestampsNs, LvnGpuPipelineStatistics* pStatistics);
+
 
 	void setOglWindowContextValues();
 
@@ -104,6 +112,12 @@ namespace lvn
 		std::vector<LvnTexture> colorAttachmentTextures;
 	};
 
+	struct OglGpuTimingData
+	{
+		std::vector<uint32_t> timestampQueries;     // LVN_GPU_TIMING_MAX_REGIONS * 2 queries for each frame
+		std::vector<uint32_t> statisticsQueries;    // one query for each statistic, LVN_GPU_TIMING_MAX_REGIONS * 6 queries for each frame
+	};
+
 	struct OglBackends
 	{
 		const char* deviceName;
@@ -45,6 +45,9 @@ static VulkanBackends* s_VkBackends = nullptr;
 
 namespace vks
 {
+	static VKAPI_ATTR void* VKAPI_CALL          allocationCallback(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+	static VKAPI_ATTR void* VKAPI_CALL          reallocationCallback(void* pUserData, void* pOriginal, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+	static VKAPI_ATTR void VKAPI_CALL           freeCallback(void* pUserData, void* pMemory);
 	static LvnResult                            createVulkanInstace(VulkanBackends* vkBackends, bool enableValidationLayers);
 	static VKAPI_ATTR VkBool32 VKAPI_CALL       debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageType, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData);
 	static bool                                 checkValidationLayerSupport();
@@ -106,6 +109,34 @@ namespace vks
 	static void                                 transitionImageLayout(VulkanBackends* vkBackends, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t layerCount);
 	static void                                 copyBufferToImage(VulkanBackends* vkBackends, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
 
+	static VKAPI_ATTR void* VKAPI_CALL allocationCallback(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
+	{
+		if (size == 0) { return nullptr; }
+
+		LvnAllocationCallbacks* allocCallbacks = static_cast<LvnAllocationCallbacks*>(pUserData);
+		return allocCallbacks->allocFn(size, alignment, allocCallbacks->userData);
+	}
+
+	static VKAPI_ATTR void* VKAPI_CALL reallocationCallback(void* pUserData, void* pOriginal, size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
+	{
+		LvnAllocationCallbacks* allocCallbacks = static_cast<LvnAllocationCallbacks*>(pUserData);
+
+		// vulkan expects a reallocation of size 0 to free the original memory
+		if (size == 0)
+		{
+			allocCallbacks->freeFn(pOriginal, allocCallbacks->userData);
+			return nullptr;
+		}
+
+		return allocCallbacks->reallocFn(pOriginal, size, alignment, allocCallbacks->userData);
+	}
+
+	static VKAPI_ATTR void VKAPI_CALL freeCallback(void* pUserData, void* pMemory)
+	{
+		LvnAllocationCallbacks* allocCallbacks = static_cast<LvnAllocationCallbacks*>(pUserData);
+		allocCallbacks->freeFn(pMemory, allocCallbacks->userData);
+	}
+
 	static LvnResult createVulkanInstace(VulkanBackends* vkBackends, bool enableValidationLayers)
 	{
 		// Create Vulkan Instance
@@ -138,7 +169,7 @@ namespace vks
 		}
 
 		// Create Instance
-		if (vkCreateInstance(&createInfo, nullptr, &vkBackends->instance) != VK_SUCCESS)
+		if (vkCreateInstance(&createInfo, vkBackends->pAllocator, &vkBackends->instance) != VK_SUCCESS)
 		{
 			LVN_CORE_ERROR("[vulkan] failed to create instance at (%p)", vkBackends->instance);
 			return Lvn_Result_Failure;
@@ -261,7 +292,7 @@ namespace vks
 		VkDebugUtilsMessengerCreateInfoEXT createInfo{};
 		fillVulkanDebugMessengerCreateInfo(&createInfo);
 
-		LVN_CORE_CALL_ASSERT(createDebugUtilsMessengerEXT(vkBackends->instance, &createInfo, nullptr, &vkBackends->debugMessenger) == VK_SUCCESS, "[vulkan] failed to set up debug messenger!");
+		LVN_CORE_CALL_ASSERT(createDebugUtilsMessengerEXT(vkBackends->instance, &createInfo, vkBackends->pAllocator, &vkBackends->debugMessenger) == VK_SUCCESS, "[vulkan] failed to set up debug messenger!");
 	}
 
 	static LvnPhysicalDeviceType getPhysicalDeviceTypeEnum(VkPhysicalDeviceType type)
@@ -410,6 +441,10 @@ namespace vks
 		if (vkBackends->deviceSupportedFeatures.samplerAnisotropy)
 			deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+		// used by gpu timing when pipeline statistics are requested
+		if (vkBackends->deviceSupportedFeatures.pipelineStatisticsQuery)
+			deviceFeatures.pipelineStatisticsQuery = VK_TRUE;
+
 		VkDeviceCreateInfo createInfo{};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 		createInfo.pQueueCreateInfos = queueCreateInfos.data();
@@ -428,7 +463,7 @@ namespace vks
 		else
 			createInfo.enabledLayerCount = 0;
 
-		if (vkCreateDevice(vkBackends->physicalDevice, &createInfo, nullptr, &vkBackends->device) != VK_SUCCESS)
+		if (vkCreateDevice(vkBackends->physicalDevice, &createInfo, vkBackends->pAllocator, &vkBackends->device) != VK_SUCCESS)
 		{
 			LVN_CORE_ERROR("[vulkan] failed to create logical device <VkDevice> (%p)", vkBackends->device);
 			return Lvn_Result_Failure;
@@ -498,7 +533,7 @@ namespace vks
 		renderPassInfo.dependencyCount = 1;
 		renderPassInfo.pDependencies = &dependency;
 
-		LVN_CORE_CALL_ASSERT(vkCreateRenderPass(vkBackends->device, &renderPassInfo, nullptr, &surfaceData->renderPass) == VK_SUCCESS, "[vulkan] failed to create render pass!");
+		LVN_CORE_CALL_ASSERT(vkCreateRenderPass(vkBackends->device, &renderPassInfo, vkBackends->pAllocator, &surfaceData->renderPass) == VK_SUCCESS, "[vulkan] failed to create render pass!");
 	}
 
 	static bool checkDeviceExtensionSupport(VkPhysicalDevice device)
@@ -647,7 +682,7 @@ namespace vks
 		createInfo.clipped = VK_TRUE;
 		createInfo.oldSwapchain = VK_NULL_HANDLE;
 
-		LVN_CORE_CALL_ASSERT(vkCreateSwapchainKHR(vkBackends->device, &createInfo, nullptr, &surfaceData->swapChain) == VK_SUCCESS, "[vulkan] failed to create swap chain!");
+		LVN_CORE_CALL_ASSERT(vkCreateSwapchainKHR(vkBackends->device, &createInfo, vkBackends->pAllocator, &surfaceData->swapChain) == VK_SUCCESS, "[vulkan] failed to create swap chain!");
 
 		vkGetSwapchainImagesKHR(vkBackends->device, surfaceData->swapChain, &imageCount, nullptr);
 		surfaceData->swapChainImages.resize(imageCount);
@@ -675,7 +710,7 @@ namespace vks
 		viewInfo.subresourceRange.layerCount = 1;
 
 		VkImageView imageView;
-		LVN_CORE_CALL_ASSERT(vkCreateImageView(device, &viewInfo, nullptr, &imageView) == VK_SUCCESS, "[vulkan] failed to create image view!");
+		LVN_CORE_CALL_ASSERT(vkCreateImageView(device, &viewInfo, s_VkBackends->pAllocator, &imageView) == VK_SUCCESS, "[vulkan] failed to create image view!");
 
 		return imageView;
 	}
@@ -721,7 +756,7 @@ namespace vks
 			framebufferInfo.height = surfaceData->swapChainExtent.height;
 			framebufferInfo.layers = 1;
 
-			LVN_CORE_CALL_ASSERT(vkCreateFramebuffer(vkBackends->device, &framebufferInfo, nullptr, &surfaceData->frameBuffers[i]) == VK_SUCCESS, "[vulkan] failed to create framebuffer!");
+			LVN_CORE_CALL_ASSERT(vkCreateFramebuffer(vkBackends->device, &framebufferInfo, vkBackends->pAllocator, &surfaceData->frameBuffers[i]) == VK_SUCCESS, "[vulkan] failed to create framebuffer!");
 		}
 	}
 
@@ -752,9 +787,9 @@ namespace vks
 
 		for (uint32_t i = 0; i < vkBackends->maxFramesInFlight; i++)
 		{
-			LVN_CORE_CALL_ASSERT(vkCreateSemaphore(vkBackends->device, &semaphoreInfo, nullptr, &surfaceData->imageAvailableSemaphores[i]) == VK_SUCCESS, "[vulkan] failed to create semaphore");
-			LVN_CORE_CALL_ASSERT(vkCreateSemaphore(vkBackends->device, &semaphoreInfo, nullptr, &surfaceData->renderFinishedSemaphores[i]) == VK_SUCCESS, "[vulkan] failed to create semaphore");
-			LVN_CORE_CALL_ASSERT(vkCreateFence(vkBackends->device, &fenceInfo, nullptr, &surfaceData->inFlightFences[i]) == VK_SUCCESS, "[vulkan] failed to create fence");
+			LVN_CORE_CALL_ASSERT(vkCreateSemaphore(vkBackends->device, &semaphoreInfo, vkBackends->pAllocator, &surfaceData->imageAvailableSemaphores[i]) == VK_SUCCESS, "[vulkan] failed to create semaphore");
+			LVN_CORE_CALL_ASSERT(vkCreateSemaphore(vkBackends->device, &semaphoreInfo, vkBackends->pAllocator, &surfaceData->renderFinishedSemaphores[i]) == VK_SUCCESS, "[vulkan] failed to create semaphore");
+			LVN_CORE_CALL_ASSERT(vkCreateFence(vkBackends->device, &fenceInfo, vkBackends->pAllocator, &surfaceData->inFlightFences[i]) == VK_SUCCESS, "[vulkan] failed to create fence");
 		}
 	}
 
@@ -788,7 +823,7 @@ namespace vks
 			colorImageView.subresourceRange.layerCount = 1;
 			colorImageView.image = frameBufferData->colorImages[i];
 
-			if (vkCreateImageView(vkBackends->device, &colorImageView, nullptr, &frameBufferData->colorImageViews[i]) != VK_SUCCESS)
+			if (vkCreateImageView(vkBackends->device, &colorImageView, vkBackends->pAllocator, &frameBufferData->colorImageViews[i]) != VK_SUCCESS)
 			{
 				LVN_CORE_ERROR("[vulkan] failed to create image view <VkImageView> when creating framebuffer at (%p)", frameBuffer);
 				return Lvn_Result_Failure;
@@ -834,7 +869,7 @@ namespace vks
 			depthStencilView.subresourceRange.layerCount = 1;
 
 			depthStencilView.image = frameBufferData->depthImage;
-			if (vkCreateImageView(vkBackends->device, &depthStencilView, nullptr, &frameBufferData->depthImageView) != VK_SUCCESS)
+			if (vkCreateImageView(vkBackends->device, &depthStencilView, vkBackends->pAllocator, &frameBufferData->depthImageView) != VK_SUCCESS)
 			{
 				LVN_CORE_ERROR("[vulkan] failed to create image view <VkImageView> when creating frambuffer at (%p)", frameBuffer);
 				return Lvn_Result_Failure;
@@ -881,7 +916,7 @@ namespace vks
 				colorImageView.subresourceRange.layerCount = 1;
 				colorImageView.image = frameBufferData->msaaColorImages[i];
 
-				if (vkCreateImageView(vkBackends->device, &colorImageView, nullptr, &frameBufferData->msaaColorImageViews[i]) != VK_SUCCESS)
+				if (vkCreateImageView(vkBackends->device, &colorImageView, vkBackends->pAllocator, &frameBufferData->msaaColorImageViews[i]) != VK_SUCCESS)
 				{
 					LVN_CORE_ERROR("[vulkan] failed to create image view <VkImageView> when creating framebuffer at (%p)", frameBuffer);
 					return Lvn_Result_Failure;
@@ -908,7 +943,7 @@ namespace vks
 		fbufCreateInfo.height = frameBufferData->height;
 		fbufCreateInfo.layers = 1;
 
-		if (vkCreateFramebuffer(vkBackends->device, &fbufCreateInfo, nullptr, &frameBufferData->framebuffer) != VK_SUCCESS)
+		if (vkCreateFramebuffer(vkBackends->device, &fbufCreateInfo, vkBackends->pAllocator, &frameBufferData->framebuffer) != VK_SUCCESS)
 		{
 			LVN_CORE_ERROR("[vulkan] failed to create offscreen framebuffer <VkFrameBuffer> when creating framebuffer object at (%p)", frameBuffer);
 			return Lvn_Result_Failure;
@@ -922,21 +957,21 @@ namespace vks
 		// swap chain images
 		for (uint32_t i = 0; i < surfaceData->swapChainImageViews.size(); i++)
 		{
-			vkDestroyImageView(vkBackends->device, surfaceData->swapChainImageViews[i], nullptr);
+			vkDestroyImageView(vkBackends->device, surfaceData->swapChainImageViews[i], vkBackends->pAllocator);
 		}
 
-		vkDestroyImageView(vkBackends->device, surfaceData->depthImageView, nullptr);
-		vkDestroyImage(vkBackends->device, surfaceData->depthImage, nullptr);
+		vkDestroyImageView(vkBackends->device, surfaceData->depthImageView, vkBackends->pAllocator);
+		vkDestroyImage(vkBackends->device, surfaceData->depthImage, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, surfaceData->depthImageMemory);
 
 		// frame buffers
 		for (uint32_t i = 0; i < surfaceData->frameBuffers.size(); i++)
 		{
-			vkDestroyFramebuffer(vkBackends->device, surfaceData->frameBuffers[i], nullptr);
+			vkDestroyFramebuffer(vkBackends->device, surfaceData->frameBuffers[i], vkBackends->pAllocator);
 		}
 
 		// swap chain
-		vkDestroySwapchainKHR(vkBackends->device, surfaceData->swapChain, nullptr);
+		vkDestroySwapchainKHR(vkBackends->device, surfaceData->swapChain, vkBackends->pAllocator);
 	}
 
 	static void recreateSwapChain(VulkanBackends* vkBackends, LvnWindow* window)
@@ -1486,7 +1521,7 @@ namespace vks
 			pipelineLayoutInfo.pPushConstantRanges = nullptr;
 		}
 
-		LVN_CORE_CALL_ASSERT(vkCreatePipelineLayout(vkBackends->device, &pipelineLayoutInfo, nullptr, &pipeline.pipelineLayout) == VK_SUCCESS, "[vulkan] failed to create pipeline layout!");
+		LVN_CORE_CALL_ASSERT(vkCreatePipelineLayout(vkBackends->device, &pipelineLayoutInfo, vkBackends->pAllocator, &pipeline.pipelineLayout) == VK_SUCCESS, "[vulkan] failed to create pipeline layout!");
 
 		VkGraphicsPipelineCreateInfo pipelineInfo{};
 		pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -1506,7 +1541,7 @@ namespace vks
 		pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 		pipelineInfo.basePipelineIndex = -1;
 
-		LVN_CORE_CALL_ASSERT(vkCreateGraphicsPipelines(vkBackends->device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline.pipeline) == VK_SUCCESS, "[vulkan] failed to create graphics pipeline!");
+		LVN_CORE_CALL_ASSERT(vkCreateGraphicsPipelines(vkBackends->device, VK_NULL_HANDLE, 1, &pipelineInfo, vkBackends->pAllocator, &pipeline.pipeline) == VK_SUCCESS, "[vulkan] failed to create graphics pipeline!");
 
 		return pipeline;
 	}
@@ -1519,13 +1554,14 @@ namespace vks
 		createInfo.pCode = code;
 		
 		VkShaderModule shaderModule;
-		LVN_CORE_CALL_ASSERT(vkCreateShaderModule(vkBackends->device, &createInfo, nullptr, &shaderModule) == VK_SUCCESS, "[vulkan] failed to create shader module!");
+		LVN_CORE_CALL_ASSERT(vkCreateShaderModule(vkBackends->device, &createInfo, vkBackends->pAllocator, &shaderModule) == VK_SUCCESS, "[vulkan] failed to create shader module!");
 
 		return shaderModule;
 	}
 
 	static LvnResult compileShaderToSPIRV(EShLanguage stage, const char* shaderSource, std::vector<uint32_t>& bin)
 	{
+		LVN_PROFILE_FUNCTION();
 		TBuiltInResource builtInResources{};
 		builtInResources.maxLights                                 = 32;
 		builtInResources.maxClipPlanes                             = 6;
@@ -1701,6 +1737,7 @@ namespace vks
 
 	void copyBuffer(VulkanBackends* vkBackends, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset, VkDeviceSize dstOffset)
 	{
+		LVN_PROFILE_SCOPE("vks::copyBuffer");
 		VkCommandBufferAllocateInfo allocInfo{};
 		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
@@ -1913,7 +1950,7 @@ void createVulkanWindowSurfaceData(LvnWindow* window)
 	VulkanWindowSurfaceData* surfaceData = static_cast<VulkanWindowSurfaceData*>(window->apiData);
 	bool vSync = window->data.vSync;
 
-	LVN_CORE_CALL_ASSERT(glfwCreateWindowSurface(vkBackends->instance, glfwWindow, nullptr, &surfaceData->surface) == VK_SUCCESS, "[vulkan] failed to create temporary window surface at (%p)", surfaceData->surface);
+	LVN_CORE_CALL_ASSERT(glfwCreateWindowSurface(vkBackends->instance, glfwWindow, vkBackends->pAllocator, &surfaceData->surface) == VK_SUCCESS, "[vulkan] failed to create temporary window surface at (%p)", surfaceData->surface);
 
 	// get and check swap chain specs
 	VulkanSwapChainSupportDetails swapChainSupport = vks::querySwapChainSupport(surfaceData->surface, vkBackends->physicalDevice);
@@ -1948,35 +1985,35 @@ void destroyVulkanWindowSurfaceData(LvnWindow* window)
 	// sync objects
 	for (uint32_t i = 0; i < vkBackends->maxFramesInFlight; i++)
 	{
-		vkDestroySemaphore(vkBackends->device, surfaceData->imageAvailableSemaphores[i], nullptr);
-		vkDestroySemaphore(vkBackends->device, surfaceData->renderFinishedSemaphores[i], nullptr);
-		vkDestroyFence(vkBackends->device, surfaceData->inFlightFences[i], nullptr);
+		vkDestroySemaphore(vkBackends->device, surfaceData->imageAvailableSemaphores[i], vkBackends->pAllocator);
+		vkDestroySemaphore(vkBackends->device, surfaceData->renderFinishedSemaphores[i], vkBackends->pAllocator);
+		vkDestroyFence(vkBackends->device, surfaceData->inFlightFences[i], vkBackends->pAllocator);
 	}
 
 	// swap chain images
 	for (uint32_t i = 0; i < surfaceData->swapChainImageViews.size(); i++)
 	{
-		vkDestroyImageView(vkBackends->device, surfaceData->swapChainImageViews[i], nullptr);
+		vkDestroyImageView(vkBackends->device, surfaceData->swapChainImageViews[i], vkBackends->pAllocator);
 	}
 
-	vkDestroyImageView(vkBackends->device, surfaceData->depthImageView, nullptr);
-    vkDestroyImage(vkBackends->device, surfaceData->depthImage, nullptr);
+	vkDestroyImageView(vkBackends->device, surfaceData->depthImageView, vkBackends->pAllocator);
+    vkDestroyImage(vkBackends->device, surfaceData->depthImage, vkBackends->pAllocator);
 	vmaFreeMemory(vkBackends->vmaAllocator, surfaceData->depthImageMemory);
 
 	// frame buffers
 	for (uint32_t i = 0; i < surfaceData->frameBuffers.size(); i++)
 	{
-		vkDestroyFramebuffer(vkBackends->device, surfaceData->frameBuffers[i], nullptr);
+		vkDestroyFramebuffer(vkBackends->device, surfaceData->frameBuffers[i], vkBackends->pAllocator);
 	}
 
 	// swap chain
-	vkDestroySwapchainKHR(vkBackends->device, surfaceData->swapChain, nullptr);
+	vkDestroySwapchainKHR(vkBackends->device, surfaceData->swapChain, vkBackends->pAllocator);
 
 	// render pass
-	vkDestroyRenderPass(vkBackends->device, surfaceData->renderPass, nullptr);
+	vkDestroyRenderPass(vkBackends->device, surfaceData->renderPass, vkBackends->pAllocator);
 
 	// window surface
-	vkDestroySurfaceKHR(vkBackends->instance, surfaceData->surface, nullptr);
+	vkDestroySurfaceKHR(vkBackends->instance, surfaceData->surface, vkBackends->pAllocator);
 
 	delete static_cast<VulkanWindowSurfaceData*>(window->apiData);
 }
@@ -1994,6 +2031,19 @@ LvnResult vksImplCreateContext(LvnGraphicsContext* graphicsContext)
 	vkBackends->enableValidationLayers = graphicsContext->enableValidationLayers;
 	vkBackends->maxFramesInFlight = graphicsContext->maxFramesInFlight;
 
+	// allocation callbacks, vulkan uses its own allocator when pAllocator is nullptr
+	vkBackends->pAllocator = nullptr;
+	if (LvnAllocationCallbacks* allocCallbacks = lvn::memGetAllocationCallbacks())
+	{
+		vkBackends->allocationCallbacks.pUserData = allocCallbacks;
+		vkBackends->allocationCallbacks.pfnAllocation = vks::allocationCallback;
+		vkBackends->allocationCallbacks.pfnReallocation = vks::reallocationCallback;
+		vkBackends->allocationCallbacks.pfnFree = vks::freeCallback;
+		vkBackends->allocationCallbacks.pfnInternalAllocation = nullptr;
+		vkBackends->allocationCallbacks.pfnInternalFree = nullptr;
+		vkBackends->pAllocator = &vkBackends->allocationCallbacks;
+	}
+
 	switch (graphicsContext->frameBufferColorFormat)
 	{
 		case Lvn_TextureFormat_Unorm: { vkBackends->frameBufferColorFormat = VK_FORMAT_B8G8R8A8_UNORM; break; }
@@ -2063,6 +2113,14 @@ LvnResult vksImplCreateContext(LvnGraphicsContext* graphicsContext)
 	graphicsContext->frameBufferSetClearColor = vksImplFrameBufferSetClearColor;
 	graphicsContext->findSupportedDepthImageFormat = vksImplFindSupportedDepthImageFormat;
 
+	graphicsContext->gpuTimingCreate = vksImplGpuTimingCreate;
+	graphicsContext->gpuTimingDestroy = vksImplGpuTimingDestroy;
+	graphicsContext->gpuTimingCmdResetFrame = vksImplGpuTimingCmdResetFrame;
+	graphicsContext->gpuTimingCmdWriteTimestamp = vksImplGpuTimingCmdWriteTimestamp;
+	graphicsContext->gpuTimingCmdBeginStatistics = vksImplGpuTimingCmdBeginStatistics;
+	graphicsContext->gpuTimingCmdEndStatistics = vksImplGpuTimingCmdEndStatistics;
+	graphicsContext->gpuTimingGetResults = vksImplGpuTimingGetResults;
+
 	// Create Vulkan Instance
 	if (vks::createVulkanInstace(vkBackends, graphicsContext->enableValidationLayers) != Lvn_Result_Success)
 	{
@@ -2081,21 +2139,21 @@ void vksImplTerminateContext()
 	{
 		vkDeviceWaitIdle(vkBackends->device);
 
-		vkDestroyCommandPool(vkBackends->device, vkBackends->commandPool, nullptr);
+		vkDestroyCommandPool(vkBackends->device, vkBackends->commandPool, vkBackends->pAllocator);
 
 		// VmaAllocator
 		vmaDestroyAllocator(vkBackends->vmaAllocator);
 
 		// logical device
-		vkDestroyDevice(vkBackends->device, nullptr);
+		vkDestroyDevice(vkBackends->device, vkBackends->pAllocator);
 
 		// debug validation layers
 		if (vkBackends->enableValidationLayers)
-			vks::destroyDebugUtilsMessengerEXT(vkBackends->instance, vkBackends->debugMessenger, nullptr);
+			vks::destroyDebugUtilsMessengerEXT(vkBackends->instance, vkBackends->debugMessenger, vkBackends->pAllocator);
 	}
 
 	// instance
-	vkDestroyInstance(vkBackends->instance, nullptr);
+	vkDestroyInstance(vkBackends->instance, vkBackends->pAllocator);
 
 	delete s_VkBackends;
 }
@@ -2153,7 +2211,7 @@ LvnResult vksImplCheckPhysicalDeviceSupport(LvnPhysicalDevice* physicalDevice)
 	VkSurfaceKHR surface;
 	GLFWwindow* glfwWindow = glfwCreateWindow(1, 1, "", nullptr, nullptr);
 
-	if (glfwCreateWindowSurface(vkBackends->instance, glfwWindow, nullptr, &surface) != VK_SUCCESS)
+	if (glfwCreateWindowSurface(vkBackends->instance, glfwWindow, vkBackends->pAllocator, &surface) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] check physical device support, failed to create temporary window surface at (%p) when checking physical device support", surface);
 		return Lvn_Result_Failure;
@@ -2176,7 +2234,7 @@ LvnResult vksImplCheckPhysicalDeviceSupport(LvnPhysicalDevice* physicalDevice)
 		return Lvn_Result_Failure;
 	}
 
-	vkDestroySurfaceKHR(vkBackends->instance, surface, nullptr);
+	vkDestroySurfaceKHR(vkBackends->instance, surface, vkBackends->pAllocator);
 	glfwDestroyWindow(glfwWindow);
 	glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
 
@@ -2211,7 +2269,7 @@ LvnResult vksImplRenderInit(LvnRenderInitInfo* renderInfo)
 	VkSurfaceKHR surface;
 	GLFWwindow* glfwWindow = glfwCreateWindow(1, 1, "", nullptr, nullptr);
 
-	if (glfwCreateWindowSurface(vkBackends->instance, glfwWindow, nullptr, &surface) != VK_SUCCESS)
+	if (glfwCreateWindowSurface(vkBackends->instance, glfwWindow, vkBackends->pAllocator, &surface) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create temporary window surface at (%p)", surface);
 		return Lvn_Result_Failure;
@@ -2225,7 +2283,7 @@ LvnResult vksImplRenderInit(LvnRenderInitInfo* renderInfo)
 	LVN_CORE_ASSERT(!swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty(), "[vulkan] selected physical device does not have supported swap chain formats or present modes");
 
 	// destroy dummy window and surface
-	vkDestroySurfaceKHR(vkBackends->instance, surface, nullptr);
+	vkDestroySurfaceKHR(vkBackends->instance, surface, vkBackends->pAllocator);
 	glfwDestroyWindow(glfwWindow);
 	glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
 
@@ -2235,7 +2293,7 @@ LvnResult vksImplRenderInit(LvnRenderInitInfo* renderInfo)
 	poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 	poolInfo.queueFamilyIndex = vkBackends->deviceIndices.graphicsIndex;
 
-	LVN_CORE_CALL_ASSERT(vkCreateCommandPool(vkBackends->device, &poolInfo, nullptr, &vkBackends->commandPool) == VK_SUCCESS, "[vulkan] failed to create command pool!");
+	LVN_CORE_CALL_ASSERT(vkCreateCommandPool(vkBackends->device, &poolInfo, vkBackends->pAllocator, &vkBackends->commandPool) == VK_SUCCESS, "[vulkan] failed to create command pool!");
 
 
 	// create VmaAllocator
@@ -2243,6 +2301,7 @@ LvnResult vksImplRenderInit(LvnRenderInitInfo* renderInfo)
 	allocatorInfo.device = vkBackends->device;
 	allocatorInfo.physicalDevice = vkBackends->physicalDevice;
 	allocatorInfo.instance = vkBackends->instance;
+	allocatorInfo.pAllocationCallbacks = vkBackends->pAllocator;
 
 	vmaCreateAllocator(&allocatorInfo, &vkBackends->vmaAllocator);
 
@@ -2620,7 +2679,7 @@ LvnResult vksImplCreateDescriptorLayout(LvnDescriptorLayout* descriptorLayout, L
 	layoutInfo.pBindings = layoutBindings.data();
 
 	VkDescriptorSetLayout vkDescriptorLayout;
-	if (vkCreateDescriptorSetLayout(vkBackends->device, &layoutInfo, nullptr, &vkDescriptorLayout) != VK_SUCCESS)
+	if (vkCreateDescriptorSetLayout(vkBackends->device, &layoutInfo, vkBackends->pAllocator, &vkDescriptorLayout) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create descriptor set layout <VkDescriptorSetLayout> at (%p)", vkDescriptorLayout);
 		return Lvn_Result_Failure;
@@ -2634,7 +2693,7 @@ LvnResult vksImplCreateDescriptorLayout(LvnDescriptorLayout* descriptorLayout, L
 
 	VkDescriptorPool descriptorPool;
 
-	if (vkCreateDescriptorPool(vkBackends->device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS)
+	if (vkCreateDescriptorPool(vkBackends->device, &poolInfo, vkBackends->pAllocator, &descriptorPool) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create descriptor pool at (%p)", descriptorPool);
 		return Lvn_Result_Failure;
@@ -2904,7 +2963,7 @@ LvnResult vksImplCreateFrameBuffer(LvnFrameBuffer* frameBuffer, LvnFrameBufferCr
 	renderPassInfo.pDependencies = dependencies;
 
 	VkRenderPass renderPass;
-	if (vkCreateRenderPass(vkBackends->device, &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS)
+	if (vkCreateRenderPass(vkBackends->device, &renderPassInfo, vkBackends->pAllocator, &renderPass) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create render pass <VkRenderPass> (%p) when creating framebuffer at (%p)", renderPass, frameBuffer);
 		return Lvn_Result_Failure;
@@ -2928,7 +2987,7 @@ LvnResult vksImplCreateFrameBuffer(LvnFrameBuffer* frameBuffer, LvnFrameBufferCr
 	samplerCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
 
 	VkSampler sampler;
-	if (vkCreateSampler(vkBackends->device, &samplerCreateInfo, nullptr, &sampler) != VK_SUCCESS)
+	if (vkCreateSampler(vkBackends->device, &samplerCreateInfo, vkBackends->pAllocator, &sampler) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create sampler <VkSampler> (%p) when creating framebuffer at (%p)", sampler, frameBuffer);
 		return Lvn_Result_Failure;
@@ -3033,7 +3092,7 @@ LvnResult vksImplCreateBuffer(LvnBuffer* buffer, LvnBufferCreateInfo* createInfo
 		vks::createBuffer(vkBackends, &vkBuffer, &bufferMemory, bufferSize, bufferUsage, VMA_MEMORY_USAGE_GPU_ONLY);
 		vks::copyBuffer(vkBackends, stagingBuffer, vkBuffer, bufferSize, 0, 0);
 
-		vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
+		vkDestroyBuffer(vkBackends->device, stagingBuffer, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, stagingMemory);
 
 		// copy data to buffer object
@@ -3132,7 +3191,7 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, LvnTextureCreateInfo* create
 	viewInfo.subresourceRange.layerCount = 1;
 
 	VkImageView imageView;
-	if (vkCreateImageView(vkBackends->device, &viewInfo, nullptr, &imageView) != VK_SUCCESS)
+	if (vkCreateImageView(vkBackends->device, &viewInfo, vkBackends->pAllocator, &imageView) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create texture image view <VkImageView> for texture (%p)", texture);
 		return Lvn_Result_Failure;
@@ -3172,7 +3231,7 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, LvnTextureCreateInfo* create
 
 	VkSampler textureSampler;
 
-	if (vkCreateSampler(vkBackends->device, &samplerInfo, nullptr, &textureSampler) != VK_SUCCESS)
+	if (vkCreateSampler(vkBackends->device, &samplerInfo, vkBackends->pAllocator, &textureSampler) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("[vulkan] failed to create texture sampler <VkSampler> for texture (%p)", texture);
 		return Lvn_Result_Failure;
@@ -3184,7 +3243,7 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, LvnTextureCreateInfo* create
 	texture->imageView = imageView;
 	texture->sampler = textureSampler;
 
-	vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
+	vkDestroyBuffer(vkBackends->device, stagingBuffer, vkBackends->pAllocator);
 	vmaFreeMemory(vkBackends->vmaAllocator, stagingBufferMemory);
 
 	return Lvn_Result_Success;
@@ -3255,7 +3314,7 @@ LvnResult vksImplCreateCubemap(LvnCubemap* cubemap, LvnCubemapCreateInfo* create
 
 	vks::transitionImageLayout(vkBackends, cubemapImage, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 6);
 
-	vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
+	vkDestroyBuffer(vkBackends->device, stagingBuffer, vkBackends->pAllocator);
 	vmaFreeMemory(vmaAllocator, stagingBufferMemory);
 
 	// image view
@@ -3271,7 +3330,7 @@ LvnResult vksImplCreateCubemap(LvnCubemap* cubemap, LvnCubemapCreateInfo* create
 	viewInfo.subresourceRange.layerCount = 6;
 
 	VkImageView cubemapImageView;
-	if (vkCreateImageView(vkBackends->device, &viewInfo, nullptr, &cubemapImageView) != VK_SUCCESS)
+	if (vkCreateImageView(vkBackends->device, &viewInfo, vkBackends->pAllocator, &cubemapImageView) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("failed to create texture image view <VkImageView> when creating cubemap at (%p)", cubemap);
 		return Lvn_Result_Failure;
@@ -3299,7 +3358,7 @@ LvnResult vksImplCreateCubemap(LvnCubemap* cubemap, LvnCubemapCreateInfo* create
 	}
 
 	VkSampler cubemapSampler;
-	if (vkCreateSampler(vkBackends->device, &sampler, nullptr, &cubemapSampler) != VK_SUCCESS)
+	if (vkCreateSampler(vkBackends->device, &sampler, vkBackends->pAllocator, &cubemapSampler) != VK_SUCCESS)
 	{
 		LVN_CORE_ERROR("failed to create image sampler when creating cubemap at (%p)", cubemap);
 		return Lvn_Result_Failure;
@@ -3322,8 +3381,8 @@ void vksImplDestroyShader(LvnShader* shader)
 
 	VkShaderModule vertShaderModule = static_cast<VkShaderModule>(shader->nativeVertexShaderModule);
 	VkShaderModule fragShaderModule = static_cast<VkShaderModule>(shader->nativeFragmentShaderModule);
-	vkDestroyShaderModule(vkBackends->device, fragShaderModule, nullptr);
-	vkDestroyShaderModule(vkBackends->device, vertShaderModule, nullptr);
+	vkDestroyShaderModule(vkBackends->device, fragShaderModule, vkBackends->pAllocator);
+	vkDestroyShaderModule(vkBackends->device, vertShaderModule, vkBackends->pAllocator);
 }
 
 void vksImplDestroyDescriptorLayout(LvnDescriptorLayout* descriptorLayout)
@@ -3333,8 +3392,8 @@ void vksImplDestroyDescriptorLayout(LvnDescriptorLayout* descriptorLayout)
 	VkDescriptorSetLayout vkDescriptorLayout = static_cast<VkDescriptorSetLayout>(descriptorLayout->descriptorLayout);
 	VkDescriptorPool descriptorPool = static_cast<VkDescriptorPool>(descriptorLayout->descriptorPool);
 
-	vkDestroyDescriptorPool(vkBackends->device, descriptorPool, nullptr);
-	vkDestroyDescriptorSetLayout(vkBackends->device, vkDescriptorLayout, nullptr);
+	vkDestroyDescriptorPool(vkBackends->device, descriptorPool, vkBackends->pAllocator);
+	vkDestroyDescriptorSetLayout(vkBackends->device, vkDescriptorLayout, vkBackends->pAllocator);
 }
 
 void vksImplDestroyDescriptorSet(LvnDescriptorSet* descriptorSet)
@@ -3350,8 +3409,8 @@ void vksImplDestroyPipeline(LvnPipeline* pipeline)
 	VkPipeline vkPipeline = static_cast<VkPipeline>(pipeline->nativePipeline);
 	VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(pipeline->nativePipelineLayout);
 
-	vkDestroyPipeline(vkBackends->device, vkPipeline, nullptr);
-    vkDestroyPipelineLayout(vkBackends->device, vkPipelineLayout, nullptr);
+	vkDestroyPipeline(vkBackends->device, vkPipeline, vkBackends->pAllocator);
+    vkDestroyPipelineLayout(vkBackends->device, vkPipelineLayout, vkBackends->pAllocator);
 }
 
 void vksImplDestroyFrameBuffer(LvnFrameBuffer* frameBuffer)
@@ -3363,15 +3422,15 @@ void vksImplDestroyFrameBuffer(LvnFrameBuffer* frameBuffer)
 
 	for (uint32_t i = 0; i < frameBufferData->colorAttachments.size(); i++)
 	{
-		vkDestroyImage(vkBackends->device, frameBufferData->colorImages[i], nullptr);
-		vkDestroyImageView(vkBackends->device, frameBufferData->colorImageViews[i], nullptr);
+		vkDestroyImage(vkBackends->device, frameBufferData->colorImages[i], vkBackends->pAllocator);
+		vkDestroyImageView(vkBackends->device, frameBufferData->colorImageViews[i], vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->colorImageMemory[i]);
 	}
 
 	if (frameBufferData->hasDepth)
 	{
-		vkDestroyImage(vkBackends->device, frameBufferData->depthImage, nullptr);
-		vkDestroyImageView(vkBackends->device, frameBufferData->depthImageView, nullptr);
+		vkDestroyImage(vkBackends->device, frameBufferData->depthImage, vkBackends->pAllocator);
+		vkDestroyImageView(vkBackends->device, frameBufferData->depthImageView, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->depthImageMemory);
 	}
 
@@ -3379,15 +3438,15 @@ void vksImplDestroyFrameBuffer(LvnFrameBuffer* frameBuffer)
 	{
 		for (uint32_t i = 0; i < frameBufferData->colorAttachments.size(); i++)
 		{
-			vkDestroyImage(vkBackends->device, frameBufferData->msaaColorImages[i], nullptr);
-			vkDestroyImageView(vkBackends->device, frameBufferData->msaaColorImageViews[i], nullptr);
+			vkDestroyImage(vkBackends->device, frameBufferData->msaaColorImages[i], vkBackends->pAllocator);
+			vkDestroyImageView(vkBackends->device, frameBufferData->msaaColorImageViews[i], vkBackends->pAllocator);
 			vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->msaaColorImageMemory[i]);
 		}
 	}
 
-	vkDestroyRenderPass(vkBackends->device, frameBufferData->renderPass, nullptr);
-	vkDestroySampler(vkBackends->device, frameBufferData->sampler, nullptr);
-	vkDestroyFramebuffer(vkBackends->device, frameBufferData->framebuffer, nullptr);
+	vkDestroyRenderPass(vkBackends->device, frameBufferData->renderPass, vkBackends->pAllocator);
+	vkDestroySampler(vkBackends->device, frameBufferData->sampler, vkBackends->pAllocator);
+	vkDestroyFramebuffer(vkBackends->device, frameBufferData->framebuffer, vkBackends->pAllocator);
 
 	delete frameBufferData;
 }
@@ -3406,9 +3465,9 @@ void vksImplDestroyBuffer(LvnBuffer* buffer)
 		VkBuffer indexBuffer = static_cast<VkBuffer>(buffer->indexBuffer);
 		VmaAllocation indexMemory = static_cast<VmaAllocation>(buffer->indexBufferMemory);
 
-		vkDestroyBuffer(vkBackends->device, vertexBuffer, nullptr);
+		vkDestroyBuffer(vkBackends->device, vertexBuffer, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, vertexMemory);
-		vkDestroyBuffer(vkBackends->device, indexBuffer, nullptr);
+		vkDestroyBuffer(vkBackends->device, indexBuffer, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, indexMemory);
 	}
 	else
@@ -3416,7 +3475,7 @@ void vksImplDestroyBuffer(LvnBuffer* buffer)
 		VkBuffer vkBuffer = static_cast<VkBuffer>(buffer->vertexBuffer);
 		VmaAllocation bufferMemory = static_cast<VmaAllocation>(buffer->vertexBufferMemory);
 
-		vkDestroyBuffer(vkBackends->device, vkBuffer, nullptr);
+		vkDestroyBuffer(vkBackends->device, vkBuffer, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, bufferMemory);
 	}
 }
@@ -3428,7 +3487,7 @@ void vksImplDestroyUniformBuffer(LvnUniformBuffer* uniformBuffer)
 
 	VkBuffer vkUniformBuffer = static_cast<VkBuffer>(uniformBuffer->uniformBuffer);
 	VmaAllocation uniformBufferMemory = static_cast<VmaAllocation>(uniformBuffer->uniformBufferMemory);
-	vkDestroyBuffer(vkBackends->device, vkUniformBuffer, nullptr);
+	vkDestroyBuffer(vkBackends->device, vkUniformBuffer, vkBackends->pAllocator);
 	vmaUnmapMemory(vkBackends->vmaAllocator, uniformBufferMemory);
 	vmaFreeMemory(vkBackends->vmaAllocator, uniformBufferMemory);
 }
@@ -3443,10 +3502,10 @@ void vksImplDestroyTexture(LvnTexture* texture)
 	VkImageView imageView = static_cast<VkImageView>(texture->imageView);
 	VkSampler textureSampler = static_cast<VkSampler>(texture->sampler);
 
-	vkDestroyImage(vkBackends->device, image, nullptr);
+	vkDestroyImage(vkBackends->device, image, vkBackends->pAllocator);
 	vmaFreeMemory(vkBackends->vmaAllocator, imageMemory);;
-	vkDestroyImageView(vkBackends->device, imageView, nullptr);
-	vkDestroySampler(vkBackends->device, textureSampler, nullptr);
+	vkDestroyImageView(vkBackends->device, imageView, vkBackends->pAllocator);
+	vkDestroySampler(vkBackends->device, textureSampler, vkBackends->pAllocator);
 }
 
 void vksImplDestroyCubemap(LvnCubemap* cubemap)
@@ -3461,10 +3520,10 @@ void vksImplDestroyCubemap(LvnCubemap* cubemap)
 	VkImageView imageView = static_cast<VkImageView>(texture->imageView);
 	VkSampler textureSampler = static_cast<VkSampler>(texture->sampler);
 
-	vkDestroyImage(vkBackends->device, image, nullptr);
+	vkDestroyImage(vkBackends->device, image, vkBackends->pAllocator);
 	vmaFreeMemory(vkBackends->vmaAllocator, imageMemory);;
-	vkDestroyImageView(vkBackends->device, imageView, nullptr);
-	vkDestroySampler(vkBackends->device, textureSampler, nullptr);
+	vkDestroyImageView(vkBackends->device, imageView, vkBackends->pAllocator);
+	vkDestroySampler(vkBackends->device, textureSampler, vkBackends->pAllocator);
 }
 
 void vksImplBufferUpdateVertexData(LvnBuffer* buffer, void* vertices, uint32_t size, uint32_t offset)
@@ -3506,7 +3565,7 @@ void vksImplBufferResizeVertexBuffer(LvnBuffer* buffer, uint32_t size)
 	VkBuffer vertexBuffer = static_cast<VkBuffer>(buffer->vertexBuffer);
 	VmaAllocation vertexMemory = static_cast<VmaAllocation>(buffer->vertexBufferMemory);
 
-	vkDestroyBuffer(vkBackends->device, vertexBuffer, nullptr);
+	vkDestroyBuffer(vkBackends->device, vertexBuffer, vkBackends->pAllocator);
 	vmaFreeMemory(vmaAllocator, vertexMemory);
 
 	vks::createBuffer(vkBackends, &vertexBuffer, &vertexMemory, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
@@ -3522,7 +3581,7 @@ void vksImplBufferResizeIndexBuffer(LvnBuffer* buffer, uint32_t size)
 	VkBuffer indexBuffer = static_cast<VkBuffer>(buffer->indexBuffer);
 	VmaAllocation indexMemory = static_cast<VmaAllocation>(buffer->indexBufferMemory);
 
-	vkDestroyBuffer(vkBackends->device, indexBuffer, nullptr);
+	vkDestroyBuffer(vkBackends->device, indexBuffer, vkBackends->pAllocator);
 	vmaFreeMemory(vmaAllocator, indexMemory);
 
 	vks::createBuffer(vkBackends, &indexBuffer, &indexMemory, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
@@ -3604,15 +3663,15 @@ void vksImplFrameBufferResize(LvnFrameBuffer* frameBuffer, uint32_t width, uint3
 
 	for (uint32_t i = 0; i < frameBufferData->colorAttachments.size(); i++)
 	{
-		vkDestroyImage(vkBackends->device, frameBufferData->colorImages[i], nullptr);
-		vkDestroyImageView(vkBackends->device, frameBufferData->colorImageViews[i], nullptr);
+		vkDestroyImage(vkBackends->device, frameBufferData->colorImages[i], vkBackends->pAllocator);
+		vkDestroyImageView(vkBackends->device, frameBufferData->colorImageViews[i], vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->colorImageMemory[i]);
 	}
 
 	if (frameBufferData->hasDepth)
 	{
-		vkDestroyImage(vkBackends->device, frameBufferData->depthImage, nullptr);
-		vkDestroyImageView(vkBackends->device, frameBufferData->depthImageView, nullptr);
+		vkDestroyImage(vkBackends->device, frameBufferData->depthImage, vkBackends->pAllocator);
+		vkDestroyImageView(vkBackends->device, frameBufferData->depthImageView, vkBackends->pAllocator);
 		vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->depthImageMemory);
 	}
 
@@ -3620,13 +3679,13 @@ void vksImplFrameBufferResize(LvnFrameBuffer* frameBuffer, uint32_t width, uint3
 	{
 		for (uint32_t i = 0; i < frameBufferData->colorAttachments.size(); i++)
 		{
-			vkDestroyImage(vkBackends->device, frameBufferData->msaaColorImages[i], nullptr);
-			vkDestroyImageView(vkBackends->device, frameBufferData->msaaColorImageViews[i], nullptr);
+			vkDestroyImage(vkBackends->device, frameBufferData->msaaColorImages[i], vkBackends->pAllocator);
+			vkDestroyImageView(vkBackends->device, frameBufferData->msaaColorImageViews[i], vkBackends->pAllocator);
 			vmaFreeMemory(vkBackends->vmaAllocator, frameBufferData->msaaColorImageMemory[i]);
 		}
 	}
 
-	vkDestroyFramebuffer(vkBackends->device, frameBufferData->framebuffer, nullptr);
+	vkDestroyFramebuffer(vkBackends->device, frameBufferData->framebuffer, vkBackends->pAllocator);
 
 	frameBufferData->width = width;
 	frameBufferData->height = height;
@@ -3674,4 +3733,156 @@ LvnDepthImageFormat vksImplFindSupportedDepthImageFormat(LvnDepthImageFormat* pD
 	return pDepthImageFormats[0];
 }
 
+// statistics are returned in the order of the bits, which matches the members of LvnGpuPipelineStatistics
+static const VkQueryPipelineStatisticFlags s_GpuTimingStatisticFlags =
+	VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+	VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+	VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+	VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+	VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+	VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+
+LvnResult vksImplGpuTimingCreate(LvnWindow* window, LvnGpuTimingData* gpuTiming)
+{
+	VulkanBackends* vkBackends = s_VkBackends;
+
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(vkBackends->physicalDevice, &queueFamilyCount, nullptr);
+	std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(vkBackends->physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+	uint32_t validBits = vkBackends->deviceIndices.graphicsIndex < queueFamilyCount ? queueFamilies[vkBackends->deviceIndices.graphicsIndex].timestampValidBits : 0;
+	if (validBits == 0)
+	{
+		LVN_CORE_ERROR("[vulkan] graphics queue does not support timestamp queries, cannot time gpu regions");
+		return Lvn_Result_Failure;
+	}
+
+	if (gpuTiming->pipelineStatistics && !vkBackends->deviceSupportedFeatures.pipelineStatisticsQuery)
+	{
+		LVN_CORE_WARN("[vulkan] physical device does not support pipeline statistics queries, only timestamps will be collected");
+		gpuTiming->pipelineStatistics = false;
+	}
+
+	VulkanGpuTimingData* queryData = new (lvn::memAlloc(sizeof(VulkanGpuTimingData), Lvn_MemoryTag_Graphics)) VulkanGpuTimingData();
+	queryData->timestampMask = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+	queryData->timestampPeriod = static_cast<double>(vkBackends->deviceProperties.limits.timestampPeriod);
+
+	// the queries of a frame are reset when the frame comes around again, by then the frame in flight using the same command buffer has finished
+	gpuTiming->frames.resize(vkBackends->maxFramesInFlight + 1);
+	queryData->timestampPools.resize(gpuTiming->frames.size());
+	if (gpuTiming->pipelineStatistics) { queryData->statisticsPools.resize(gpuTiming->frames.size()); }
+
+	// pools that were not created stay VK_NULL_HANDLE, destroying them is a no-op
+	gpuTiming->queryData = queryData;
+
+	for (uint32_t i = 0; i < gpuTiming->frames.size(); i++)
+	{
+		VkQueryPoolCreateInfo queryPoolInfo{};
+		queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryPoolInfo.queryCount = LVN_GPU_TIMING_MAX_REGIONS * 2;
+		if (vkCreateQueryPool(vkBackends->device, &queryPoolInfo, vkBackends->pAllocator, &queryData->timestampPools[i]) != VK_SUCCESS)
+		{
+			LVN_CORE_ERROR("[vulkan] failed to create timestamp query pool");
+			vksImplGpuTimingDestroy(window, gpuTiming);
+			return Lvn_Result_Failure;
+		}
+
+		if (gpuTiming->pipelineStatistics)
+		{
+			queryPoolInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+			queryPoolInfo.queryCount = LVN_GPU_TIMING_MAX_REGIONS;
+			queryPoolInfo.pipelineStatistics = s_GpuTimingStatisticFlags;
+			if (vkCreateQueryPool(vkBackends->device, &queryPoolInfo, vkBackends->pAllocator, &queryData->statisticsPools[i]) != VK_SUCCESS)
+			{
+				LVN_CORE_ERROR("[vulkan] failed to create pipeline statistics query pool");
+				vksImplGpuTimingDestroy(window, gpuTiming);
+				return Lvn_Result_Failure;
+			}
+		}
+	}
+
+	return Lvn_Result_Success;
+}
+
+void vksImplGpuTimingDestroy(LvnWindow* window, LvnGpuTimingData* gpuTiming)
+{
+	VulkanBackends* vkBackends = s_VkBackends;
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+	if (!queryData) { return; }
+
+	vkDeviceWaitIdle(vkBackends->device);
+
+	for (VkQueryPool queryPool : queryData->timestampPools)
+		vkDestroyQueryPool(vkBackends->device, queryPool, vkBackends->pAllocator);
+	for (VkQueryPool queryPool : queryData->statisticsPools)
+		vkDestroyQueryPool(vkBackends->device, queryPool, vkBackends->pAllocator);
+
+	queryData->~VulkanGpuTimingData();
+	lvn::memFree(queryData);
+	gpuTiming->queryData = nullptr;
+}
+
+void vksImplGpuTimingCmdResetFrame(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex)
+{
+	VulkanWindowSurfaceData* surfaceData = static_cast<VulkanWindowSurfaceData*>(window->apiData);
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+	VkCommandBuffer commandBuffer = surfaceData->commandBuffers[surfaceData->currentFrame];
+
+	vkCmdResetQueryPool(commandBuffer, queryData->timestampPools[frameIndex], 0, LVN_GPU_TIMING_MAX_REGIONS * 2);
+	if (!queryData->statisticsPools.empty())
+		vkCmdResetQueryPool(commandBuffer, queryData->statisticsPools[frameIndex], 0, LVN_GPU_TIMING_MAX_REGIONS);
+}
+
+void vksImplGpuTimingCmdWriteTimestamp(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	VulkanWindowSurfaceData* surfaceData = static_cast<VulkanWindowSurfaceData*>(window->apiData);
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+
+	// written once all commands before it have completed, the start and end of a region are measured the same way
+	vkCmdWriteTimestamp(surfaceData->commandBuffers[surfaceData->currentFrame], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryData->timestampPools[frameIndex], queryIndex);
+}
+
+void vksImplGpuTimingCmdBeginStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	VulkanWindowSurfaceData* surfaceData = static_cast<VulkanWindowSurfaceData*>(window->apiData);
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+	vkCmdBeginQuery(surfaceData->commandBuffers[surfaceData->currentFrame], queryData->statisticsPools[frameIndex], queryIndex, 0);
+}
+
+void vksImplGpuTimingCmdEndStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex)
+{
+	VulkanWindowSurfaceData* surfaceData = static_cast<VulkanWindowSurfaceData*>(window->apiData);
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+	vkCmdEndQuery(surfaceData->commandBuffers[surfaceData->currentFrame], queryData->statisticsPools[frameIndex], queryIndex);
+}
+
+bool vksImplGpuTimingGetResults(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint64_t* pTimestampsNs, LvnGpuPipelineStatistics* pStatistics)
+{
+	VulkanBackends* vkBackends = s_VkBackends;
+	VulkanGpuTimingData* queryData = static_cast<VulkanGpuTimingData*>(gpuTiming->queryData);
+	const LvnGpuTimingFrame& frame = gpuTiming->frames[frameIndex];
+
+	// no wait flag, VK_NOT_READY is returned if the gpu has not finished the queries
+	if (frame.timestampCount > 0)
+	{
+		VkResult result = vkGetQueryPoolResults(vkBackends->device, queryData->timestampPools[frameIndex], 0, frame.timestampCount,
+			frame.timestampCount * sizeof(uint64_t), pTimestampsNs, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+		if (result != VK_SUCCESS) { return false; }
+
+		for (uint32_t i = 0; i < frame.timestampCount; i++)
+			pTimestampsNs[i] = static_cast<uint64_t>(static_cast<double>(pTimestampsNs[i] & queryData->timestampMask) * queryData->timestampPeriod);
+	}
+
+	if (frame.statisticsCount > 0 && !queryData->statisticsPools.empty())
+	{
+		VkResult result = vkGetQueryPoolResults(vkBackends->device, queryData->statisticsPools[frameIndex], 0, frame.statisticsCount,
+			frame.statisticsCount * sizeof(LvnGpuPipelineStatistics), pStatistics, sizeof(LvnGpuPipelineStatistics), VK_QUERY_RESULT_64_BIT);
+		if (result != VK_SUCCESS) { return false; }
+	}
+
+	return true;
+}
+
 } /* namespace lvn */
@@ -65,6 +65,14 @@ namespace lvn
 	void vksImplFrameBufferSetClearColor(LvnFrameBuffer* frameBuffer, uint32_t attachmentIndex, float r, float g, float b, float a);
 
 	LvnDepthImageFormat vksImplFindSupportedDepthImageFormat(LvnDepthImageFormat* pDepthImageFormats, uint32_t count);
+
+	LvnResult vksImplGpuTimingCreate(LvnWindow* window, LvnGpuTimingData* gpuTiming);
+	void vksImplGpuTimingDestroy(LvnWindow* window, LvnGpuTimingData* gpuTiming);
+	void vksImplGpuTimingCmdResetFrame(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex);
+	void vksImplGpuTimingCmdWriteTimestamp(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	void vksImplGpuTimingCmdBeginStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	void vksImplGpuTimingCmdEndStatistics(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint32_t queryIndex);
+	bool vksImplGpuTimingGetResults(LvnWindow* window, LvnGpuTimingData* gpuTiming, uint32_t frameIndex, uint64_t* pTimestampsNs, LvnGpuPipelineStatistics* pStatistics);
 }
 
 #endif
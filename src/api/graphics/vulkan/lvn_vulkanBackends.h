@@ -94,6 +94,14 @@ namespace lvn
 		uint32_t pushConstantCount;
 	};
 
+	struct VulkanGpuTimingData
+	{
+		std::vector<VkQueryPool> timestampPools;    // one pool for each frame of the gpu timing data
+		std::vector<VkQueryPool> statisticsPools;   // empty if pipeline statistics are not collected
+		uint64_t timestampMask;                     // timestamps only have timestampValidBits of the graphics queue
+		double timestampPeriod;                     // nanoseconds per timestamp tick
+	};
+
 	struct VulkanPipeline
 	{
 		VkPipeline pipeline;
@@ -119,6 +127,8 @@ namespace lvn
 
 		VkCommandPool                       commandPool;
 		VmaAllocator                        vmaAllocator;
+		VkAllocationCallbacks               allocationCallbacks;
+		const VkAllocationCallbacks*        pAllocator;            // nullptr when no allocation callbacks were set in the context
 
 		LvnPipelineSpecification            defaultPipelineSpecification;
 		bool                                gammaCorrect;
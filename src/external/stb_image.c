@@ -1,3 +1,14 @@
+#include <stddef.h>
+
+/* allocations are routed through the levikno context allocation callbacks, see levikno.cpp */
+void* lvn_stbiMalloc(size_t size);
+void* lvn_stbiRealloc(void* ptr, size_t size);
+void  lvn_stbiFree(void* ptr);
+
+#define STBI_MALLOC(sz)           lvn_stbiMalloc(sz)
+#define STBI_REALLOC(p, newsz)    lvn_stbiRealloc(p, newsz)
+#define STBI_FREE(p)              lvn_stbiFree(p)
+
 #define STB_IMAGE_IMPLEMENTATION
 #define STBI_NO_SIMD
 #include "stb_image.h"
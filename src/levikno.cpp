@@ -2,15 +2,47 @@
 #include "levikno_internal.h"
 
 #include <ctime>
+#include <cstddef>
 #include <unordered_map>
 
 #include "stb_image.h"
 #include "miniaudio.h"
 #include "freetype/freetype.h"
+#include "freetype/ftmodapi.h"
 #include "enet/enet.h"
 
 #ifdef LVN_PLATFORM_WINDOWS
 	#include <windows.h>
+	#include <mmsystem.h>
+	#include <io.h>
+
+	#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+		#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+	#endif
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+	#include <pthread.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define LVN_CLOCK_X86
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+		#include <x86intrin.h>
+	#endif
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+	#define LVN_CLOCK_ARM64
+#endif
+
+#if defined(LVN_PLATFORM_LINUX)
+	#include <sched.h>
+	#include <sys/resource.h>
+	#include <sys/syscall.h>
+#elif defined(LVN_PLATFORM_APPLE)
+	#include <pthread/qos.h>
 #endif
 
 #define LVN_ABORT throw std::bad_alloc{};
@@ -27,7 +59,43 @@
 
 #include "lvn_loadModel.h"
 
+#ifdef LVN_ENABLE_PROFILING
+	#include "json.h"
+	namespace nlm = nlohmann;
+#endif
+
 static LvnContext* s_LvnContext = nullptr;
+static uint32_t s_LvnContextCount = 0;
+static LvnClockCalibration s_LvnClock;
+static std::once_flag s_LvnClockOnce;
+
+#ifdef LVN_ENABLE_PROFILING
+static LvnProfiler s_LvnProfiler;
+#endif
+
+
+namespace lvn
+{
+static void*                        memAllocTagged(size_t size, LvnMemoryTag tag, bool zeroMemory);
+static void*                        memReallocTagged(void* ptr, size_t size, LvnMemoryTag tag);
+static void                         memFreeTagged(void* ptr);
+}
+
+// stb_image allocations are routed through these so that they use the context allocation callbacks and can be adopted by LvnData
+extern "C" void* lvn_stbiMalloc(size_t size)
+{
+	return lvn::memAllocTagged(size, Lvn_MemoryTag_Assets, false);
+}
+
+extern "C" void* lvn_stbiRealloc(void* ptr, size_t size)
+{
+	return lvn::memReallocTagged(ptr, size, Lvn_MemoryTag_Assets);
+}
+
+extern "C" void lvn_stbiFree(void* ptr)
+{
+	lvn::memFreeTagged(ptr);
+}
 
 
 // ------------------------------------------------------------
@@ -81,7 +149,46 @@ namespace lvn
 {
 
 static void                         enableLogANSIcodeColors();
-static std::vector<LvnLogPattern>   logParseFormat(const char* fmt);
+static LvnLogFormatter              logParseFormat(const char* fmt);
+static size_t                       logFormatMessage(const LvnLogFormatter* formatter, LvnLogMessage* msg, char* buffer, size_t size);
+static const struct tm*             logGetCachedTime(long long timeEpoch);
+static void                         logMessageArgs(LvnLogger* logger, LvnLogLevel level, const char* fmt, va_list args);
+static void                         logStartAsyncWriter(LvnContext* lvnctx, uint32_t queueSize, LvnLogOverflowPolicy overflowPolicy);
+static void                         logStopAsyncWriter(LvnContext* lvnctx);
+static void                         logAsyncWriterThread(LvnContext* lvnctx);
+static void                         logWaitForWriter(LvnLogAsyncWriter* writer, uint64_t written);
+static void                         logPushAsync(LvnContext* lvnctx, LvnLogger* logger, LvnLogLevel level, const char* msg, long long timeEpoch);
+static LvnLogSink*                  logCreateSink(const LvnLogSinkCreateInfo* sinkCreateInfo);
+static bool                         logSinkOpenFile(LvnLogSink* sink, const char* mode);
+static void                         logSinkFlushFile(LvnLogSink* sink);
+static void                         logSinkRotateFile(LvnLogSink* sink, long long timeEpoch);
+static void                         logSinkWrite(LvnLogSink* sink, LvnLogMessage* msg, const char* data, size_t length);
+static void                         logSinkWriteRing(LvnLogSink* sink, const char* data, size_t length);
+#ifdef LVN_ENABLE_PROFILING
+static LvnProfileThreadBuffer*      profileGetThreadBuffer();
+static void                         profileWriteTrace(FILE* file);
+#endif
+static uint64_t                     clockReadCounter();
+static bool                         clockHasConstantCounter();
+static void                         clockCalibrate();
+static void                         clockRebase(uint32_t sequence);
+static void                         setThreadPoolConfig(LvnThreadPoolConfig* config, const LvnThreadPoolCreateInfo* createInfo, const char* defaultName, const uint32_t* pReservedCores, uint32_t reservedCoreCount);
+static LvnThreadPool*               createThreadPool(const LvnThreadPoolConfig& config);
+static void                         destroyThreadPool(LvnThreadPool* threadPool);
+static LvnThreadPool*               getAssetThreadPool(LvnContext* lvnctx);
+static void                         framePacerRecordFrame(LvnFramePacer* framePacer, uint64_t now);
+static void                         framePacerSleep(LvnFramePacer* framePacer, uint64_t ns);
+static void                         gpuTimingBeginFrame(LvnContext* lvnctx, LvnWindow* window);
+static void                         gpuTimingEndFrame(LvnContext* lvnctx, LvnWindow* window);
+static void                         gpuTimingBeginRegion(LvnContext* lvnctx, LvnWindow* window, const char* name, LvnFrameBuffer* frameBuffer);
+static void                         gpuTimingEndRegion(LvnContext* lvnctx, LvnWindow* window);
+static LvnAssetLoad*                createAssetLoad(LvnAssetLoadType type, const char* filepath);
+static void                         assetLoadCreateModel(LvnContext* lvnctx, LvnAssetLoad* assetLoad);
+static bool                         logSinkPrepareFile(LvnLogSink* sink, size_t length, long long timeEpoch);
+static void                         logSinkWriteFile(LvnLogSink* sink, const char* data, size_t length);
+static void                         logMessageText(LvnLogger* logger, LvnLogLevel level, const char* msg, long long timeEpoch);
+static size_t                       logEncodeArgs(const char* fmt, va_list args, char* buffer, size_t size);
+static void                         logWriteBinary(LvnLogger* logger, LvnLogLevel level, const char* fmt, const char* args, size_t argSize, long long timeEpoch, uint64_t timeNs);
 static const char*                  getLogLevelColor(LvnLogLevel level);
 static const char*                  getLogLevelName(LvnLogLevel level);
 static const char*                  getWindowApiNameEnum(LvnWindowApi api);
@@ -94,16 +201,42 @@ static LvnResult                    initAudioContext(LvnContext* lvnctx);
 static void                         terminateAudioContext(LvnContext* lvnctx);
 static LvnResult                    initNetworkingContext();
 static void                         terminateNetworkingContext();
+static void*                        maAllocCallback(size_t size, void* userData);
+static void*                        maReallocCallback(void* ptr, size_t size, void* userData);
+static void                         maFreeCallback(void* ptr, void* userData);
+static void* ENET_CALLBACK          enetAllocCallback(size_t size);
+static void ENET_CALLBACK           enetFreeCallback(void* ptr);
+static void ENET_CALLBACK           enetNoMemoryCallback();
+static void                         setImageDataPixels(LvnImageData* imageData, uint8_t* pixels);
+static void*                        ftAllocCallback(FT_Memory memory, long size);
+static void*                        ftReallocCallback(FT_Memory memory, long currentSize, long newSize, void* block);
+static void                         ftFreeCallback(FT_Memory memory, void* block);
+static bool                         useLibraryAllocationHooks(LvnContext* lvnctx);
 static void                         initStandardPipelineSpecification(LvnContext* lvnctx);
 static void                         setDefaultStructTypeMemAllocInfos(LvnContext* lvnctx);
 static const char*                  getStructTypeEnumStr(LvnStructureType stype);
 static uint64_t                     getStructTypeSize(LvnStructureType sType);
 static void                         setMemoryBlockBindings(LvnMemoryPool* memPool, uint32_t blockIndex, LvnStructureTypeInfo* pStructInfos, uint32_t structInfoCount);
 static void                         createContextMemoryPool(LvnContext* lvnctx, LvnContextCreateInfo* createInfo);
-static void                         createBlockMemoryPool(LvnContext* lvnctx);
+static LvnResult                    createBlockMemoryPool(LvnContext* lvnctx, LvnStructureType sType, uint64_t count);
+static uint64_t                     memVirtualPageSize();
+static uint64_t                     memVirtualReserveSize(uint64_t size, bool hugePages);
+
+static LvnMemoryTag                 getStructTypeMemoryTag(LvnStructureType sType);
+static void                         memTagAddBytes(LvnContext* lvnctx, LvnMemoryTag tag, uint64_t size);
+static void                         memTagSubBytes(LvnContext* lvnctx, LvnMemoryTag tag, uint64_t size);
+static LvnMemAllocHeader*           memAllocHeader(size_t size, bool zeroMemory);
+static void                         memFreeHeader(LvnMemAllocHeader* header);
+static bool                         memIsCurrentAllocator(const LvnMemAllocHeader* header);
+static bool                         memIsCounted(const void* ptr);
+static void                         addAllocationRecord(LvnContext* lvnctx, void* ptr, const LvnAllocationRecord& record);
+static void                         removeAllocationRecord(LvnContext* lvnctx, void* ptr);
+static void                         createFrameArenas(LvnContext* lvnctx, uint64_t size);
+static void                         resetFrameArena(LvnFrameArena* arena);
+static void                         destroyFrameArenas(LvnContext* lvnctx);
 
 template <typename T>
-static T* createObject(LvnContext* lvnctx, LvnStructureType sType);
+static T* createObject(LvnContext* lvnctx, LvnStructureType sType, const char* site = __builtin_FUNCTION(), void* caller = LVN_RETURN_ADDRESS());
 
 template <typename T>
 static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType);
@@ -298,11 +431,40 @@ static void terminateGraphicsContext(LvnContext* lvnctx)
 	LVN_CORE_TRACE("graphics context terminated: %s", getGraphicsApiNameEnum(lvnctx->graphicsapi));
 }
 
+static void* maAllocCallback(size_t size, void* userData)
+{
+	(void)userData;
+	return lvn::memAllocTagged(size, Lvn_MemoryTag_Audio, false);
+}
+
+static void* maReallocCallback(void* ptr, size_t size, void* userData)
+{
+	(void)userData;
+	return lvn::memReallocTagged(ptr, size, Lvn_MemoryTag_Audio);
+}
+
+static void maFreeCallback(void* ptr, void* userData)
+{
+	(void)userData;
+	lvn::memFreeTagged(ptr);
+}
+
 static LvnResult initAudioContext(LvnContext* lvnctx)
 {
-	ma_engine* pEngine = (ma_engine*)lvn::memAlloc(sizeof(ma_engine));
+	ma_engine* pEngine = (ma_engine*)lvn::memAlloc(sizeof(ma_engine), Lvn_MemoryTag_Audio);
 
-	if (ma_engine_init(nullptr, pEngine) != MA_SUCCESS)
+	ma_engine_config engineConfig = ma_engine_config_init();
+
+	// miniaudio allocations go through the tagged allocators so they are counted under the audio tag, otherwise miniaudio uses malloc and free
+	if (lvn::useLibraryAllocationHooks(lvnctx))
+	{
+		engineConfig.allocationCallbacks.pUserData = nullptr;
+		engineConfig.allocationCallbacks.onMalloc = lvn::maAllocCallback;
+		engineConfig.allocationCallbacks.onRealloc = lvn::maReallocCallback;
+		engineConfig.allocationCallbacks.onFree = lvn::maFreeCallback;
+	}
+
+	if (ma_engine_init(&engineConfig, pEngine) != MA_SUCCESS)
 	{
 		LVN_CORE_ERROR("failed to initialize audio engine context");
 		return Lvn_Result_Failure;
@@ -325,9 +487,40 @@ static void terminateAudioContext(LvnContext* lvnctx)
 	LVN_CORE_TRACE("audio context terminated");
 }
 
+// the third party library hooks add a header and atomic counters to every allocation, they are only installed when allocation callbacks are set or library allocations are tracked
+static bool useLibraryAllocationHooks(LvnContext* lvnctx)
+{
+	return lvnctx && (lvnctx->allocationCallbacks.allocFn != nullptr || lvnctx->trackLibraryAllocations);
+}
+
+static void* ENET_CALLBACK enetAllocCallback(size_t size)
+{
+	return lvn::memAllocTagged(size, Lvn_MemoryTag_Network, false);
+}
+
+static void ENET_CALLBACK enetFreeCallback(void* ptr)
+{
+	lvn::memFreeTagged(ptr);
+}
+
+static void ENET_CALLBACK enetNoMemoryCallback()
+{
+	LVN_CORE_ERROR("[enet]: allocation callback failure, could not allocate memory!");
+	LVN_ABORT;
+}
+
 static LvnResult initNetworkingContext()
 {
-	if (enet_initialize() != 0)
+	// enet allocations go through the tagged allocators so they are counted under the network tag, otherwise enet uses malloc and free
+	ENetCallbacks enetCallbacks{};
+	if (lvn::useLibraryAllocationHooks(s_LvnContext))
+	{
+		enetCallbacks.malloc = lvn::enetAllocCallback;
+		enetCallbacks.free = lvn::enetFreeCallback;
+	}
+	enetCallbacks.no_memory = lvn::enetNoMemoryCallback;
+
+	if (enet_initialize_with_callbacks(ENET_VERSION, &enetCallbacks) != 0)
 	{
 		LVN_CORE_ERROR("failed to initialize networking context");
 		return Lvn_Result_Failure;
@@ -459,6 +652,62 @@ static uint64_t getStructTypeSize(LvnStructureType sType)
 	return lvn::getContext()->sTypeMemAllocInfos[sType].size;
 }
 
+static LvnMemoryTag getStructTypeMemoryTag(LvnStructureType sType)
+{
+	switch (sType)
+	{
+		case Lvn_Stype_FrameBuffer:
+		case Lvn_Stype_Shader:
+		case Lvn_Stype_DescriptorLayout:
+		case Lvn_Stype_DescriptorSet:
+		case Lvn_Stype_Pipeline:
+		case Lvn_Stype_Buffer:
+		case Lvn_Stype_UniformBuffer:
+		case Lvn_Stype_Texture:
+		case Lvn_Stype_Cubemap: { return Lvn_MemoryTag_Graphics; }
+		case Lvn_Stype_Sound:
+		case Lvn_Stype_SoundBoard: { return Lvn_MemoryTag_Audio; }
+		case Lvn_Stype_Socket: { return Lvn_MemoryTag_Network; }
+
+		default: { return Lvn_MemoryTag_Core; }
+	}
+}
+
+template <typename T>
+static void atomicStoreMax(std::atomic<T>& value, T newValue)
+{
+	T current = value.load(std::memory_order_relaxed);
+	while (current < newValue && !value.compare_exchange_weak(current, newValue, std::memory_order_relaxed)) {}
+}
+
+static void memTagAddBytes(LvnContext* lvnctx, LvnMemoryTag tag, uint64_t size)
+{
+	LvnMemoryTagCounts& counts = lvnctx->memoryTagCounts[tag];
+	counts.liveCount.fetch_add(1, std::memory_order_relaxed);
+	lvn::atomicStoreMax(counts.peakBytes, counts.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+	lvn::atomicStoreMax(lvnctx->totalPeakBytes, lvnctx->totalLiveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+static void memTagSubBytes(LvnContext* lvnctx, LvnMemoryTag tag, uint64_t size)
+{
+	LvnMemoryTagCounts& counts = lvnctx->memoryTagCounts[tag];
+	counts.liveCount.fetch_sub(1, std::memory_order_relaxed);
+	counts.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+	lvnctx->totalLiveBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+static void addAllocationRecord(LvnContext* lvnctx, void* ptr, const LvnAllocationRecord& record)
+{
+	std::lock_guard<std::mutex> lock(lvnctx->allocationRecordMutex);
+	lvnctx->allocationRecords[ptr] = record;
+}
+
+static void removeAllocationRecord(LvnContext* lvnctx, void* ptr)
+{
+	std::lock_guard<std::mutex> lock(lvnctx->allocationRecordMutex);
+	lvnctx->allocationRecords.erase(ptr);
+}
+
 static void setMemoryBlockBindings(LvnMemoryPool* memPool, uint32_t blockIndex, LvnStructureTypeInfo* pStructInfos, uint32_t structInfoCount)
 {
 	uint64_t memIndex = 0;
@@ -472,7 +721,7 @@ static void setMemoryBlockBindings(LvnMemoryPool* memPool, uint32_t blockIndex,
 			prevMemBinding = &memBinding.back();
 
 		uint64_t count = pStructInfos[i].count;
-		memBinding.push_back(LvnMemoryBinding(memPool->memBlocks[blockIndex][memIndex], pStructInfos[i].size, count));
+		memBinding.emplace_back(memPool->memBlocks[blockIndex][memIndex], pStructInfos[i].size, count, &memPool->memBlocks[blockIndex]);
 		memIndex += count * pStructInfos[i].size;
 
 		if (prevMemBinding != nullptr)
@@ -497,70 +746,138 @@ static void createContextMemoryPool(LvnContext* lvnctx, LvnContextCreateInfo* cr
 
 	// create the first memory block
 	LvnMemoryPool* memPool = &lvnctx->memoryPool;
-	memPool->memBlocks.push_back(LvnMemoryBlock(memSize));
+	memPool->virtualMemory = createInfo->memoryInfo.reserveVirtualMemory;
+	memPool->memBlocks.emplace_back(memSize, memPool->virtualMemory);
 
 	memPool->memBindings.resize(Lvn_Stype_Max);
 	lvn::setMemoryBlockBindings(memPool, 0, structTypes.data(), structTypes.size());
 
 
-	// set struct block memory configs
-	lvnctx->blockMemAllocInfos = lvnctx->sTypeMemAllocInfos;
+	// set struct block memory growth configs, each sType grows independently from the other types
+	lvnctx->sTypeGrowthInfos.resize(Lvn_Stype_Max);
+	for (uint64_t i = 0; i < lvnctx->sTypeGrowthInfos.size(); i++)
+		lvnctx->sTypeGrowthInfos[i] = { lvnctx->sTypeMemAllocInfos[i].count, 2.0f, 0, structTypes[i].count, false };
+
 	for (uint64_t i = 0; i < createInfo->memoryInfo.blockMemoryBindingCount; i++)
-		lvnctx->blockMemAllocInfos[createInfo->memoryInfo.blockMemoryBindings[i].sType].count = createInfo->memoryInfo.blockMemoryBindings[i].count;
+		lvnctx->sTypeGrowthInfos[createInfo->memoryInfo.blockMemoryBindings[i].sType].nextCount = createInfo->memoryInfo.blockMemoryBindings[i].count;
 
-	// get total memory in bytes for memory pool
-	lvnctx->blockMemSize = 0;
-	for (uint64_t i = 0; i < lvnctx->blockMemAllocInfos.size(); i++)
-		lvnctx->blockMemSize += lvnctx->blockMemAllocInfos[i].size * lvnctx->blockMemAllocInfos[i].count;
+	for (uint64_t i = 0; i < createInfo->memoryInfo.memoryGrowthInfoCount; i++)
+	{
+		LvnMemoryGrowthInfo& growthInfo = createInfo->memoryInfo.memoryGrowthInfos[i];
+		lvnctx->sTypeGrowthInfos[growthInfo.sType].growthFactor = growthInfo.growthFactor;
+		lvnctx->sTypeGrowthInfos[growthInfo.sType].maxCount = growthInfo.maxCount;
+	}
+
+	for (uint64_t i = 0; i < createInfo->memoryInfo.hugePageSTypeCount; i++)
+		lvnctx->sTypeGrowthInfos[createInfo->memoryInfo.hugePageSTypes[i]].hugePages = true;
+
+	memPool->sTypeMemBlocks.resize(Lvn_Stype_Max);
 
 
 	LVN_CORE_TRACE("memory allocation mode set to memory pool, %u custom memory bindings created, total memory block size: %zu bytes", createInfo->memoryInfo.memoryBindingCount, memSize);
 }
 
-static void createBlockMemoryPool(LvnContext* lvnctx)
+static LvnResult createBlockMemoryPool(LvnContext* lvnctx, LvnStructureType sType, uint64_t count)
 {
-	// create the next memory block
+	LvnStructureTypeGrowth& growth = lvnctx->sTypeGrowthInfos[sType];
+
+	// clamp the block to the max number of objects of this type
+	if (growth.maxCount && growth.capacity + count > growth.maxCount)
+		count = growth.capacity < growth.maxCount ? growth.maxCount - growth.capacity : 0;
+
+	if (count == 0)
+	{
+		LVN_CORE_ERROR("memory pool for sType (%s) has reached its max object count (%zu), cannot grow memory pool", lvn::getStructTypeEnumStr(sType), growth.maxCount);
+		return Lvn_Result_Failure;
+	}
+
+	// create the next memory block for this type only
 	LvnMemoryPool* memPool = &lvnctx->memoryPool;
-	memPool->memBlocks.push_back(LvnMemoryBlock(lvnctx->blockMemSize));
+	uint64_t objSize = lvn::getStructTypeSize(sType);
+	auto& memBlocks = memPool->sTypeMemBlocks[sType];
+	auto& memBinding = memPool->memBindings[sType];
 
-	lvn::setMemoryBlockBindings(memPool, memPool->memBlocks.size() - 1, lvnctx->blockMemAllocInfos.data(), lvnctx->blockMemAllocInfos.size());
+	LvnMemoryBlock& memBlock = memBlocks.emplace_back(objSize * count, memPool->virtualMemory, growth.hugePages);
+
+	LvnMemoryBinding* prevMemBinding = &memBinding.back();
+	LvnMemoryBinding& newMemBinding = memBinding.emplace_back(memBlock[0], objSize, count, &memBlock);
+	prevMemBinding->set_next_memory_binding(&newMemBinding);
+
+	growth.capacity += count;
+
+	return Lvn_Result_Success;
 }
 
 template <typename T>
-static T* createObject(LvnContext* lvnctx, LvnStructureType sType)
+static T* createObject(LvnContext* lvnctx, LvnStructureType sType, const char* site, void* caller)
 {
 	T* object;
 	if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
 	{
-		object = new T();
+		void* memptr = lvn::memAllocUntagged(sizeof(T), alignof(T), false);
+		LVN_CORE_ASSERT(memptr != nullptr, "create object failed, could not allocate memory for object");
+		object = new (memptr) T();
 	}
 	else if (lvnctx->memoryMode == Lvn_MemAllocMode_MemPool)
 	{
 		auto& memBinding = lvnctx->memoryPool.memBindings[sType][0];
-		if (memBinding.full() && memBinding.get_next_memory_binding() == nullptr)
-			lvn::createBlockMemoryPool(lvnctx);
+		void* memptr = memBinding.take_next();
+
+		if (memptr == nullptr) // all bindings of this type are full, grow the memory pool for this type
+		{
+			std::lock_guard<std::mutex> lock(lvnctx->memoryPool.memBlockMutex);
+
+			memptr = memBinding.take_next(); // another thread may have created a new block while waiting
+			if (memptr == nullptr)
+			{
+				LvnStructureTypeGrowth& growth = lvnctx->sTypeGrowthInfos[sType];
+				uint64_t count = growth.nextCount ? growth.nextCount : 1;
+
+				if (lvn::createBlockMemoryPool(lvnctx, sType, count) == Lvn_Result_Success)
+				{
+					if (growth.growthFactor > 1.0f)
+						growth.nextCount = static_cast<uint64_t>(static_cast<double>(count) * growth.growthFactor);
+
+					memptr = memBinding.take_next();
+				}
+			}
+		}
 
-		object = new (static_cast<T*>(memBinding.take_next())) T();
+		LVN_CORE_ASSERT(memptr != nullptr, "create object failed, could not get memory from memory pool");
+		object = new (static_cast<T*>(memptr)) T();
 	}
 	else
 	{
 		LVN_CORE_ASSERT(false, "create object failed, no requirment was met before hand"); return nullptr;
 	}
 
-	lvnctx->objectMemoryAllocations.sTypes[sType].count++;
+	LvnObjectMemAllocCount::LvnStructCounts& structCounts = lvnctx->objectMemoryAllocations.sTypes[sType];
+	lvn::atomicStoreMax(structCounts.peak, ++structCounts.count);
+
+	uint64_t size = lvnctx->sTypeMemAllocInfos[sType].size;
+	lvn::memTagAddBytes(lvnctx, lvn::getStructTypeMemoryTag(sType), size);
+
+	if (lvnctx->trackAllocationSites)
+		lvn::addAllocationRecord(lvnctx, object, { site, caller, sType, lvn::getStructTypeMemoryTag(sType), size });
+
 	return object;
 }
 
 template <typename T>
 static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType)
 {
+	if (lvnctx->trackAllocationSites)
+		lvn::removeAllocationRecord(lvnctx, obj);
+
 	if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
 	{
-		delete obj;
+		obj->~T();
+		lvn::memFreeUntagged(obj);
 		obj = nullptr;
 	}
 	else if (lvnctx->memoryMode == Lvn_MemAllocMode_MemPool)
 	{
+		obj->~T();
 		lvnctx->memoryPool.memBindings[sType][0].push_back(obj);
 	}
 	else
@@ -569,6 +886,7 @@ static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType)
 	}
 
 	lvnctx->objectMemoryAllocations.sTypes[sType].count--;
+	lvn::memTagSubBytes(lvnctx, lvn::getStructTypeMemoryTag(sType), lvnctx->sTypeMemAllocInfos[sType].size);
 }
 
 // ------------------------------------------------------------
@@ -579,9 +897,21 @@ LvnResult createContext(LvnContextCreateInfo* createInfo)
 {
 	if (s_LvnContext != nullptr) { return Lvn_Result_AlreadyCalled; }
 	s_LvnContext = new LvnContext();
+	s_LvnContext->id = ++s_LvnContextCount;
 
+	// calibrating the cycle counter takes a few milliseconds, do it here instead of the first time it is used
+	std::call_once(s_LvnClockOnce, lvn::clockCalibrate);
 	s_LvnContext->contexTime.reset();
 
+	if (createInfo->allocationCallbacks != nullptr)
+	{
+		LVN_CORE_ASSERT(createInfo->allocationCallbacks->allocFn && createInfo->allocationCallbacks->reallocFn && createInfo->allocationCallbacks->freeFn, "allocation callbacks must set allocFn, reallocFn and freeFn");
+		s_LvnContext->allocationCallbacks = *createInfo->allocationCallbacks;
+	}
+
+	s_LvnContext->trackAllocationSites = createInfo->memoryInfo.trackAllocationSites;
+	s_LvnContext->trackLibraryAllocations = createInfo->memoryInfo.trackLibraryAllocations;
+
 	s_LvnContext->appName = createInfo->applicationName;
 	s_LvnContext->windowapi = createInfo->windowapi;
 	s_LvnContext->graphicsapi = createInfo->graphicsapi;
@@ -595,7 +925,14 @@ LvnResult createContext(LvnContextCreateInfo* createInfo)
 	lvn::setDefaultStructTypeMemAllocInfos(s_LvnContext);
 
 	// logging
-	if (createInfo->logging.enableLogging) { logInit(); }
+	if (createInfo->logging.enableLogging)
+	{
+		// logging stays disabled if the default sinks could not be created
+		LvnResult logResult = logInit();
+
+		if (logResult != Lvn_Result_Failure && createInfo->logging.enableAsyncLogging)
+			lvn::logStartAsyncWriter(s_LvnContext, createInfo->logging.asyncQueueSize, createInfo->logging.asyncOverflowPolicy);
+	}
 
 	// memory
 	s_LvnContext->objectMemoryAllocations.sTypes.resize(Lvn_Stype_Max);
@@ -605,6 +942,16 @@ LvnResult createContext(LvnContextCreateInfo* createInfo)
 	}
 
 	lvn::createContextMemoryPool(s_LvnContext, createInfo);
+	lvn::createFrameArenas(s_LvnContext, createInfo->memoryInfo.frameMemorySize);
+
+	// threading, the pools are created when first used
+	lvn::setThreadPoolConfig(&s_LvnContext->jobPoolConfig, &createInfo->threading.jobWorkers, "lvn job", createInfo->threading.pReservedCores, createInfo->threading.reservedCoreCount);
+	lvn::setThreadPoolConfig(&s_LvnContext->assetPoolConfig, &createInfo->threading.assetWorkers, "lvn asset", createInfo->threading.pReservedCores, createInfo->threading.reservedCoreCount);
+
+	if (createInfo->threading.pinRenderThread)
+		lvn::threadSetAffinity(&createInfo->threading.renderThreadCore, 1);
+	if (createInfo->threading.renderThreadPriority != Lvn_ThreadPriority_Normal)
+		lvn::threadSetPriority(createInfo->threading.renderThreadPriority);
 
 	// window context
 	LvnResult result = setWindowContext(s_LvnContext, createInfo->windowapi);
@@ -655,21 +1002,42 @@ void terminateContext()
 {
 	if (s_LvnContext == nullptr) { return; }
 
+	// finish jobs and async loads that are still running before the contexts they use are terminated
+	lvn::destroyThreadPool(s_LvnContext->jobThreadPool);
+	s_LvnContext->jobThreadPool = nullptr;
+	lvn::destroyThreadPool(s_LvnContext->assetThreadPool);
+	s_LvnContext->assetThreadPool = nullptr;
+	if (!s_LvnContext->assetModelQueue.empty()) { LVN_CORE_WARN("not all async model loads have been processed or destroyed, number of loads remaining: %zu", s_LvnContext->assetModelQueue.size()); }
+
 	terminateWindowContext(s_LvnContext);
 	terminateGraphicsContext(s_LvnContext);
 	terminateAudioContext(s_LvnContext);
 	terminateNetworkingContext();
 
+	lvn::destroyFrameArenas(s_LvnContext);
+
 	for (uint32_t i = 0; i < s_LvnContext->objectMemoryAllocations.sTypes.size(); i++)
 	{
 		if (s_LvnContext->objectMemoryAllocations.sTypes[i].count > 0)
 		{
 			const char* stype = lvn::getStructTypeEnumStr(s_LvnContext->objectMemoryAllocations.sTypes[i].sType);
-			LVN_CORE_ERROR("sType = %s | not all objects of this sType (%s) have been destroyed, number of %s objects remaining: %zu", stype, stype, stype, s_LvnContext->objectMemoryAllocations.sTypes[i].count);
+			LVN_CORE_ERROR("sType = %s | not all objects of this sType (%s) have been destroyed, number of %s objects remaining: %zu", stype, stype, stype, s_LvnContext->objectMemoryAllocations.sTypes[i].count.load());
 		}
 	}
 
-	if (s_LvnContext->numMemoryAllocations > 0) { LVN_CORE_WARN("not all memory allocations have been freed, number of allocations remaining: %zu", s_LvnContext->numMemoryAllocations); }
+	if (s_LvnContext->numMemoryAllocations > 0) { LVN_CORE_WARN("not all memory allocations have been freed, number of allocations remaining: %zu", s_LvnContext->numMemoryAllocations.load()); }
+
+	// report where each allocation that is still alive was created
+	for (const auto& [ptr, record] : s_LvnContext->allocationRecords)
+	{
+		if (record.sType != Lvn_Stype_Undefined)
+			LVN_CORE_ERROR("sType = %s | object (%p) was not destroyed, created in %s() called from (%p)", lvn::getStructTypeEnumStr(record.sType), ptr, record.site, record.caller);
+		else
+			LVN_CORE_WARN("memory allocation (%p) of %llu bytes was not freed, allocated in %s() called from (%p)", ptr, (unsigned long long)record.size, record.site, record.caller);
+	}
+
+	// write out any messages still queued, messages logged after this are written directly
+	lvn::logStopAsyncWriter(s_LvnContext);
 
 	delete s_LvnContext;
 	s_LvnContext = nullptr;
@@ -874,6 +1242,16 @@ float getContextTime()
 	return lvn::getContext()->contexTime.elapsed();
 }
 
+uint64_t getContextTimeNs()
+{
+	return lvn::getContext()->contexTime.elapsed_ns();
+}
+
+double getContextTimeSeconds()
+{
+	return lvn::getContext()->contexTime.elapsed_seconds();
+}
+
 LvnData<uint8_t> loadFileSrcBin(const char* filepath)
 {
 	FILE* fileptr;
@@ -883,11 +1261,11 @@ LvnData<uint8_t> loadFileSrcBin(const char* filepath)
 	long int size = ftell(fileptr);
 	fseek(fileptr, 0, SEEK_SET);
 
-	std::vector<uint8_t> bin(size);
+	LvnData<uint8_t> bin(size);
 	fread(bin.data(), sizeof(uint8_t), size, fileptr);
 	fclose(fileptr);
 
-	return LvnData<uint8_t>(bin.data(), bin.size());
+	return bin;
 }
 
 LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, LvnCharset charset)
@@ -895,19 +1273,37 @@ LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, LvnCharset
 	LvnFont font{};
 
 	LvnData<uint8_t> fontData = lvn::loadFileSrcBin(filepath);
-	std::vector<uint8_t> fontBuffer(fontData.data(), fontData.data() + fontData.size());
 
 	FT_Library ft;
 	FT_Face face;
+	FT_MemoryRec_ ftMemory{};
+
+	// freetype allocations go through the tagged allocators so they are counted under the assets tag, otherwise freetype uses malloc and free
+	FT_Error ftError;
+	bool ftHooks = lvn::useLibraryAllocationHooks(s_LvnContext);
+	if (ftHooks)
+	{
+		ftMemory.user = nullptr;
+		ftMemory.alloc = lvn::ftAllocCallback;
+		ftMemory.realloc = lvn::ftReallocCallback;
+		ftMemory.free = lvn::ftFreeCallback;
+
+		ftError = FT_New_Library(&ftMemory, &ft);
+		if (!ftError) { FT_Add_Default_Modules(ft); }
+	}
+	else
+	{
+		ftError = FT_Init_FreeType(&ft);
+	}
 
-	if (FT_Init_FreeType(&ft))
+	if (ftError)
 	{
 		LVN_CORE_ERROR("[freetype]: failed to load freetype library");
 		LVN_CORE_ASSERT(false, "failed to load freetype");
 		return font;
 	}
 
-	if (FT_New_Face(ft, filepath, 0, &face))
+	if (FT_New_Memory_Face(ft, fontData.data(), fontData.size(), 0, &face))
 	{
 		LVN_CORE_ERROR("[freetype]: failed to load font face!");
 		LVN_CORE_ASSERT(false, "failed to load font face");
@@ -922,10 +1318,10 @@ LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, LvnCharset
 	int height = width;
 
 	// render glyphs to atlas
-	std::vector<uint8_t> pixels(width * height);
+	LvnData<uint8_t> pixels(width * height);
 	int penx = 0, peny = 0;
 
-	std::vector<LvnFontGlyph> glyphs(charset.last - charset.first + 1);
+	LvnData<LvnFontGlyph> glyphs(charset.last - charset.first + 1);
 
 	for (int8_t i = charset.first; i <= charset.last; i++)
 	{
@@ -966,414 +1362,2380 @@ LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, LvnCharset
 		penx += bmp->width + 1;
 	}
 
-	FT_Done_FreeType(ft);
+	if (ftHooks)
+		FT_Done_Library(ft);
+	else
+		FT_Done_FreeType(ft); // also frees the memory object created by FT_Init_FreeType
 	
-	LvnImageData atlas{};
-	atlas.width = width;
-	atlas.height = height;
-	atlas.channels = 1;
-	atlas.size = width * height;
-	atlas.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
-
-	font.atlas = atlas;
-	font.glyphs = LvnData<LvnFontGlyph>(glyphs.data(), glyphs.size());
+	font.atlas.width = width;
+	font.atlas.height = height;
+	font.atlas.channels = 1;
+	font.atlas.size = width * height;
+	font.atlas.pixels = std::move(pixels);
+
+	font.glyphs = std::move(glyphs);
 	font.codepoints = charset;
 	font.fontSize = fontSize;
 
 	return font;
 }
 
-LvnFontGlyph fontGetGlyph(LvnFont* font, int8_t codepoint)
+static void* ftAllocCallback(FT_Memory memory, long size)
 {
-	LVN_CORE_ASSERT(codepoint >= font->codepoints.first && codepoint <= font->codepoints.last, "codepoint out of charset range");
-	return font->glyphs[codepoint - font->codepoints.first];
+	(void)memory;
+	return lvn::memAllocTagged(size, Lvn_MemoryTag_Assets, false);
 }
 
-void* memAlloc(size_t size)
+static void* ftReallocCallback(FT_Memory memory, long currentSize, long newSize, void* block)
 {
-	if (size == 0) { return nullptr; }
-	void* allocmem = calloc(1, size);
-	if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate memory!"); LVN_ABORT; }
-	if (s_LvnContext) { s_LvnContext->numMemoryAllocations++; }
-	return allocmem;
+	(void)memory; (void)currentSize;
+	return lvn::memReallocTagged(block, newSize, Lvn_MemoryTag_Assets);
 }
 
-void memFree(void* ptr)
+static void ftFreeCallback(FT_Memory memory, void* block)
 {
-	if (ptr == nullptr) { return; }
-	free(ptr);
-	ptr = nullptr;
-	if (s_LvnContext) s_LvnContext->numMemoryAllocations--;
+	(void)memory;
+	lvn::memFreeTagged(block);
 }
 
-void* memRealloc(void* ptr, size_t size)
+LvnFontGlyph fontGetGlyph(LvnFont* font, int8_t codepoint)
 {
-	void* allocmem = realloc(ptr, size);
-	if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate memory!"); LVN_ABORT; }
-	return allocmem;
+	LVN_CORE_ASSERT(codepoint >= font->codepoints.first && codepoint <= font->codepoints.last, "codepoint out of charset range");
+	return font->glyphs[codepoint - font->codepoints.first];
 }
 
-/* [Logging] */
-const static LvnLogPattern s_LogPatterns[] =
-{
-	{ '$', [](LvnLogMessage* msg) -> std::string { return "\n"; } },
-	{ 'n', [](LvnLogMessage* msg) -> std::string { return msg->loggerName; } },
-	{ 'l', [](LvnLogMessage* msg) -> std::string { return getLogLevelName(msg->level); }},
-	{ '#', [](LvnLogMessage* msg) -> std::string { return getLogLevelColor(msg->level); }},
-	{ '^', [](LvnLogMessage* msg) -> std::string { return LVN_LOG_COLOR_RESET; }},
-	{ 'v', [](LvnLogMessage* msg) -> std::string { return msg->msg; }},
-	{ '%', [](LvnLogMessage* msg) -> std::string { return "%"; } },
-	{ 'T', [](LvnLogMessage* msg) -> std::string { return dateGetTimeHHMMSS(); } },
-	{ 't', [](LvnLogMessage* msg) -> std::string { return dateGetTime12HHMMSS(); } },
-	{ 'Y', [](LvnLogMessage* msg) -> std::string { return dateGetYearStr(); }},
-	{ 'y', [](LvnLogMessage* msg) -> std::string { return dateGetYear02dStr(); } },
-	{ 'm', [](LvnLogMessage* msg) -> std::string { return dateGetMonthNumStr(); } },
-	{ 'B', [](LvnLogMessage* msg) -> std::string { return dateGetMonthName(); } },
-	{ 'b', [](LvnLogMessage* msg) -> std::string { return dateGetMonthNameShort(); } },
-	{ 'd', [](LvnLogMessage* msg) -> std::string { return dateGetDayNumStr(); } },
-	{ 'A', [](LvnLogMessage* msg) -> std::string { return dateGetWeekDayName(); } },
-	{ 'a', [](LvnLogMessage* msg) -> std::string { return dateGetWeekDayNameShort(); } },
-	{ 'H', [](LvnLogMessage* msg) -> std::string { return dateGetHourNumStr(); } },
-	{ 'h', [](LvnLogMessage* msg) -> std::string { return dateGetHour12NumStr(); } },
-	{ 'M', [](LvnLogMessage* msg) -> std::string { return dateGetMinuteNumStr(); } },
-	{ 'S', [](LvnLogMessage* msg) -> std::string { return dateGetSecondNumStr(); } },
-	{ 'P', [](LvnLogMessage* msg) -> std::string { return dateGetTimeMeridiem(); } },
-	{ 'p', [](LvnLogMessage* msg) -> std::string { return dateGetTimeMeridiemLower(); }},
-};
-
-static std::vector<LvnLogPattern> logParseFormat(const char* fmt)
+// every allocation is prefixed with a LvnMemAllocHeader that records the allocator it came from, so it is freed the same way
+// even if the context was created or terminated in between
+static LvnMemAllocHeader* memAllocHeader(size_t size, bool zeroMemory)
 {
-	if (!fmt || fmt[0] == '\0') { return {}; }
-
-	std::vector<LvnLogPattern> patterns;
+	size_t allocSize = sizeof(LvnMemAllocHeader) + size;
 
-	for (uint32_t i = 0; i < strlen(fmt) - 1; i++)
+	LvnMemAllocHeader* header;
+	if (s_LvnContext && s_LvnContext->allocationCallbacks.allocFn)
 	{
-		if (fmt[i] != '%') // Other characters in format
-		{
-			LvnLogPattern pattern = { .symbol = fmt[i], .func = nullptr };
-			patterns.push_back(pattern);
-			continue;
-		}
-
-		// find pattern with matching symbol
-		for (uint32_t j = 0; j < sizeof(s_LogPatterns) / sizeof(LvnLogPattern); j++)
-		{
-			if (fmt[i + 1] != s_LogPatterns[j].symbol)
-				continue;
-
-			patterns.push_back(s_LogPatterns[j]);
-		}
-
-		// find and add user defined patterns
-		for (uint32_t j = 0; j < s_LvnContext->userLogPatterns.size(); j++)
-		{
-			if (fmt[i + 1] != s_LvnContext->userLogPatterns[j].symbol)
-				continue;
+		header = static_cast<LvnMemAllocHeader*>(s_LvnContext->allocationCallbacks.allocFn(allocSize, alignof(std::max_align_t), s_LvnContext->allocationCallbacks.userData));
+		if (!header) { return nullptr; }
+		if (zeroMemory) { memset(header, 0, allocSize); }
 
-			patterns.push_back(s_LvnContext->userLogPatterns[j]);
-		}
-
-		i++; // incramant past symbol on next character in format
+		header->freeFn = s_LvnContext->allocationCallbacks.freeFn;
+		header->userData = s_LvnContext->allocationCallbacks.userData;
 	}
-
-	return patterns;
-}
-
-LvnResult logInit()
-{
-	LvnContext* lvnctx = lvn::getContext();
-
-	if (!lvnctx->logging)
+	else
 	{
-		lvnctx->logging = true;
-
-		lvnctx->coreLogger.loggerName = "CORE";
-
-		if (!lvnctx->appName.empty())
-			lvnctx->clientLogger.loggerName = lvnctx->appName;
-		else
-			lvnctx->clientLogger.loggerName = "CLIENT";
-
-		lvnctx->coreLogger.logLevel = lvnctx->clientLogger.logLevel = Lvn_LogLevel_None;
-		lvnctx->coreLogger.logPatternFormat = lvnctx->clientLogger.logPatternFormat = LVN_DEFAULT_LOG_PATTERN;
-		lvnctx->coreLogger.logPatterns = lvnctx->clientLogger.logPatterns = lvn::logParseFormat(LVN_DEFAULT_LOG_PATTERN);
-
-
-		#ifdef LVN_PLATFORM_WINDOWS 
-		enableLogANSIcodeColors();
-		#endif
+		header = static_cast<LvnMemAllocHeader*>(zeroMemory ? calloc(1, allocSize) : malloc(allocSize));
+		if (!header) { return nullptr; }
 
-		return Lvn_Result_Success;
+		header->freeFn = nullptr;
+		header->userData = nullptr;
 	}
 
-	return Lvn_Result_AlreadyCalled;
+	header->size = size;
+	header->tag = Lvn_MemoryTag_Core;
+	header->contextId = 0;
+	return header;
 }
 
-void logEnable(bool enable)
+static void memFreeHeader(LvnMemAllocHeader* header)
 {
-	lvn::getContext()->logging = enable;
+	if (header->freeFn)
+		header->freeFn(header, header->userData);
+	else
+		free(header);
 }
 
-void logEnableCoreLogging(bool enable)
+// true if the memory came from the allocator that new allocations currently use, only then can it be resized in place
+static bool memIsCurrentAllocator(const LvnMemAllocHeader* header)
 {
-	lvn::getContext()->enableCoreLogging = enable;
+	if (s_LvnContext && s_LvnContext->allocationCallbacks.allocFn)
+		return header->freeFn == s_LvnContext->allocationCallbacks.freeFn && header->userData == s_LvnContext->allocationCallbacks.userData;
+
+	return header->freeFn == nullptr;
 }
 
-void logSetLevel(LvnLogger* logger, LvnLogLevel level)
+// true if the memory stats of the current context count the allocation, allocations made before it was created are not counted and must not be subtracted
+static bool memIsCounted(const void* ptr)
 {
-	logger->logLevel = level;
+	return s_LvnContext && (static_cast<const LvnMemAllocHeader*>(ptr) - 1)->contextId == s_LvnContext->id;
 }
 
-bool logCheckLevel(LvnLogger* logger, LvnLogLevel level)
+// untagged allocations are not added to the memory tag counts, their usage is counted by the caller
+void* memAllocUntagged(size_t size, size_t alignment, bool zeroMemory)
 {
-	return (level >= logger->logLevel);
+	LVN_CORE_ASSERT(alignment <= alignof(std::max_align_t), "memAllocUntagged alignment cannot be larger than alignof(std::max_align_t)");
+	(void)alignment;
+
+	LvnMemAllocHeader* header = lvn::memAllocHeader(size, zeroMemory);
+	return header ? header + 1 : nullptr;
 }
 
-void logRenameLogger(LvnLogger* logger, const char* name)
+void memFreeUntagged(void* ptr)
 {
-	logger->loggerName = name;
+	if (ptr == nullptr) { return; }
+	lvn::memFreeHeader(static_cast<LvnMemAllocHeader*>(ptr) - 1);
 }
 
-void logOutputMessage(LvnLogger* logger, LvnLogMessage* msg)
+static void* memAllocTagged(size_t size, LvnMemoryTag tag, bool zeroMemory)
 {
-	if (!lvn::getContext()->logging) { return; }
+	LvnMemAllocHeader* header = lvn::memAllocHeader(size, zeroMemory);
+	if (!header) { return nullptr; }
 
-	std::string msgstr;
+	header->tag = tag;
 
-	for (uint32_t i = 0; i < logger->logPatterns.size(); i++)
+	if (s_LvnContext)
 	{
-		if (logger->logPatterns[i].func == nullptr) // no special format character '%' found
-		{
-			msgstr += logger->logPatterns[i].symbol;
-		}
-		else // call func of special format
-		{
-			msgstr += logger->logPatterns[i].func(msg);
-		}
+		header->contextId = s_LvnContext->id;
+		lvn::memTagAddBytes(s_LvnContext, tag, size);
 	}
 
-	printf("%s", msgstr.c_str());
+	return header + 1;
 }
 
-void logMessage(LvnLogger* logger, LvnLogLevel level, const char* msg)
+static void* memReallocTagged(void* ptr, size_t size, LvnMemoryTag tag)
 {
-	if (!lvn::getContext()->logging) { return; }
+	if (ptr == nullptr) { return lvn::memAllocTagged(size, tag, false); }
+	if (size == 0) { lvn::memFreeTagged(ptr); return nullptr; }
 
-	LvnLogMessage logMsg{};
-	logMsg.msg = msg;
-	logMsg.loggerName = logger->loggerName.c_str();
-	logMsg.level = level;
-	logMsg.timeEpoch = dateGetSecondsSinceEpoch();
+	LvnMemAllocHeader* header = static_cast<LvnMemAllocHeader*>(ptr) - 1;
+	uint64_t oldSize = header->size;
+	bool counted = lvn::memIsCounted(ptr);
+	tag = header->tag;
 
-	logOutputMessage(logger, &logMsg);
-}
+	// memory from another allocator (eg. allocated before the context was created) is moved into memory from the current one
+	if (!lvn::memIsCurrentAllocator(header))
+	{
+		void* allocmem = lvn::memAllocTagged(size, tag, false);
+		if (!allocmem) { return nullptr; }
 
-void logMessageTrace(LvnLogger* logger, const char* fmt, ...)
-{
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Trace)) { return; }
+		memcpy(allocmem, ptr, std::min<uint64_t>(oldSize, size));
+		lvn::memFreeTagged(ptr);
+		return allocmem;
+	}
 
-	std::vector<char> buff;
+	size_t allocSize = sizeof(LvnMemAllocHeader) + size;
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
+	void* allocmem;
+	if (header->freeFn)
+		allocmem = s_LvnContext->allocationCallbacks.reallocFn(header, allocSize, alignof(std::max_align_t), s_LvnContext->allocationCallbacks.userData);
+	else
+		allocmem = realloc(header, allocSize);
 
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Trace, buff.data());
+	if (!allocmem) { return nullptr; }
 
-	va_end(argcopy);
-	va_end(argptr);
-}
+	header = static_cast<LvnMemAllocHeader*>(allocmem);
+	header->size = size;
 
-void logMessageDebug(LvnLogger* logger, const char* fmt, ...)
-{
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Debug)) { return; }
+	if (counted) { lvn::memTagSubBytes(s_LvnContext, tag, oldSize); }
+	if (s_LvnContext)
+	{
+		header->contextId = s_LvnContext->id;
+		lvn::memTagAddBytes(s_LvnContext, tag, size);
+	}
 
-	std::vector<char> buff;
+	return header + 1;
+}
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
+static void memFreeTagged(void* ptr)
+{
+	if (ptr == nullptr) { return; }
 
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Debug, buff.data());
+	LvnMemAllocHeader* header = static_cast<LvnMemAllocHeader*>(ptr) - 1;
+	if (lvn::memIsCounted(ptr)) { lvn::memTagSubBytes(s_LvnContext, header->tag, header->size); }
 
-	va_end(argcopy);
-	va_end(argptr);
+	lvn::memFreeHeader(header);
 }
 
-void logMessageInfo(LvnLogger* logger, const char* fmt, ...)
+void* memAlloc(size_t size, LvnMemoryTag tag)
 {
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Info)) { return; }
+	if (size == 0) { return nullptr; }
 
-	std::vector<char> buff;
+	void* allocmem = lvn::memAllocTagged(size, tag, true);
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
+	if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate memory!"); LVN_ABORT; }
+	if (s_LvnContext)
+	{
+		s_LvnContext->numMemoryAllocations++;
 
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Info, buff.data());
+		if (s_LvnContext->trackAllocationSites)
+			lvn::addAllocationRecord(s_LvnContext, allocmem, { "memAlloc", LVN_RETURN_ADDRESS(), Lvn_Stype_Undefined, tag, size });
+	}
 
-	va_end(argcopy);
-	va_end(argptr);
+	return allocmem;
 }
 
-void logMessageWarn(LvnLogger* logger, const char* fmt, ...)
+void memFree(void* ptr)
 {
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Warn)) { return; }
-
-	std::vector<char> buff;
+	if (ptr == nullptr) { return; }
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
+	if (s_LvnContext && s_LvnContext->trackAllocationSites)
+		lvn::removeAllocationRecord(s_LvnContext, ptr);
 
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Warn, buff.data());
+	bool counted = lvn::memIsCounted(ptr);
+	lvn::memFreeTagged(ptr);
 
-	va_end(argcopy);
-	va_end(argptr);
+	ptr = nullptr;
+	if (counted) s_LvnContext->numMemoryAllocations--;
 }
 
-void logMessageError(LvnLogger* logger, const char* fmt, ...)
+void* memRealloc(void* ptr, size_t size)
 {
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Error)) { return; }
+	if (ptr == nullptr) { return lvn::memAlloc(size); }
+	if (size == 0) { lvn::memFree(ptr); return nullptr; }
 
-	std::vector<char> buff;
+	void* allocmem = lvn::memReallocTagged(ptr, size, Lvn_MemoryTag_Core);
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
-
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Error, buff.data());
+	if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate memory!"); LVN_ABORT; }
+	if (s_LvnContext && s_LvnContext->trackAllocationSites && allocmem != ptr)
+	{
+		std::lock_guard<std::mutex> lock(s_LvnContext->allocationRecordMutex);
+		auto record = s_LvnContext->allocationRecords.find(ptr);
+		if (record != s_LvnContext->allocationRecords.end())
+		{
+			LvnAllocationRecord newRecord = record->second;
+			newRecord.size = size;
+			s_LvnContext->allocationRecords.erase(record);
+			s_LvnContext->allocationRecords[allocmem] = newRecord;
+		}
+	}
 
-	va_end(argcopy);
-	va_end(argptr);
+	return allocmem;
 }
 
-void logMessageFatal(LvnLogger* logger, const char* fmt, ...)
+static void createFrameArenas(LvnContext* lvnctx, uint64_t size)
 {
-	if (!s_LvnContext || !s_LvnContext->logging) { return; }
-	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-	if (!logCheckLevel(logger, Lvn_LogLevel_Fatal)) { return; }
+	if (size == 0) { size = 1ull << 20; }
 
-	std::vector<char> buff;
+	// at least two arenas so that memory allocated before renderBeginNextFrame stays valid for the rest of the frame
+	uint32_t arenaCount = lvnctx->graphicsContext.maxFramesInFlight > 2 ? lvnctx->graphicsContext.maxFramesInFlight : 2;
+	lvnctx->frameArenas.resize(arenaCount);
+	lvnctx->frameArenaIndex.store(0);
+	lvnctx->frameArenaEpoch = 1;
 
-	va_list argptr, argcopy;
-	va_start(argptr, fmt);
-	va_copy(argcopy, argptr);
+	for (LvnFrameArena& arena : lvnctx->frameArenas)
+	{
+		arena.data = static_cast<uint8_t*>(lvn::memAllocTagged(size, Lvn_MemoryTag_Core, false));
+		if (!arena.data) { LVN_CORE_ERROR("malloc failure, could not allocate frame memory!"); LVN_ABORT; }
+		arena.capacity = size;
+	}
+}
+
+static void resetFrameArena(LvnFrameArena* arena)
+{
+	for (void* ptr : arena->overflowAllocations)
+		lvn::memFreeTagged(ptr);
+
+	// grow the arena to fit everything used in the last frame so that the next frame does not overflow again
+	if (arena->overflowSize > 0)
+	{
+		uint64_t newCapacity = arena->offset.load() + arena->overflowSize;
+		if (newCapacity < arena->capacity * 2) { newCapacity = arena->capacity * 2; }
+
+		lvn::memFreeTagged(arena->data);
+		arena->data = static_cast<uint8_t*>(lvn::memAllocTagged(newCapacity, Lvn_MemoryTag_Core, false));
+		if (!arena->data) { LVN_CORE_ERROR("malloc failure, could not allocate frame memory!"); LVN_ABORT; }
+		arena->capacity = newCapacity;
+	}
+
+	arena->overflowAllocations.clear();
+	arena->overflowSize = 0;
+	arena->offset.store(0);
+}
+
+static void destroyFrameArenas(LvnContext* lvnctx)
+{
+	for (LvnFrameArena& arena : lvnctx->frameArenas)
+	{
+		lvn::resetFrameArena(&arena);
+		lvn::memFreeTagged(arena.data);
+	}
+
+	lvnctx->frameArenas.clear();
+}
+
+void* frameAlloc(size_t size, size_t alignment)
+{
+	LVN_CORE_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "frame alloc alignment must be a power of two");
+	if (size == 0) { return nullptr; }
+
+	LvnContext* lvnctx = lvn::getContext();
+	LvnFrameArena& arena = lvnctx->frameArenas[lvnctx->frameArenaIndex.load(std::memory_order_acquire)];
+
+	uint64_t offset = arena.offset.load(std::memory_order_relaxed);
+	while (true)
+	{
+		uintptr_t address = reinterpret_cast<uintptr_t>(arena.data) + offset;
+		uint64_t alignedOffset = offset + ((alignment - address % alignment) % alignment);
+		if (alignedOffset + size > arena.capacity)
+			break;
+
+		if (arena.offset.compare_exchange_weak(offset, alignedOffset + size, std::memory_order_relaxed))
+			return arena.data + alignedOffset;
+	}
+
+	// arena is full, fall back to a heap allocation that is freed when the arena is reset
+	std::lock_guard<std::mutex> lock(lvnctx->frameArenaMutex);
+
+	uint64_t allocSize = size + alignment - 1;
+	void* allocmem = lvn::memAllocTagged(allocSize, Lvn_MemoryTag_Core, false);
+	if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate frame memory!"); LVN_ABORT; }
+
+	arena.overflowAllocations.push_back(allocmem);
+	arena.overflowSize += allocSize;
+
+	uintptr_t address = reinterpret_cast<uintptr_t>(allocmem);
+	return reinterpret_cast<void*>((address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+}
+
+uint64_t frameAllocGetUsed()
+{
+	LvnContext* lvnctx = lvn::getContext();
+	LvnFrameArena& arena = lvnctx->frameArenas[lvnctx->frameArenaIndex.load(std::memory_order_acquire)];
+
+	std::lock_guard<std::mutex> lock(lvnctx->frameArenaMutex);
+	return arena.offset.load(std::memory_order_relaxed) + arena.overflowSize;
+}
+
+LvnMemoryStats getMemoryStats()
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	LvnMemoryStats stats{};
+
+	for (uint32_t i = 0; i < Lvn_MemoryTag_Max; i++)
+	{
+		stats.tags[i].liveBytes = lvnctx->memoryTagCounts[i].liveBytes.load(std::memory_order_relaxed);
+		stats.tags[i].liveCount = lvnctx->memoryTagCounts[i].liveCount.load(std::memory_order_relaxed);
+		stats.tags[i].peakBytes = lvnctx->memoryTagCounts[i].peakBytes.load(std::memory_order_relaxed);
+	}
+
+	stats.totalLiveBytes = lvnctx->totalLiveBytes.load(std::memory_order_relaxed);
+	stats.totalPeakBytes = lvnctx->totalPeakBytes.load(std::memory_order_relaxed);
+
+	for (uint32_t i = 0; i < Lvn_Stype_Max; i++)
+	{
+		LvnStructureTypeMemoryStats& sTypeStats = stats.sTypes[i];
+		const LvnObjectMemAllocCount::LvnStructCounts& structCounts = lvnctx->objectMemoryAllocations.sTypes[i];
+
+		sTypeStats.liveCount = structCounts.count.load(std::memory_order_relaxed);
+		sTypeStats.peakCount = structCounts.peak.load(std::memory_order_relaxed);
+		sTypeStats.liveBytes = sTypeStats.liveCount * lvnctx->sTypeMemAllocInfos[i].size;
+	}
+
+	if (lvnctx->memoryMode != Lvn_MemAllocMode_MemPool)
+		return stats;
+
+	std::lock_guard<std::mutex> lock(lvnctx->memoryPool.memBlockMutex);
+
+	for (uint32_t i = 0; i < Lvn_Stype_Max; i++)
+	{
+		auto& memBinding = lvnctx->memoryPool.memBindings[i];
+		if (memBinding.empty()) { continue; }
+
+		LvnStructureTypeMemoryStats& sTypeStats = stats.sTypes[i];
+		sTypeStats.blockCount = 1 + lvnctx->memoryPool.sTypeMemBlocks[i].size();
+		sTypeStats.capacity = lvnctx->sTypeGrowthInfos[i].capacity;
+		sTypeStats.freeSlots = memBinding[0].free_count();
+
+		// slots handed out by the bump index of each binding, freed slots are counted within these
+		uint64_t handedOut = 0;
+		for (uint64_t j = 0; j < memBinding.size(); j++)
+			handedOut += memBinding[j].size();
+
+		sTypeStats.fragmentation = handedOut ? static_cast<float>(sTypeStats.freeSlots) / static_cast<float>(handedOut) : 0.0f;
+	}
+
+	return stats;
+}
+
+LvnAllocationCallbacks* memGetAllocationCallbacks()
+{
+	LvnContext* lvnctx = lvn::getContext();
+	return lvnctx->allocationCallbacks.allocFn != nullptr ? &lvnctx->allocationCallbacks : nullptr;
+}
+
+static uint64_t memVirtualPageSize()
+{
+#ifdef LVN_PLATFORM_WINDOWS
+	SYSTEM_INFO sysInfo;
+	GetSystemInfo(&sysInfo);
+	return sysInfo.dwPageSize;
+#else
+	static uint64_t pageSize = sysconf(_SC_PAGESIZE);
+	return pageSize;
+#endif
+}
+
+static uint64_t memVirtualReserveSize(uint64_t size, bool hugePages)
+{
+	uint64_t alignment = hugePages ? (2ull << 20) : lvn::memVirtualPageSize();
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+void* memVirtualReserve(uint64_t size, bool hugePages)
+{
+	uint64_t reserveSize = lvn::memVirtualReserveSize(size, hugePages);
+
+#ifdef LVN_PLATFORM_WINDOWS
+	return VirtualAlloc(nullptr, reserveSize, MEM_RESERVE, PAGE_NOACCESS);
+#else
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	#ifdef MAP_NORESERVE
+	flags |= MAP_NORESERVE;
+	#endif
+
+	if (!hugePages)
+	{
+		void* memptr = mmap(nullptr, reserveSize, PROT_NONE, flags, -1, 0);
+		return memptr != MAP_FAILED ? memptr : nullptr;
+	}
+
+	// huge pages need the range to be aligned to the huge page size, over reserve and trim the unaligned ends
+	uint64_t hugePageSize = 2ull << 20;
+	uint8_t* memptr = static_cast<uint8_t*>(mmap(nullptr, reserveSize + hugePageSize, PROT_NONE, flags, -1, 0));
+	if (memptr == MAP_FAILED) { return nullptr; }
+
+	uint8_t* aligned = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(memptr) + hugePageSize - 1) & ~(hugePageSize - 1));
+	uint64_t head = aligned - memptr;
+	if (head) { munmap(memptr, head); }
+	if (hugePageSize - head) { munmap(aligned + reserveSize, hugePageSize - head); }
+
+	#ifdef MADV_HUGEPAGE
+	madvise(aligned, reserveSize, MADV_HUGEPAGE);
+	#endif
+
+	return aligned;
+#endif
+}
+
+void memVirtualCommit(void* ptr, uint64_t size)
+{
+	if (size == 0) { return; }
+
+	uint64_t pageSize = lvn::memVirtualPageSize();
+	uintptr_t begin = reinterpret_cast<uintptr_t>(ptr) & ~(pageSize - 1);
+	uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size + pageSize - 1) & ~(pageSize - 1);
+
+#ifdef LVN_PLATFORM_WINDOWS
+	void* memptr = VirtualAlloc(reinterpret_cast<void*>(begin), end - begin, MEM_COMMIT, PAGE_READWRITE);
+	if (!memptr) { LVN_CORE_ERROR("failed to commit virtual memory pages!"); LVN_ABORT; }
+#else
+	if (mprotect(reinterpret_cast<void*>(begin), end - begin, PROT_READ | PROT_WRITE) != 0) { LVN_CORE_ERROR("failed to commit virtual memory pages!"); LVN_ABORT; }
+#endif
+}
+
+void memVirtualRelease(void* ptr, uint64_t size, bool hugePages)
+{
+	if (ptr == nullptr) { return; }
+
+#ifdef LVN_PLATFORM_WINDOWS
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+	munmap(ptr, lvn::memVirtualReserveSize(size, hugePages));
+#endif
+}
+
+LvnResult memPoolReserve(LvnStructureType sType, uint64_t count)
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	if (lvnctx->memoryMode != Lvn_MemAllocMode_MemPool)
+	{
+		LVN_CORE_ERROR("memPoolReserve(LvnStructureType, uint64_t) | memory allocation mode is not set to memory pool, cannot reserve memory for sType (%s)", lvn::getStructTypeEnumStr(sType));
+		return Lvn_Result_Failure;
+	}
+
+	std::lock_guard<std::mutex> lock(lvnctx->memoryPool.memBlockMutex);
+
+	LvnStructureTypeGrowth& growth = lvnctx->sTypeGrowthInfos[sType];
+	if (growth.capacity >= count) { return Lvn_Result_Success; }
+
+	return lvn::createBlockMemoryPool(lvnctx, sType, count - growth.capacity);
+}
+
+void memPoolShrink(LvnStructureType sType)
+{
+	LvnContext* lvnctx = lvn::getContext();
+	if (lvnctx->memoryMode != Lvn_MemAllocMode_MemPool) { return; }
+
+	std::lock_guard<std::mutex> lock(lvnctx->memoryPool.memBlockMutex);
+
+	LvnMemoryPool* memPool = &lvnctx->memoryPool;
+	auto& memBlocks = memPool->sTypeMemBlocks[sType];
+	auto& memBinding = memPool->memBindings[sType];
+	uint64_t freedCount = 0;
+
+	// free memory blocks from the back while all of their slots are unused, the first memory block is never freed
+	while (!memBlocks.empty())
+	{
+		LvnMemoryBinding* lastBinding = &memBinding.back();
+		if (memBinding[0].free_slot_count(lastBinding) != lastBinding->size())
+			break;
+
+		memBinding[0].erase_free_slots(lastBinding);
+		freedCount += lastBinding->capacity();
+
+		memBinding.pop_back();
+		memBlocks.pop_back();
+		memBinding.back().set_next_memory_binding(nullptr);
+	}
+
+	lvnctx->sTypeGrowthInfos[sType].capacity -= freedCount;
+
+	if (freedCount)
+		LVN_CORE_TRACE("memory pool shrunk for sType (%s), freed memory for %zu objects", lvn::getStructTypeEnumStr(sType), freedCount);
+}
+
+uint64_t memPoolGetCapacity(LvnStructureType sType)
+{
+	LvnContext* lvnctx = lvn::getContext();
+	if (lvnctx->memoryMode != Lvn_MemAllocMode_MemPool) { return 0; }
+
+	std::lock_guard<std::mutex> lock(lvnctx->memoryPool.memBlockMutex);
+	return lvnctx->sTypeGrowthInfos[sType].capacity;
+}
+
+/* [Logging] */
+#define LVN_LOG_MSG_BUFFER_SIZE 4096
+#define LVN_LOG_OUTPUT_BUFFER_SIZE 8192
+
+struct LvnLogTokenSymbol
+{
+	char symbol;
+	LvnLogTokenType type;
+};
+
+static const LvnLogTokenSymbol s_LogTokenSymbols[] =
+{
+	{ '$', Lvn_LogToken_NewLine },
+	{ 'n', Lvn_LogToken_LoggerName },
+	{ 'l', Lvn_LogToken_Level },
+	{ '#', Lvn_LogToken_ColorStart },
+	{ '^', Lvn_LogToken_ColorReset },
+	{ 'v', Lvn_LogToken_Message },
+	{ '%', Lvn_LogToken_Percent },
+	{ 'T', Lvn_LogToken_Time },
+	{ 't', Lvn_LogToken_Time12 },
+	{ 'Y', Lvn_LogToken_Year },
+	{ 'y', Lvn_LogToken_Year02d },
+	{ 'm', Lvn_LogToken_Month },
+	{ 'B', Lvn_LogToken_MonthName },
+	{ 'b', Lvn_LogToken_MonthNameShort },
+	{ 'd', Lvn_LogToken_Day },
+	{ 'A', Lvn_LogToken_WeekDayName },
+	{ 'a', Lvn_LogToken_WeekDayNameShort },
+	{ 'H', Lvn_LogToken_Hour },
+	{ 'h', Lvn_LogToken_Hour12 },
+	{ 'M', Lvn_LogToken_Minute },
+	{ 'S', Lvn_LogToken_Second },
+	{ 'P', Lvn_LogToken_Meridiem },
+	{ 'p', Lvn_LogToken_MeridiemLower },
+};
+
+// compiles the pattern into tokens once so that formatting a message only walks the token list
+static LvnLogFormatter logParseFormat(const char* fmt)
+{
+	LvnLogFormatter formatter{};
+	if (!fmt || fmt[0] == '\0') { return formatter; }
+
+	formatter.pattern = fmt;
+	const std::string& pattern = formatter.pattern;
+
+	for (uint32_t i = 0; i < pattern.size(); i++)
+	{
+		if (pattern[i] != '%' || i + 1 == pattern.size()) // Other characters in format, merge runs of them into one literal
+		{
+			if (!formatter.tokens.empty() && formatter.tokens.back().type == Lvn_LogToken_Literal && formatter.tokens.back().literalOffset + formatter.tokens.back().literalLength == i)
+				formatter.tokens.back().literalLength++;
+			else
+				formatter.tokens.push_back({ Lvn_LogToken_Literal, i, 1, nullptr });
+			continue;
+		}
+
+		char symbol = pattern[i + 1];
+
+		// find pattern with matching symbol
+		for (uint32_t j = 0; j < sizeof(s_LogTokenSymbols) / sizeof(LvnLogTokenSymbol); j++)
+		{
+			if (symbol != s_LogTokenSymbols[j].symbol)
+				continue;
+
+			formatter.tokens.push_back({ s_LogTokenSymbols[j].type, 0, 0, nullptr });
+		}
+
+		// find and add user defined patterns
+		for (uint32_t j = 0; j < s_LvnContext->userLogPatterns.size(); j++)
+		{
+			if (symbol != s_LvnContext->userLogPatterns[j].symbol)
+				continue;
+
+			formatter.tokens.push_back({ Lvn_LogToken_User, 0, 0, s_LvnContext->userLogPatterns[j].func });
+		}
+
+		i++; // incramant past symbol on next character in format
+	}
+
+	return formatter;
+}
+
+// broken down local time of the last second a message was logged on this thread, so the timezone lookup happens at most once per second
+static const struct tm* logGetCachedTime(long long timeEpoch)
+{
+	thread_local long long s_CachedSecond = -1;
+	thread_local struct tm s_CachedTime;
+
+	if (timeEpoch != s_CachedSecond)
+	{
+		time_t t = static_cast<time_t>(timeEpoch);
+#ifdef LVN_PLATFORM_WINDOWS
+		localtime_s(&s_CachedTime, &t);
+#else
+		localtime_r(&t, &s_CachedTime);
+#endif
+		s_CachedSecond = timeEpoch;
+	}
+
+	return &s_CachedTime;
+}
+
+static size_t logAppend(char* buffer, size_t size, size_t pos, const char* str, size_t length)
+{
+	if (pos + length > size) { length = size - pos; }
+	memcpy(buffer + pos, str, length);
+	return pos + length;
+}
+
+static size_t logAppendStr(char* buffer, size_t size, size_t pos, const char* str)
+{
+	return lvn::logAppend(buffer, size, pos, str, strlen(str));
+}
+
+static size_t logAppend02d(char* buffer, size_t size, size_t pos, int value)
+{
+	char digits[2] = { static_cast<char>('0' + (value / 10) % 10), static_cast<char>('0' + value % 10) };
+	return lvn::logAppend(buffer, size, pos, digits, 2);
+}
+
+// writes the formatted message into buffer without allocating (unless user defined patterns are used), returns the length written
+static size_t logFormatMessage(const LvnLogFormatter* formatter, LvnLogMessage* msg, char* buffer, size_t size)
+{
+	size_t pos = 0;
+	const struct tm* tm = nullptr;
+
+	for (const LvnLogToken& token : formatter->tokens)
+	{
+		if (token.type >= Lvn_LogToken_Time && token.type <= Lvn_LogToken_MeridiemLower && tm == nullptr)
+			tm = lvn::logGetCachedTime(msg->timeEpoch);
+
+		switch (token.type)
+		{
+			case Lvn_LogToken_Literal: { pos = lvn::logAppend(buffer, size, pos, formatter->pattern.c_str() + token.literalOffset, token.literalLength); break; }
+			case Lvn_LogToken_NewLine: { pos = lvn::logAppend(buffer, size, pos, "\n", 1); break; }
+			case Lvn_LogToken_LoggerName: { pos = lvn::logAppendStr(buffer, size, pos, msg->loggerName); break; }
+			case Lvn_LogToken_Level: { pos = lvn::logAppendStr(buffer, size, pos, lvn::getLogLevelName(msg->level)); break; }
+			case Lvn_LogToken_ColorStart: { pos = lvn::logAppendStr(buffer, size, pos, lvn::getLogLevelColor(msg->level)); break; }
+			case Lvn_LogToken_ColorReset: { pos = lvn::logAppendStr(buffer, size, pos, LVN_LOG_COLOR_RESET); break; }
+			case Lvn_LogToken_Message: { pos = lvn::logAppendStr(buffer, size, pos, msg->msg); break; }
+			case Lvn_LogToken_Percent: { pos = lvn::logAppend(buffer, size, pos, "%", 1); break; }
+			case Lvn_LogToken_Time:
+			case Lvn_LogToken_Time12:
+			{
+				pos = lvn::logAppend02d(buffer, size, pos, token.type == Lvn_LogToken_Time ? tm->tm_hour : ((tm->tm_hour + 11) % 12) + 1);
+				pos = lvn::logAppend(buffer, size, pos, ":", 1);
+				pos = lvn::logAppend02d(buffer, size, pos, tm->tm_min);
+				pos = lvn::logAppend(buffer, size, pos, ":", 1);
+				pos = lvn::logAppend02d(buffer, size, pos, tm->tm_sec);
+				break;
+			}
+			case Lvn_LogToken_Year:
+			{
+				int year = tm->tm_year + 1900;
+				pos = lvn::logAppend02d(buffer, size, pos, year / 100);
+				pos = lvn::logAppend02d(buffer, size, pos, year % 100);
+				break;
+			}
+			case Lvn_LogToken_Year02d: { pos = lvn::logAppend02d(buffer, size, pos, (tm->tm_year + 1900) % 100); break; }
+			case Lvn_LogToken_Month: { pos = lvn::logAppend02d(buffer, size, pos, tm->tm_mon + 1); break; }
+			case Lvn_LogToken_MonthName: { pos = lvn::logAppendStr(buffer, size, pos, s_MonthName[tm->tm_mon]); break; }
+			case Lvn_LogToken_MonthNameShort: { pos = lvn::logAppendStr(buffer, size, pos, s_MonthNameShort[tm->tm_mon]); break; }
+			case Lvn_LogToken_Day: { pos = lvn::logAppend02d(buffer, size, pos, tm->tm_mday); break; }
+			case Lvn_LogToken_WeekDayName: { pos = lvn::logAppendStr(buffer, size, pos, s_WeekDayName[tm->tm_wday]); break; }
+			case Lvn_LogToken_WeekDayNameShort: { pos = lvn::logAppendStr(buffer, size, pos, s_WeekDayNameShort[tm->tm_wday]); break; }
+			case Lvn_LogToken_Hour: { pos = lvn::logAppend02d(buffer, size, pos, tm->tm_hour); break; }
+			case Lvn_LogToken_Hour12: { pos = lvn::logAppend02d(buffer, size, pos, ((tm->tm_hour + 11) % 12) + 1); break; }
+			case Lvn_LogToken_Minute: { pos = lvn::logAppend02d(buffer, size, pos, tm->tm_min); break; }
+			case Lvn_LogToken_Second: { pos = lvn::logAppend02d(buffer, size, pos, tm->tm_sec); break; }
+			case Lvn_LogToken_Meridiem: { pos = lvn::logAppend(buffer, size, pos, tm->tm_hour < 12 ? "AM" : "PM", 2); break; }
+			case Lvn_LogToken_MeridiemLower: { pos = lvn::logAppend(buffer, size, pos, tm->tm_hour < 12 ? "am" : "pm", 2); break; }
+			case Lvn_LogToken_User:
+			{
+				std::string str = token.func(msg);
+				pos = lvn::logAppend(buffer, size, pos, str.c_str(), str.size());
+				break;
+			}
+		}
+	}
+
+	return pos;
+}
+
+LvnResult logInit()
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	if (!lvnctx->logging)
+	{
+		lvnctx->logging = true;
+
+		lvnctx->coreLogger.loggerName = "CORE";
+
+		if (!lvnctx->appName.empty())
+			lvnctx->clientLogger.loggerName = lvnctx->appName;
+		else
+			lvnctx->clientLogger.loggerName = "CLIENT";
+
+		lvnctx->coreLogger.logLevel = lvnctx->clientLogger.logLevel = Lvn_LogLevel_None;
+		lvnctx->coreLogger.logPatternFormat = lvnctx->clientLogger.logPatternFormat = LVN_DEFAULT_LOG_PATTERN;
+		lvnctx->coreLogger.formatter = lvnctx->clientLogger.formatter = lvn::logParseFormat(LVN_DEFAULT_LOG_PATTERN);
+
+		LvnLogSinkCreateInfo stdoutSinkCreateInfo{};
+		stdoutSinkCreateInfo.type = Lvn_LogSinkType_Stdout;
+		stdoutSinkCreateInfo.logLevel = Lvn_LogLevel_None;
+		LvnLogSink* coreSink = lvn::logCreateSink(&stdoutSinkCreateInfo);
+		LvnLogSink* clientSink = lvn::logCreateSink(&stdoutSinkCreateInfo);
+		if (!coreSink || !clientSink)
+		{
+			if (coreSink) { lvn::logDestroySink(coreSink); }
+			if (clientSink) { lvn::logDestroySink(clientSink); }
+			lvnctx->logging = false;
+			return Lvn_Result_Failure;
+		}
+
+		lvnctx->coreLogger.sinks.push_back(coreSink);
+		lvnctx->coreLogger.textSinkCount = 1;
+		lvnctx->clientLogger.sinks.push_back(clientSink);
+		lvnctx->clientLogger.textSinkCount = 1;
+
+		#ifdef LVN_PLATFORM_WINDOWS 
+		enableLogANSIcodeColors();
+		#endif
+
+		return Lvn_Result_Success;
+	}
+
+	return Lvn_Result_AlreadyCalled;
+}
+
+void logEnable(bool enable)
+{
+	lvn::getContext()->logging = enable;
+}
+
+void logEnableCoreLogging(bool enable)
+{
+	lvn::getContext()->enableCoreLogging = enable;
+}
+
+void logSetLevel(LvnLogger* logger, LvnLogLevel level)
+{
+	logger->logLevel = level;
+}
+
+bool logCheckLevel(LvnLogger* logger, LvnLogLevel level)
+{
+	return (level >= logger->logLevel);
+}
+
+bool logShouldOutput(LvnLogger* logger, LvnLogLevel level)
+{
+	if (!s_LvnContext || !s_LvnContext->logging) { return false; }
+	if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return false; }
+	return level >= logger->logLevel;
+}
+
+void logRenameLogger(LvnLogger* logger, const char* name)
+{
+	logger->loggerName = name;
+}
+
+void logOutputMessage(LvnLogger* logger, LvnLogMessage* msg)
+{
+	if (!lvn::getContext()->logging) { return; }
+
+	thread_local char s_OutputBuffer[LVN_LOG_OUTPUT_BUFFER_SIZE];
+
+	// sinks sharing a pattern reuse the message formatted for the previous sink
+	const LvnLogFormatter* formatted = nullptr;
+	size_t length = 0;
+
+	std::shared_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+	for (LvnLogSink* sink : logger->sinks)
+	{
+		if (msg->level < sink->logLevel || sink->type == Lvn_LogSinkType_Binary) { continue; }
+
+		const LvnLogFormatter* formatter = sink->useLoggerPattern ? &logger->formatter : &sink->formatter;
+		if (formatter != formatted)
+		{
+			length = lvn::logFormatMessage(formatter, msg, s_OutputBuffer, LVN_LOG_OUTPUT_BUFFER_SIZE);
+			formatted = formatter;
+		}
+
+		std::lock_guard<std::mutex> lock(sink->mutex);
+		lvn::logSinkWrite(sink, msg, s_OutputBuffer, length);
+	}
+}
+
+void logMessage(LvnLogger* logger, LvnLogLevel level, const char* msg)
+{
+	if (!lvn::getContext()->logging) { return; }
+
+	long long timeEpoch = lvn::dateGetSecondsSinceEpoch();
+
+	if (logger->binarySinkCount)
+	{
+		// unformatted messages are recorded as "%s" with the message as the only argument
+		static const char s_StringFormat[] = "%s";
+		thread_local char s_ArgBuffer[LVN_LOG_BINARY_ARG_BUFFER_SIZE];
+
+		uint32_t length = static_cast<uint32_t>(std::min<size_t>(strlen(msg), LVN_LOG_BINARY_ARG_BUFFER_SIZE - sizeof(uint32_t)));
+		memcpy(s_ArgBuffer, &length, sizeof(uint32_t));
+		memcpy(s_ArgBuffer + sizeof(uint32_t), msg, length);
+
+		lvn::logWriteBinary(logger, level, s_StringFormat, s_ArgBuffer, sizeof(uint32_t) + length, timeEpoch, lvn::clockNowNs());
+		if (!logger->textSinkCount) { return; }
+	}
+
+	lvn::logMessageText(logger, level, msg, timeEpoch);
+}
+
+// outputs the message to the text sinks of the logger, either directly or through the async writer
+static void logMessageText(LvnLogger* logger, LvnLogLevel level, const char* msg, long long timeEpoch)
+{
+	LvnLogMessage logMsg{};
+	logMsg.msg = msg;
+	logMsg.loggerName = logger->loggerName.c_str();
+	logMsg.level = level;
+	logMsg.timeEpoch = timeEpoch;
+
+	LvnContext* lvnctx = lvn::getContext();
+	if (lvnctx->logAsyncWriter.enabled)
+	{
+		lvn::logPushAsync(lvnctx, logger, level, msg, logMsg.timeEpoch);
+
+		// make sure fatal messages are visible before the program possibly aborts
+		if (level == Lvn_LogLevel_Fatal)
+			lvn::logFlush();
+
+		return;
+	}
+
+	logOutputMessage(logger, &logMsg);
+}
+
+// binary sinks get the raw arguments, text sinks get the message formatted into a thread local buffer
+// with a single vsnprintf, messages longer than the buffer are truncated
+static void logMessageArgs(LvnLogger* logger, LvnLogLevel level, const char* fmt, va_list args)
+{
+	if (!lvn::logShouldOutput(logger, level)) { return; }
+
+	long long timeEpoch = lvn::dateGetSecondsSinceEpoch();
+
+	if (logger->binarySinkCount)
+	{
+		thread_local char s_ArgBuffer[LVN_LOG_BINARY_ARG_BUFFER_SIZE];
+
+		va_list binaryArgs;
+		va_copy(binaryArgs, args);
+		size_t argSize = lvn::logEncodeArgs(fmt, binaryArgs, s_ArgBuffer, LVN_LOG_BINARY_ARG_BUFFER_SIZE);
+		va_end(binaryArgs);
+
+		lvn::logWriteBinary(logger, level, fmt, s_ArgBuffer, argSize, timeEpoch, lvn::clockNowNs());
+
+		// no formatting at all if the logger only has binary sinks
+		if (!logger->textSinkCount) { return; }
+	}
+
+	thread_local char s_MsgBuffer[LVN_LOG_MSG_BUFFER_SIZE];
+
+	vsnprintf(s_MsgBuffer, LVN_LOG_MSG_BUFFER_SIZE, fmt, args);
+	lvn::logMessageText(logger, level, s_MsgBuffer, timeEpoch);
+}
+
+void logMessageTrace(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Trace, fmt, args);
+	va_end(args);
+}
+
+void logMessageDebug(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Debug, fmt, args);
+	va_end(args);
+}
+
+void logMessageInfo(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Info, fmt, args);
+	va_end(args);
+}
+
+void logMessageWarn(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Warn, fmt, args);
+	va_end(args);
+}
+
+void logMessageError(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Error, fmt, args);
+	va_end(args);
+}
+
+void logMessageFatal(LvnLogger* logger, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	lvn::logMessageArgs(logger, Lvn_LogLevel_Fatal, fmt, args);
+	va_end(args);
+}
+
+LvnLogger* logGetCoreLogger()
+{
+	return &lvn::getContext()->coreLogger;
+}
+
+LvnLogger* logGetClientLogger()
+{
+	return &lvn::getContext()->clientLogger;
+}
+
+const char* logGetANSIcodeColor(LvnLogLevel level)
+{
+	switch (level)
+	{
+		case Lvn_LogLevel_None:     { return LVN_LOG_COLOR_RESET; }
+		case Lvn_LogLevel_Trace:    { return LVN_LOG_COLOR_TRACE; }
+		case Lvn_LogLevel_Debug:    { return LVN_LOG_COLOR_DEBUG; }
+		case Lvn_LogLevel_Info:     { return LVN_LOG_COLOR_INFO; }
+		case Lvn_LogLevel_Warn:     { return LVN_LOG_COLOR_WARN; }
+		case Lvn_LogLevel_Error:    { return LVN_LOG_COLOR_ERROR; }
+		case Lvn_LogLevel_Fatal:    { return LVN_LOG_COLOR_FATAL; }
+	}
+
+	return nullptr;
+}
+
+LvnResult logSetPatternFormat(LvnLogger* logger, const char* patternfmt)
+{
+	if (!logger) { return Lvn_Result_Failure; }
+	if (!patternfmt || patternfmt[0] == '\0') { return Lvn_Result_Failure; }
+
+	logger->logPatternFormat = patternfmt;
+
+	logger->formatter = lvn::logParseFormat(patternfmt);
+
+	return Lvn_Result_Success;
+}
+
+LvnResult logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count)
+{
+	if (!pLogPatterns) { return Lvn_Result_Failure; }
+	if (pLogPatterns->symbol == '\0') { return Lvn_Result_Failure; }
+
+	for (uint32_t i = 0; i < sizeof(s_LogTokenSymbols) / sizeof(LvnLogTokenSymbol); i++)
+	{
+		for (uint32_t j = 0; j < count; j++)
+		{
+			if (pLogPatterns[j].symbol == s_LogTokenSymbols[i].symbol) { return Lvn_Result_Failure; }
+		}
+	}
+
+	LvnContext* lvnctx = lvn::getContext();
+	lvnctx->userLogPatterns.insert(lvnctx->userLogPatterns.end(), pLogPatterns, pLogPatterns + count);
+
+	return Lvn_Result_Success;
+}
+
+static void logStartAsyncWriter(LvnContext* lvnctx, uint32_t queueSize, LvnLogOverflowPolicy overflowPolicy)
+{
+	LvnLogAsyncWriter& writer = lvnctx->logAsyncWriter;
+	if (writer.enabled) { return; }
+
+	writer.ringBuffer.init(queueSize ? queueSize : 4096);
+	writer.overflowPolicy = overflowPolicy;
+	writer.terminate.store(false);
+	writer.thread = std::thread(lvn::logAsyncWriterThread, lvnctx);
+	writer.enabled = true;
+}
+
+static void logStopAsyncWriter(LvnContext* lvnctx)
+{
+	LvnLogAsyncWriter& writer = lvnctx->logAsyncWriter;
+	if (!writer.enabled) { return; }
+
+	{
+		std::lock_guard<std::mutex> lock(writer.mutex);
+		writer.terminate.store(true);
+	}
+	writer.condition.notify_one();
+	writer.writtenCondition.notify_all();
+	writer.thread.join();
+
+	writer.enabled = false;
+}
+
+static void logAsyncWriterThread(LvnContext* lvnctx)
+{
+	LvnLogAsyncWriter& writer = lvnctx->logAsyncWriter;
+	LvnLogRecord record;
+
+	while (true)
+	{
+		if (writer.ringBuffer.try_pop(&record))
+		{
+			LvnLogMessage logMsg{};
+			logMsg.msg = record.msg;
+			logMsg.loggerName = record.logger->loggerName.c_str();
+			logMsg.level = record.level;
+			logMsg.timeEpoch = record.timeEpoch;
+
+			logOutputMessage(record.logger, &logMsg);
+			writer.written.fetch_add(1); // sequentially consistent so that waiters registered before this are always seen below
+
+			if (writer.waiters.load() > 0)
+			{
+				std::lock_guard<std::mutex> lock(writer.mutex);
+				writer.writtenCondition.notify_all();
+			}
+			continue;
+		}
+
+		fflush(stdout);
+
+		// the queue is drained before the thread exits so that no messages are lost at terminate
+		if (writer.terminate.load()) { break; }
+
+		std::unique_lock<std::mutex> lock(writer.mutex);
+		writer.sleeping.store(true);
+		writer.condition.wait_for(lock, std::chrono::milliseconds(10), [&writer]() { return !writer.ringBuffer.empty() || writer.terminate.load(); });
+		writer.sleeping.store(false);
+	}
+}
+
+// waits until the writer thread has written at least the given number of records
+static void logWaitForWriter(LvnLogAsyncWriter* writer, uint64_t written)
+{
+	if (writer->written.load(std::memory_order_acquire) >= written) { return; }
+
+	writer->waiters.fetch_add(1);
+	{
+		std::unique_lock<std::mutex> lock(writer->mutex);
+		writer->condition.notify_one();
+		writer->writtenCondition.wait(lock, [writer, written]() { return writer->written.load(std::memory_order_acquire) >= written || writer->terminate.load(); });
+	}
+	writer->waiters.fetch_sub(1);
+}
+
+static void logPushAsync(LvnContext* lvnctx, LvnLogger* logger, LvnLogLevel level, const char* msg, long long timeEpoch)
+{
+	LvnLogAsyncWriter& writer = lvnctx->logAsyncWriter;
+
+	auto fillRecord = [&](LvnLogRecord* record)
+	{
+		record->logger = logger;
+		record->level = level;
+		record->timeEpoch = timeEpoch;
+
+		size_t length = strlen(msg);
+		if (length >= LVN_LOG_RECORD_MSG_SIZE) { length = LVN_LOG_RECORD_MSG_SIZE - 1; }
+		memcpy(record->msg, msg, length);
+		record->msg[length] = '\0';
+	};
+
+	while (!writer.ringBuffer.try_push(fillRecord))
+	{
+		if (writer.overflowPolicy == Lvn_LogOverflowPolicy_DropNewest)
+		{
+			writer.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		if (writer.overflowPolicy == Lvn_LogOverflowPolicy_DropOldest)
+		{
+			if (writer.ringBuffer.try_pop(nullptr))
+			{
+				writer.dropped.fetch_add(1, std::memory_order_relaxed);
+				writer.written.fetch_add(1, std::memory_order_release);
+			}
+			continue;
+		}
+
+		// block until the writer thread makes room
+		lvn::logWaitForWriter(&writer, writer.written.load(std::memory_order_acquire) + 1);
+	}
+
+	writer.queued.fetch_add(1, std::memory_order_release);
+
+	if (writer.sleeping.load(std::memory_order_relaxed))
+		writer.condition.notify_one();
+}
+
+void logFlush()
+{
+	LvnContext* lvnctx = lvn::getContext();
+	LvnLogAsyncWriter& writer = lvnctx->logAsyncWriter;
+
+	if (writer.enabled)
+	{
+		// wait for everything queued so far, messages queued while waiting are not waited on
+		uint64_t target = writer.queued.load(std::memory_order_acquire);
+		lvn::logWaitForWriter(&writer, target);
+	}
+
+	lvn::logFlushSinks(&lvnctx->coreLogger);
+	lvn::logFlushSinks(&lvnctx->clientLogger);
+	fflush(stdout);
+}
+
+uint64_t logGetDroppedMessageCount()
+{
+	return lvn::getContext()->logAsyncWriter.dropped.load(std::memory_order_relaxed);
+}
+
+bool logNextFormatSpec(const char* fmt, LvnLogFormatSpec* spec)
+{
+	const char* p = strchr(fmt, '%');
+	if (!p) { return false; }
+
+	*spec = {};
+	spec->begin = p++;
+	spec->width = spec->precision = -1;
+
+	spec->flags = p;
+	while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') { p++; }
+	spec->flagsLength = static_cast<uint32_t>(p - spec->flags);
+
+	if (*p == '*') { spec->widthArg = true; p++; }
+	else if (*p >= '0' && *p <= '9') { spec->width = 0; while (*p >= '0' && *p <= '9') { spec->width = spec->width * 10 + (*p++ - '0'); } }
+
+	if (*p == '.')
+	{
+		p++;
+		spec->precision = 0;
+		if (*p == '*') { spec->precisionArg = true; p++; }
+		else { while (*p >= '0' && *p <= '9') { spec->precision = spec->precision * 10 + (*p++ - '0'); } }
+	}
+
+	switch (*p)
+	{
+		case 'h': { p++; spec->length = (*p == 'h') ? (p++, Lvn_LogArgLength_Char) : Lvn_LogArgLength_Short; break; }
+		case 'l': { p++; spec->length = (*p == 'l') ? (p++, Lvn_LogArgLength_LongLong) : Lvn_LogArgLength_Long; break; }
+		case 'j': { p++; spec->length = Lvn_LogArgLength_IntMax; break; }
+		case 'z': { p++; spec->length = Lvn_LogArgLength_Size; break; }
+		case 't': { p++; spec->length = Lvn_LogArgLength_PtrDiff; break; }
+		case 'L': { p++; spec->length = Lvn_LogArgLength_LongDouble; break; }
+	}
+
+	spec->conversion = *p;
+	switch (*p)
+	{
+		case 'd': case 'i': case 'c':
+			{ spec->argType = Lvn_LogArgType_Int; break; }
+		case 'u': case 'o': case 'x': case 'X':
+			{ spec->argType = Lvn_LogArgType_Uint; break; }
+		case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+			{ spec->argType = Lvn_LogArgType_Double; break; }
+		case 's':
+			{ spec->argType = Lvn_LogArgType_String; break; }
+		case 'p':
+			{ spec->argType = Lvn_LogArgType_Pointer; break; }
+		case '\0':
+			{ spec->end = p; return true; } // format ends in the middle of a specifier
+		default:
+			{ spec->argType = Lvn_LogArgType_None; break; } // %%, %n and unknown conversions
+	}
+
+	spec->end = p + 1;
+	return true;
+}
+
+
+static LvnLogSink* logCreateSink(const LvnLogSinkCreateInfo* sinkCreateInfo)
+{
+	void* memptr = lvn::memAllocTagged(sizeof(LvnLogSink), Lvn_MemoryTag_Core, true);
+	if (!memptr) { return nullptr; }
+
+	LvnLogSink* sink = new (memptr) LvnLogSink();
+	sink->type = sinkCreateInfo->type;
+	sink->logLevel = sinkCreateInfo->logLevel;
+	sink->useLoggerPattern = sinkCreateInfo->logPatternFormat == nullptr;
+
+	if (!sink->useLoggerPattern)
+		sink->formatter = lvn::logParseFormat(sinkCreateInfo->logPatternFormat);
+
+	if (sink->type == Lvn_LogSinkType_File || sink->type == Lvn_LogSinkType_Binary)
+	{
+		sink->filepath = sinkCreateInfo->filepath;
+		sink->buffer.resize(sinkCreateInfo->bufferSize ? sinkCreateInfo->bufferSize : LVN_LOG_SINK_DEFAULT_BUFFER_SIZE);
+		sink->maxFileSize = sinkCreateInfo->maxFileSize;
+		sink->rotateInterval = sinkCreateInfo->rotateInterval;
+		sink->maxFiles = sinkCreateInfo->maxFiles;
+		sink->fsyncPolicy = sinkCreateInfo->fsyncPolicy;
+
+		if (!lvn::logSinkOpenFile(sink, sinkCreateInfo->appendFile ? "ab" : "wb"))
+		{
+			lvn::logDestroySink(sink);
+			return nullptr;
+		}
+	}
+	else if (sink->type == Lvn_LogSinkType_Ring)
+	{
+		sink->buffer.resize(sinkCreateInfo->ringSize ? sinkCreateInfo->ringSize : LVN_LOG_SINK_DEFAULT_BUFFER_SIZE);
+	}
+
+	return sink;
+}
+
+void logDestroySink(LvnLogSink* sink)
+{
+	sink->~LvnLogSink();
+	lvn::memFreeTagged(sink);
+}
+
+static bool logSinkOpenFile(LvnLogSink* sink, const char* mode)
+{
+	sink->file = fopen(sink->filepath.c_str(), mode);
+	if (!sink->file) { return false; }
+
+	// messages are already buffered by the sink
+	setvbuf(sink->file, nullptr, _IONBF, 0);
+
+	fseek(sink->file, 0, SEEK_END);
+	long size = ftell(sink->file);
+	sink->fileSize = size > 0 ? static_cast<uint64_t>(size) : 0;
+	sink->openTime = lvn::dateGetSecondsSinceEpoch();
+
+	// every binary file starts with its own header and format table
+	sink->binaryHeaderWritten = false;
+	sink->formatIds.clear();
+	return true;
+}
+
+static void logSinkFlushFile(LvnLogSink* sink)
+{
+	if (!sink->file || !sink->bufferUsed) { return; }
+
+	fwrite(sink->buffer.data(), 1, sink->bufferUsed, sink->file);
+	sink->fileSize += sink->bufferUsed;
+	sink->bufferUsed = 0;
+
+	if (sink->fsyncPolicy != Lvn_LogFsyncPolicy_Never)
+	{
+#ifdef LVN_PLATFORM_WINDOWS
+		_commit(_fileno(sink->file));
+#else
+		fsync(fileno(sink->file));
+#endif
+	}
+}
+
+// the current file becomes path.1, older files are shifted up by one and the oldest past maxFiles is removed
+static void logSinkRotateFile(LvnLogSink* sink, long long timeEpoch)
+{
+	lvn::logSinkFlushFile(sink);
+	fclose(sink->file);
+	sink->file = nullptr;
+
+	const std::string& path = sink->filepath;
+	if (sink->maxFiles > 0)
+	{
+		std::remove((path + "." + std::to_string(sink->maxFiles)).c_str());
+		for (uint32_t i = sink->maxFiles - 1; i > 0; i--)
+			std::rename((path + "." + std::to_string(i)).c_str(), (path + "." + std::to_string(i + 1)).c_str());
+		std::rename(path.c_str(), (path + ".1").c_str());
+	}
+
+	if (!lvn::logSinkOpenFile(sink, "wb"))
+	{
+		fprintf(stderr, "[levikno] failed to open log file after rotation: \"%s\"\n", path.c_str());
+		return;
+	}
+
+	sink->openTime = timeEpoch;
+}
+
+static void logSinkWrite(LvnLogSink* sink, LvnLogMessage* msg, const char* data, size_t length)
+{
+	switch (sink->type)
+	{
+		case Lvn_LogSinkType_Stdout:
+		{
+			fwrite(data, 1, length, stdout);
+			break;
+		}
+		case Lvn_LogSinkType_File:
+		{
+			if (!lvn::logSinkPrepareFile(sink, length, msg->timeEpoch)) { return; }
+
+			lvn::logSinkWriteFile(sink, data, length);
+
+			// errors are written immediately so they are not lost if the program crashes shortly after
+			if (msg->level >= Lvn_LogLevel_Error || sink->fsyncPolicy == Lvn_LogFsyncPolicy_EveryMessage)
+				lvn::logSinkFlushFile(sink);
+
+			break;
+		}
+		case Lvn_LogSinkType_Ring:
+		{
+			lvn::logSinkWriteRing(sink, data, length);
+			break;
+		}
+		case Lvn_LogSinkType_Binary:
+		{
+			break; // written by logWriteBinary
+		}
+	}
+}
+
+// rotates the file if writing length more bytes would pass the size or time limit, returns false if there is no file to write to
+static bool logSinkPrepareFile(LvnLogSink* sink, size_t length, long long timeEpoch)
+{
+	if (!sink->file) { return false; }
+
+	uint64_t pending = sink->fileSize + sink->bufferUsed;
+	bool sizeLimit = sink->maxFileSize && pending > 0 && pending + length > sink->maxFileSize;
+	bool timeLimit = sink->rotateInterval && timeEpoch - sink->openTime >= static_cast<long long>(sink->rotateInterval);
+	if (sizeLimit || timeLimit)
+		lvn::logSinkRotateFile(sink, timeEpoch);
+
+	return sink->file != nullptr;
+}
+
+static void logSinkWriteFile(LvnLogSink* sink, const char* data, size_t length)
+{
+	if (sink->bufferUsed + length > sink->buffer.size())
+		lvn::logSinkFlushFile(sink);
+
+	if (length > sink->buffer.size()) // message larger than the whole buffer
+	{
+		fwrite(data, 1, length, sink->file);
+		sink->fileSize += length;
+	}
+	else
+	{
+		memcpy(sink->buffer.data() + sink->bufferUsed, data, length);
+		sink->bufferUsed += length;
+	}
+}
+
+// copies the arguments of fmt out of args in the layout described by LvnLogBinaryRecordType, arguments that do not fit are dropped
+static size_t logEncodeArgs(const char* fmt, va_list args, char* buffer, size_t size)
+{
+	size_t pos = 0;
+	bool full = false;
+
+	auto encodeValue = [&](const void* value)
+	{
+		if (full || pos + sizeof(uint64_t) > size) { full = true; return; }
+		memcpy(buffer + pos, value, sizeof(uint64_t));
+		pos += sizeof(uint64_t);
+	};
+
+	LvnLogFormatSpec spec;
+	while (lvn::logNextFormatSpec(fmt, &spec))
+	{
+		fmt = spec.end;
+
+		int64_t width = 0, precision = spec.precision;
+		if (spec.widthArg) { width = va_arg(args, int); encodeValue(&width); }
+		if (spec.precisionArg) { precision = va_arg(args, int); encodeValue(&precision); }
+
+		switch (spec.argType)
+		{
+			case Lvn_LogArgType_Int:
+			{
+				int64_t value;
+				switch (spec.length)
+				{
+					case Lvn_LogArgLength_Char:     { value = static_cast<signed char>(va_arg(args, int)); break; }
+					case Lvn_LogArgLength_Short:    { value = static_cast<short>(va_arg(args, int)); break; }
+					case Lvn_LogArgLength_Long:     { value = va_arg(args, long); break; }
+					case Lvn_LogArgLength_LongLong: { value = va_arg(args, long long); break; }
+					case Lvn_LogArgLength_IntMax:   { value = va_arg(args, intmax_t); break; }
+					case Lvn_LogArgLength_Size:
+					case Lvn_LogArgLength_PtrDiff:  { value = va_arg(args, ptrdiff_t); break; }
+					default:                        { value = va_arg(args, int); break; }
+				}
+				encodeValue(&value);
+				break;
+			}
+			case Lvn_LogArgType_Uint:
+			{
+				uint64_t value;
+				switch (spec.length)
+				{
+					case Lvn_LogArgLength_Char:     { value = static_cast<unsigned char>(va_arg(args, unsigned int)); break; }
+					case Lvn_LogArgLength_Short:    { value = static_cast<unsigned short>(va_arg(args, unsigned int)); break; }
+					case Lvn_LogArgLength_Long:     { value = va_arg(args, unsigned long); break; }
+					case Lvn_LogArgLength_LongLong: { value = va_arg(args, unsigned long long); break; }
+					case Lvn_LogArgLength_IntMax:   { value = va_arg(args, uintmax_t); break; }
+					case Lvn_LogArgLength_Size:
+					case Lvn_LogArgLength_PtrDiff:  { value = va_arg(args, size_t); break; }
+					default:                        { value = va_arg(args, unsigned int); break; }
+				}
+				encodeValue(&value);
+				break;
+			}
+			case Lvn_LogArgType_Double:
+			{
+				double value = spec.length == Lvn_LogArgLength_LongDouble ? static_cast<double>(va_arg(args, long double)) : va_arg(args, double);
+				encodeValue(&value);
+				break;
+			}
+			case Lvn_LogArgType_String:
+			{
+				// wide strings are not converted and recorded as empty strings
+				const char* str = va_arg(args, const char*);
+				if (spec.length == Lvn_LogArgLength_Long) { str = ""; }
+				if (!str) { str = "(null)"; }
+
+				// the precision limits how much of the string is read, the string may not be null terminated
+				uint32_t length = 0;
+				while ((precision < 0 || length < precision) && str[length] != '\0') { length++; }
+
+				if (full || pos + sizeof(uint32_t) > size) { full = true; break; }
+				length = static_cast<uint32_t>(std::min<size_t>(length, size - pos - sizeof(uint32_t)));
+				memcpy(buffer + pos, &length, sizeof(uint32_t));
+				memcpy(buffer + pos + sizeof(uint32_t), str, length);
+				pos += sizeof(uint32_t) + length;
+				break;
+			}
+			case Lvn_LogArgType_Pointer:
+			{
+				uint64_t value = reinterpret_cast<uintptr_t>(va_arg(args, void*));
+				encodeValue(&value);
+				break;
+			}
+			case Lvn_LogArgType_None:
+			{
+				if (spec.conversion == 'n') { va_arg(args, void*); } // not supported, only keep the remaining arguments in place
+				break;
+			}
+		}
+
+		if (spec.conversion == '\0') { break; }
+	}
+
+	return pos;
+}
+
+// writes the message record to every binary sink of the logger, the format string is written once per file the first time it is used
+// timeEpoch is only used for file rotation, the record stores timeNs (from clockNowNs) which the decoder maps to wall time with the anchor in the header
+static void logWriteBinary(LvnLogger* logger, LvnLogLevel level, const char* fmt, const char* args, size_t argSize, long long timeEpoch, uint64_t timeNs)
+{
+	std::shared_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+	for (LvnLogSink* sink : logger->sinks)
+	{
+		if (sink->type != Lvn_LogSinkType_Binary || level < sink->logLevel) { continue; }
+
+		std::lock_guard<std::mutex> lock(sink->mutex);
+
+		char header[1 + 1 + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t)];
+		if (!lvn::logSinkPrepareFile(sink, sizeof(header) + argSize, timeEpoch)) { continue; }
+
+		if (!sink->binaryHeaderWritten)
+		{
+			const std::string& pattern = sink->useLoggerPattern ? logger->logPatternFormat : sink->formatter.pattern;
+			uint16_t nameLength = static_cast<uint16_t>(std::min<size_t>(logger->loggerName.size(), UINT16_MAX));
+			uint16_t patternLength = static_cast<uint16_t>(std::min<size_t>(pattern.size(), UINT16_MAX));
+			uint32_t version = LVN_LOG_BINARY_VERSION, endianCheck = LVN_LOG_BINARY_ENDIAN_CHECK;
+
+			// wall clock anchor, both clocks are sampled together so message times can be converted to dates
+			int64_t anchorEpochNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			uint64_t anchorNs = lvn::clockNowNs();
+
+			char fileHeader[1 + 8 + sizeof(uint32_t) * 2 + sizeof(int64_t) + sizeof(uint64_t) + sizeof(uint16_t) * 2];
+			fileHeader[0] = Lvn_LogBinaryRecord_Header;
+			memcpy(fileHeader + 1, LVN_LOG_BINARY_MAGIC, 8);
+			memcpy(fileHeader + 9, &version, sizeof(uint32_t));
+			memcpy(fileHeader + 13, &endianCheck, sizeof(uint32_t));
+			memcpy(fileHeader + 17, &anchorEpochNs, sizeof(int64_t));
+			memcpy(fileHeader + 25, &anchorNs, sizeof(uint64_t));
+			memcpy(fileHeader + 33, &nameLength, sizeof(uint16_t));
+			memcpy(fileHeader + 35, &patternLength, sizeof(uint16_t));
+
+			lvn::logSinkWriteFile(sink, fileHeader, sizeof(fileHeader));
+			lvn::logSinkWriteFile(sink, logger->loggerName.c_str(), nameLength);
+			lvn::logSinkWriteFile(sink, pattern.c_str(), patternLength);
+			sink->binaryHeaderWritten = true;
+		}
+
+		uint32_t formatId;
+		auto it = sink->formatIds.find(fmt);
+		if (it != sink->formatIds.end())
+		{
+			formatId = it->second;
+		}
+		else
+		{
+			formatId = static_cast<uint32_t>(sink->formatIds.size());
+			sink->formatIds.emplace(fmt, formatId);
+
+			uint32_t formatLength = static_cast<uint32_t>(strlen(fmt));
+			char formatHeader[1 + sizeof(uint32_t) * 2];
+			formatHeader[0] = Lvn_LogBinaryRecord_Format;
+			memcpy(formatHeader + 1, &formatId, sizeof(uint32_t));
+			memcpy(formatHeader + 5, &formatLength, sizeof(uint32_t));
+
+			lvn::logSinkWriteFile(sink, formatHeader, sizeof(formatHeader));
+			lvn::logSinkWriteFile(sink, fmt, formatLength);
+		}
+
+		uint32_t argLength = static_cast<uint32_t>(argSize);
+		header[0] = Lvn_LogBinaryRecord_Message;
+		header[1] = static_cast<char>(level);
+		memcpy(header + 2, &formatId, sizeof(uint32_t));
+		memcpy(header + 6, &timeNs, sizeof(uint64_t));
+		memcpy(header + 14, &argLength, sizeof(uint32_t));
+
+		lvn::logSinkWriteFile(sink, header, sizeof(header));
+		lvn::logSinkWriteFile(sink, args, argSize);
+
+		if (level >= Lvn_LogLevel_Error || sink->fsyncPolicy == Lvn_LogFsyncPolicy_EveryMessage)
+			lvn::logSinkFlushFile(sink);
+	}
+}
+
+static void logSinkWriteRing(LvnLogSink* sink, const char* data, size_t length)
+{
+	uint64_t size = sink->buffer.size();
+	char* ring = sink->buffer.data();
+
+	if (length >= size) // only the tail of the message fits
+	{
+		memcpy(ring, data + (length - size), size);
+		sink->ringHead = 0;
+		sink->ringWrapped = true;
+		return;
+	}
+
+	uint64_t first = std::min<uint64_t>(length, size - sink->ringHead);
+	memcpy(ring + sink->ringHead, data, first);
+	memcpy(ring, data + first, length - first);
+
+	if (sink->ringHead + length >= size) { sink->ringWrapped = true; }
+	sink->ringHead = (sink->ringHead + length) % size;
+}
+
+LvnResult logAddSink(LvnLogger* logger, LvnLogSinkCreateInfo* sinkCreateInfo, uint32_t* pSinkIndex)
+{
+	if (!logger || !sinkCreateInfo) { return Lvn_Result_Failure; }
+
+	bool fileSink = sinkCreateInfo->type == Lvn_LogSinkType_File || sinkCreateInfo->type == Lvn_LogSinkType_Binary;
+	if (fileSink && (!sinkCreateInfo->filepath || sinkCreateInfo->filepath[0] == '\0'))
+	{
+		LVN_CORE_ERROR("logAddSink(LvnLogger*, LvnLogSinkCreateInfo*) | file sink requires a filepath");
+		return Lvn_Result_Failure;
+	}
+
+	LvnLogSink* sink = lvn::logCreateSink(sinkCreateInfo);
+	if (!sink)
+	{
+		LVN_CORE_ERROR("logAddSink(LvnLogger*, LvnLogSinkCreateInfo*) | failed to create sink, could not allocate memory or open log file: \"%s\"", sinkCreateInfo->filepath ? sinkCreateInfo->filepath : "");
+		return Lvn_Result_Failure;
+	}
+
+	std::unique_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+
+	if (pSinkIndex) { *pSinkIndex = static_cast<uint32_t>(logger->sinks.size()); }
+	logger->sinks.push_back(sink);
+
+	if (sink->type == Lvn_LogSinkType_Binary)
+		logger->binarySinkCount++;
+	else
+		logger->textSinkCount++;
+
+	return Lvn_Result_Success;
+}
+
+void logClearSinks(LvnLogger* logger)
+{
+	// waits for messages currently being written to the sinks
+	std::unique_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+
+	for (LvnLogSink* sink : logger->sinks)
+		lvn::logDestroySink(sink);
+
+	logger->sinks.clear();
+	logger->binarySinkCount = 0;
+	logger->textSinkCount = 0;
+}
+
+void logFlushSinks(LvnLogger* logger)
+{
+	std::shared_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+	for (LvnLogSink* sink : logger->sinks)
+	{
+		if (sink->type != Lvn_LogSinkType_File && sink->type != Lvn_LogSinkType_Binary) { continue; }
+
+		std::lock_guard<std::mutex> lock(sink->mutex);
+		lvn::logSinkFlushFile(sink);
+	}
+}
+
+uint64_t logSinkReadRing(LvnLogger* logger, uint32_t sinkIndex, char* buffer, uint64_t size)
+{
+	if (!logger) { return 0; }
+
+	std::shared_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+	if (sinkIndex >= logger->sinks.size()) { return 0; }
+
+	LvnLogSink* sink = logger->sinks[sinkIndex];
+	if (sink->type != Lvn_LogSinkType_Ring) { return 0; }
+
+	std::lock_guard<std::mutex> lock(sink->mutex);
+
+	const char* ring = sink->buffer.data();
+	uint64_t head = sink->ringHead;
+	uint64_t used = sink->ringWrapped ? sink->buffer.size() : head;
+	uint64_t skip = used > size ? used - size : 0; // keep the most recent bytes if the buffer is too small
+	uint64_t copied = 0;
+
+	if (sink->ringWrapped)
+	{
+		uint64_t tailSize = sink->buffer.size() - head;
+		if (skip < tailSize)
+		{
+			memcpy(buffer, ring + head + skip, tailSize - skip);
+			copied = tailSize - skip;
+			skip = 0;
+		}
+		else
+		{
+			skip -= tailSize;
+		}
+	}
+
+	memcpy(buffer + copied, ring + skip, head - skip);
+	copied += head - skip;
+
+	return copied;
+}
+
+LvnResult logSinkDumpRing(LvnLogger* logger, uint32_t sinkIndex, const char* filepath)
+{
+	if (!logger) { return Lvn_Result_Failure; }
+
+	std::vector<char> contents;
+	{
+		std::shared_lock<std::shared_mutex> sinkLock(logger->sinkMutex);
+		if (sinkIndex >= logger->sinks.size() || logger->sinks[sinkIndex]->type != Lvn_LogSinkType_Ring) { return Lvn_Result_Failure; }
+
+		contents.resize(logger->sinks[sinkIndex]->buffer.size());
+	}
+
+	uint64_t size = lvn::logSinkReadRing(logger, sinkIndex, contents.data(), contents.size());
+
+	FILE* file = filepath ? fopen(filepath, "wb") : stderr;
+	if (!file) { return Lvn_Result_Failure; }
+
+	fwrite(contents.data(), 1, size, file);
+
+	if (file != stderr) { fclose(file); }
+	else { fflush(stderr); }
+
+	return Lvn_Result_Success;
+}
+
+LvnResult createLogger(LvnLogger** logger, LvnLoggerCreateInfo* loggerCreateInfo)
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	*logger = lvn::createObject<LvnLogger>(lvnctx, Lvn_Stype_Logger);
+	LvnLogger* loggerPtr = *logger;
+
+	loggerPtr->loggerName = loggerCreateInfo->loggerName;
+	loggerPtr->logPatternFormat = loggerCreateInfo->logPatternFormat;
+	loggerPtr->logLevel = loggerCreateInfo->logLevel;
+
+	loggerPtr->formatter = lvn::logParseFormat(loggerCreateInfo->logPatternFormat.c_str());
+
+	if (loggerCreateInfo->sinkCount == 0)
+	{
+		LvnLogSinkCreateInfo stdoutSinkCreateInfo{};
+		stdoutSinkCreateInfo.type = Lvn_LogSinkType_Stdout;
+		stdoutSinkCreateInfo.logLevel = Lvn_LogLevel_None;
+		LvnLogSink* sink = lvn::logCreateSink(&stdoutSinkCreateInfo);
+		if (!sink)
+		{
+			LVN_CORE_ERROR("createLogger(LvnLogger**, LvnLoggerCreateInfo*) | failed to create stdout sink for logger: \"%s\"", loggerCreateInfo->loggerName.c_str());
+			lvn::destroyObject(lvnctx, loggerPtr, Lvn_Stype_Logger);
+			*logger = nullptr;
+			return Lvn_Result_Failure;
+		}
+
+		loggerPtr->sinks.push_back(sink);
+		loggerPtr->textSinkCount = 1;
+	}
+
+	for (uint32_t i = 0; i < loggerCreateInfo->sinkCount; i++)
+	{
+		if (lvn::logAddSink(loggerPtr, &loggerCreateInfo->pSinks[i]) != Lvn_Result_Success)
+		{
+			LVN_CORE_ERROR("createLogger(LvnLogger**, LvnLoggerCreateInfo*) | failed to create sink at index (%u) for logger: \"%s\"", i, loggerCreateInfo->loggerName.c_str());
+			lvn::destroyObject(lvnctx, loggerPtr, Lvn_Stype_Logger);
+			*logger = nullptr;
+			return Lvn_Result_Failure;
+		}
+	}
+
+	LVN_CORE_TRACE("created logger: (%p), name: \"%s\"", *logger, loggerCreateInfo->loggerName.c_str());
+	return Lvn_Result_Success;
+}
+
+void destroyLogger(LvnLogger* logger)
+{
+	if (logger == nullptr) { return; }
+	LvnContext* lvnctx = lvn::getContext();
+
+	// queued messages still point to the logger
+	lvn::logFlush();
+	lvn::destroyObject(lvnctx, logger, Lvn_Stype_Logger);
+}
+
+// ------------------------------------------------------------
+// [SECTION]: Clock Functions
+// ------------------------------------------------------------
+
+static uint64_t clockReadCounter()
+{
+#if defined(LVN_CLOCK_X86)
+	return __rdtsc();
+#elif defined(LVN_CLOCK_ARM64)
+	uint64_t ticks;
+	asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+	return ticks;
+#else
+	return lvn::clockNowNs();
+#endif
+}
+
+static bool clockHasConstantCounter()
+{
+#if defined(LVN_CLOCK_X86)
+	// invariant tsc runs at a constant rate in all power states and is synchronized across cores
+	uint32_t regs[4] = {};
+	#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0x80000000);
+		if (static_cast<uint32_t>(info[0]) < 0x80000007) { return false; }
+		__cpuid(info, 0x80000007);
+		regs[3] = static_cast<uint32_t>(info[3]);
+	#else
+		if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) { return false; }
+		__get_cpuid(0x80000007, &regs[0], &regs[1], &regs[2], &regs[3]);
+	#endif
+	return (regs[3] & (1u << 8)) != 0;
+#elif defined(LVN_CLOCK_ARM64)
+	return true;
+#else
+	return false;
+#endif
+}
+
+static void clockCalibrate()
+{
+	s_LvnClock.useCounter = lvn::clockHasConstantCounter();
+	s_LvnClock.originNs = lvn::clockNowNs();
+	s_LvnClock.originTicks = s_LvnClock.useCounter ? lvn::clockReadCounter() : s_LvnClock.originNs;
+	s_LvnClock.baseNs.store(s_LvnClock.originNs);
+	s_LvnClock.baseTicks.store(s_LvnClock.originTicks);
+	s_LvnClock.nsPerTick.store(1.0);
+	s_LvnClock.rebaseTicks = 1000000000ull;
+	s_LvnClock.measuredNsPerTick.store(1.0);
+
+	if (!s_LvnClock.useCounter) { return; }
+
+	double nsPerTick = 0.0;
+
+#if defined(LVN_CLOCK_ARM64)
+	// the generic timer reports its own frequency
+	uint64_t frequency;
+	asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+	if (frequency != 0) { nsPerTick = 1e9 / static_cast<double>(frequency); }
+#endif
+
+	if (nsPerTick == 0.0)
+	{
+		// measure the counter against the monotonic clock for a few milliseconds, the rate is refined each time the base is resampled
+		uint64_t endNs = s_LvnClock.originNs, endTicks = s_LvnClock.originTicks;
+		while (endNs - s_LvnClock.originNs < 5000000)
+		{
+			endNs = lvn::clockNowNs();
+			endTicks = lvn::clockReadCounter();
+		}
+
+		if (endTicks <= s_LvnClock.originTicks)
+		{
+			s_LvnClock.useCounter = false;
+			s_LvnClock.originTicks = s_LvnClock.originNs;
+			s_LvnClock.baseTicks.store(s_LvnClock.originNs);
+			return;
+		}
+
+		nsPerTick = static_cast<double>(endNs - s_LvnClock.originNs) / static_cast<double>(endTicks - s_LvnClock.originTicks);
+	}
+
+	s_LvnClock.nsPerTick.store(nsPerTick);
+	s_LvnClock.measuredNsPerTick.store(nsPerTick);
+	s_LvnClock.rebaseTicks = static_cast<uint64_t>(1e9 / nsPerTick);
+
+	// the previous segment covers ticks read before calibration with the same rate
+	s_LvnClock.prevBaseTicks.store(s_LvnClock.originTicks);
+	s_LvnClock.prevBaseNs.store(s_LvnClock.originNs);
+	s_LvnClock.prevNsPerTick.store(nsPerTick);
+}
+
+// compares the conversion against clockNowNs again, only one thread rebases at a time
+// the new segment starts where the current one is at now so the conversion stays continuous, instead of stepping to clockNowNs its rate
+// is set so that the error is slewed away over the next interval, which keeps the conversion monotonic
+static void clockRebase(uint32_t sequence)
+{
+	if (!s_LvnClock.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) { return; }
+
+	uint64_t nowNs = lvn::clockNowNs();
+	uint64_t nowTicks = lvn::clockReadCounter();
+
+	uint64_t baseTicks = s_LvnClock.baseTicks.load(std::memory_order_relaxed);
+	uint64_t baseNs = s_LvnClock.baseNs.load(std::memory_order_relaxed);
+	double nsPerTick = s_LvnClock.nsPerTick.load(std::memory_order_relaxed);
+	uint64_t convertedNs = baseNs + static_cast<int64_t>(static_cast<double>(static_cast<int64_t>(nowTicks - baseTicks)) * nsPerTick);
+
+	// the rate is measured over the whole time since calibration, which averages out the error of the first short measurement
+	double measuredNsPerTick = s_LvnClock.measuredNsPerTick.load(std::memory_order_relaxed);
+	if (nowTicks > s_LvnClock.originTicks && nowNs > s_LvnClock.originNs)
+	{
+		measuredNsPerTick = static_cast<double>(nowNs - s_LvnClock.originNs) / static_cast<double>(nowTicks - s_LvnClock.originTicks);
+		s_LvnClock.measuredNsPerTick.store(measuredNsPerTick, std::memory_order_relaxed);
+	}
+
+	// catch up with (or fall back to) clockNowNs by the next rebase, never slower than half the measured rate so time always moves forward
+	double errorNs = static_cast<double>(static_cast<int64_t>(nowNs - convertedNs));
+	double slewedNsPerTick = measuredNsPerTick + errorNs / static_cast<double>(s_LvnClock.rebaseTicks);
+	if (slewedNsPerTick < measuredNsPerTick * 0.5) { slewedNsPerTick = measuredNsPerTick * 0.5; }
+
+	s_LvnClock.prevBaseTicks.store(baseTicks, std::memory_order_relaxed);
+	s_LvnClock.prevBaseNs.store(baseNs, std::memory_order_relaxed);
+	s_LvnClock.prevNsPerTick.store(nsPerTick, std::memory_order_relaxed);
+	s_LvnClock.baseTicks.store(nowTicks, std::memory_order_relaxed);
+	s_LvnClock.baseNs.store(convertedNs, std::memory_order_relaxed);
+	s_LvnClock.nsPerTick.store(slewedNsPerTick, std::memory_order_relaxed);
+	s_LvnClock.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+uint64_t clockNowNs()
+{
+#if defined(LVN_PLATFORM_WINDOWS)
+	static const uint64_t s_Frequency = []() { LARGE_INTEGER frequency; QueryPerformanceFrequency(&frequency); return static_cast<uint64_t>(frequency.QuadPart); }();
+
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	uint64_t ticks = static_cast<uint64_t>(counter.QuadPart);
+
+	// split to keep ticks * 1e9 from overflowing
+	return (ticks / s_Frequency) * 1000000000ull + (ticks % s_Frequency) * 1000000000ull / s_Frequency;
+#else
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+}
+
+uint64_t clockNowTicks()
+{
+	std::call_once(s_LvnClockOnce, lvn::clockCalibrate);
+	return s_LvnClock.useCounter ? lvn::clockReadCounter() : lvn::clockNowNs();
+}
+
+uint64_t clockTicksToNs(uint64_t ticks)
+{
+	std::call_once(s_LvnClockOnce, lvn::clockCalibrate);
+	if (!s_LvnClock.useCounter) { return ticks; }
+
+	bool rebased = false;
+	while (true)
+	{
+		uint32_t sequence = s_LvnClock.sequence.load(std::memory_order_acquire);
+		uint64_t baseTicks = s_LvnClock.baseTicks.load(std::memory_order_relaxed);
+		uint64_t baseNs = s_LvnClock.baseNs.load(std::memory_order_relaxed);
+		double nsPerTick = s_LvnClock.nsPerTick.load(std::memory_order_relaxed);
+		uint64_t prevBaseTicks = s_LvnClock.prevBaseTicks.load(std::memory_order_relaxed);
+		uint64_t prevBaseNs = s_LvnClock.prevBaseNs.load(std::memory_order_relaxed);
+		double prevNsPerTick = s_LvnClock.prevNsPerTick.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if ((sequence & 1) || sequence != s_LvnClock.sequence.load(std::memory_order_relaxed)) { continue; }
+
+		// signed difference so that ticks read before the base still convert
+		int64_t delta = static_cast<int64_t>(ticks - baseTicks);
+
+		// ticks read before the base belong to the previous segment, which is continuous with the current one at the base
+		if (delta < 0)
+			return prevBaseNs + static_cast<int64_t>(static_cast<double>(static_cast<int64_t>(ticks - prevBaseTicks)) * prevNsPerTick);
+
+		// a base older than about a second is resampled so that small errors in the rate do not add up over long runs
+		if (!rebased && delta > static_cast<int64_t>(s_LvnClock.rebaseTicks))
+		{
+			lvn::clockRebase(sequence);
+			rebased = true;
+			continue;
+		}
+
+		return baseNs + static_cast<int64_t>(static_cast<double>(delta) * nsPerTick);
+	}
+}
+
+double clockGetTickFrequency()
+{
+	std::call_once(s_LvnClockOnce, lvn::clockCalibrate);
+	return 1e9 / s_LvnClock.measuredNsPerTick.load(std::memory_order_relaxed);
+}
+
+double clockNsToSeconds(uint64_t ns)
+{
+	return static_cast<double>(ns) * 1e-9;
+}
+
+double clockNsToMs(uint64_t ns)
+{
+	return static_cast<double>(ns) * 1e-6;
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Thread Functions
+// ------------------------------------------------------------
+
+uint32_t threadGetCoreCount()
+{
+	uint32_t coreCount = std::thread::hardware_concurrency();
+	return coreCount > 0 ? coreCount : 1;
+}
+
+uint32_t threadGetCacheDomainCores(uint32_t core, uint32_t* pCores, uint32_t maxCount)
+{
+	if (!pCores || maxCount == 0) { return 0; }
+
+	std::vector<uint32_t> domain;
+
+#if defined(LVN_PLATFORM_WINDOWS)
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	if (core < sizeof(ULONG_PTR) * 8 && !infos.empty() && GetLogicalProcessorInformation(infos.data(), &length))
+	{
+		// the highest level cache containing the core
+		ULONG_PTR coreMask = static_cast<ULONG_PTR>(1) << core, domainMask = 0;
+		BYTE highestLevel = 0;
+		for (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& info : infos)
+		{
+			if (info.Relationship == RelationCache && (info.ProcessorMask & coreMask) && info.Cache.Level > highestLevel)
+			{
+				highestLevel = info.Cache.Level;
+				domainMask = info.ProcessorMask;
+			}
+		}
+
+		for (uint32_t i = 0; i < sizeof(ULONG_PTR) * 8; i++)
+			if (domainMask & (static_cast<ULONG_PTR>(1) << i)) { domain.push_back(i); }
+	}
+#elif defined(LVN_PLATFORM_LINUX)
+	// find the highest level cache of the core, then read the list of cores sharing it (eg. "0-3,8-11")
+	char path[128];
+	int highestIndex = -1, highestLevel = 0;
+	for (int index = 0; ; index++)
+	{
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%d/level", core, index);
+		FILE* file = fopen(path, "r");
+		if (!file) { break; }
+
+		int level = 0;
+		if (fscanf(file, "%d", &level) == 1 && level > highestLevel)
+		{
+			highestLevel = level;
+			highestIndex = index;
+		}
+		fclose(file);
+	}
+
+	if (highestIndex >= 0)
+	{
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%d/shared_cpu_list", core, highestIndex);
+		if (FILE* file = fopen(path, "r"))
+		{
+			unsigned int first, last;
+			while (fscanf(file, "%u", &first) == 1)
+			{
+				last = first;
+				int separator = fgetc(file);
+				if (separator == '-')
+				{
+					if (fscanf(file, "%u", &last) != 1) { break; }
+					separator = fgetc(file);
+				}
+
+				for (uint32_t i = first; i <= last; i++)
+					domain.push_back(i);
+
+				if (separator != ',') { break; }
+			}
+			fclose(file);
+		}
+	}
+#endif
+
+	// topology unknown, the core is only known to share its cache with itself
+	if (domain.empty())
+		domain.push_back(core);
+
+	uint32_t count = std::min(static_cast<uint32_t>(domain.size()), maxCount);
+	memcpy(pCores, domain.data(), count * sizeof(uint32_t));
+	return count;
+}
+
+LvnResult threadSetAffinity(const uint32_t* pCores, uint32_t coreCount)
+{
+	if (!pCores || coreCount == 0)
+	{
+		LVN_CORE_ERROR("threadSetAffinity(const uint32_t*, uint32_t) | no cores were given to set the thread affinity to");
+		return Lvn_Result_Failure;
+	}
+
+#if defined(LVN_PLATFORM_WINDOWS)
+	DWORD_PTR mask = 0;
+	for (uint32_t i = 0; i < coreCount; i++)
+		if (pCores[i] < sizeof(DWORD_PTR) * 8) { mask |= static_cast<DWORD_PTR>(1) << pCores[i]; }
+
+	if (mask == 0 || SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+	{
+		LVN_CORE_ERROR("threadSetAffinity(const uint32_t*, uint32_t) | failed to set the thread affinity");
+		return Lvn_Result_Failure;
+	}
+
+	return Lvn_Result_Success;
+#elif defined(LVN_PLATFORM_LINUX)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	for (uint32_t i = 0; i < coreCount; i++)
+		if (pCores[i] < CPU_SETSIZE) { CPU_SET(pCores[i], &cpuSet); }
+
+	if (CPU_COUNT(&cpuSet) == 0 || pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0)
+	{
+		LVN_CORE_ERROR("threadSetAffinity(const uint32_t*, uint32_t) | failed to set the thread affinity");
+		return Lvn_Result_Failure;
+	}
+
+	return Lvn_Result_Success;
+#else
+	// macOS does not let threads be pinned to cores
+	return Lvn_Result_Failure;
+#endif
+}
+
+LvnResult threadSetPriority(LvnThreadPriority priority)
+{
+#if defined(LVN_PLATFORM_WINDOWS)
+	int threadPriority = THREAD_PRIORITY_NORMAL;
+	switch (priority)
+	{
+		case Lvn_ThreadPriority_Low:     { threadPriority = THREAD_PRIORITY_BELOW_NORMAL; break; }
+		case Lvn_ThreadPriority_High:    { threadPriority = THREAD_PRIORITY_ABOVE_NORMAL; break; }
+		case Lvn_ThreadPriority_Highest: { threadPriority = THREAD_PRIORITY_HIGHEST; break; }
+		default: { break; }
+	}
+
+	if (!SetThreadPriority(GetCurrentThread(), threadPriority))
+	{
+		LVN_CORE_WARN("threadSetPriority(LvnThreadPriority) | failed to set the thread priority");
+		return Lvn_Result_Failure;
+	}
+
+	return Lvn_Result_Success;
+#elif defined(LVN_PLATFORM_LINUX)
+	sched_param param{};
+
+	// realtime round robin scheduling needs CAP_SYS_NICE or an rtprio limit, use a high nice value otherwise
+	if (priority == Lvn_ThreadPriority_Highest)
+	{
+		param.sched_priority = sched_get_priority_min(SCHED_RR);
+		if (pthread_setschedparam(pthread_self(), SCHED_RR, &param) == 0)
+			return Lvn_Result_Success;
+
+		priority = Lvn_ThreadPriority_High;
+		param.sched_priority = 0;
+	}
+
+	pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
 
-	int len = vsnprintf(nullptr, 0, fmt, argptr);
-	buff.resize(len + 1);
-	vsnprintf(&buff[0], len + 1, fmt, argcopy);
-	logMessage(logger, Lvn_LogLevel_Fatal, buff.data());
+	int niceValue = 0;
+	switch (priority)
+	{
+		case Lvn_ThreadPriority_Low:  { niceValue = 10; break; }
+		case Lvn_ThreadPriority_High: { niceValue = -5; break; }
+		default: { break; }
+	}
 
-	va_end(argcopy);
-	va_end(argptr);
-}
+	// linux threads have their own nice value, set through their thread id
+	if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), niceValue) != 0)
+	{
+		LVN_CORE_WARN("threadSetPriority(LvnThreadPriority) | failed to set the thread priority, raising the priority may need elevated permissions");
+		return Lvn_Result_Failure;
+	}
 
-LvnLogger* logGetCoreLogger()
-{
-	return &lvn::getContext()->coreLogger;
+	return Lvn_Result_Success;
+#else
+	qos_class_t qosClass = QOS_CLASS_DEFAULT;
+	switch (priority)
+	{
+		case Lvn_ThreadPriority_Low:     { qosClass = QOS_CLASS_UTILITY; break; }
+		case Lvn_ThreadPriority_High:    { qosClass = QOS_CLASS_USER_INITIATED; break; }
+		case Lvn_ThreadPriority_Highest: { qosClass = QOS_CLASS_USER_INTERACTIVE; break; }
+		default: { break; }
+	}
+
+	if (pthread_set_qos_class_self_np(qosClass, 0) != 0)
+	{
+		LVN_CORE_WARN("threadSetPriority(LvnThreadPriority) | failed to set the thread priority");
+		return Lvn_Result_Failure;
+	}
+
+	return Lvn_Result_Success;
+#endif
 }
 
-LvnLogger* logGetClientLogger()
+void threadSetName(const char* name)
 {
-	return &lvn::getContext()->clientLogger;
+	if (!name) { return; }
+
+	lvn::profileSetThreadName(name);
+
+#if defined(LVN_PLATFORM_WINDOWS)
+	// SetThreadDescription is only available from Windows 10 1607
+	typedef HRESULT (WINAPI *PFN_SetThreadDescription)(HANDLE, PCWSTR);
+	PFN_SetThreadDescription setThreadDescription = reinterpret_cast<PFN_SetThreadDescription>(reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+	if (!setThreadDescription) { return; }
+
+	wchar_t wideName[64];
+	if (MultiByteToWideChar(CP_UTF8, 0, name, -1, wideName, 64) > 0)
+		setThreadDescription(GetCurrentThread(), wideName);
+#elif defined(LVN_PLATFORM_LINUX)
+	// names are limited to 15 characters
+	char shortName[16];
+	snprintf(shortName, sizeof(shortName), "%s", name);
+	pthread_setname_np(pthread_self(), shortName);
+#else
+	pthread_setname_np(name);
+#endif
 }
 
-const char* logGetANSIcodeColor(LvnLogLevel level)
+LvnThreadPool* getJobThreadPool()
 {
-	switch (level)
-	{
-		case Lvn_LogLevel_None:     { return LVN_LOG_COLOR_RESET; }
-		case Lvn_LogLevel_Trace:    { return LVN_LOG_COLOR_TRACE; }
-		case Lvn_LogLevel_Debug:    { return LVN_LOG_COLOR_DEBUG; }
-		case Lvn_LogLevel_Info:     { return LVN_LOG_COLOR_INFO; }
-		case Lvn_LogLevel_Warn:     { return LVN_LOG_COLOR_WARN; }
-		case Lvn_LogLevel_Error:    { return LVN_LOG_COLOR_ERROR; }
-		case Lvn_LogLevel_Fatal:    { return LVN_LOG_COLOR_FATAL; }
-	}
+	LvnContext* lvnctx = lvn::getContext();
 
-	return nullptr;
+	std::lock_guard<std::mutex> lock(lvnctx->jobThreadPoolMutex);
+	if (!lvnctx->jobThreadPool)
+		lvnctx->jobThreadPool = lvn::createThreadPool(lvnctx->jobPoolConfig);
+
+	return lvnctx->jobThreadPool;
 }
 
-LvnResult logSetPatternFormat(LvnLogger* logger, const char* patternfmt)
+
+// ------------------------------------------------------------
+// [SECTION]: Profiling Functions
+// ------------------------------------------------------------
+
+#ifdef LVN_ENABLE_PROFILING
+static LvnProfileThreadBuffer* profileGetThreadBuffer()
 {
-	if (!logger) { return Lvn_Result_Failure; }
-	if (!patternfmt || patternfmt[0] == '\0') { return Lvn_Result_Failure; }
+	static thread_local LvnProfileThreadBuffer* s_ThreadBuffer = nullptr;
+	if (s_ThreadBuffer) { return s_ThreadBuffer; }
 
-	logger->logPatternFormat = patternfmt;
+	LvnProfileThreadBuffer* buffer = new LvnProfileThreadBuffer();
+	buffer->session.store(0);
+	buffer->count.store(0);
+	buffer->first = new LvnProfileChunk();
+	buffer->current = buffer->first;
 
-	logger->logPatterns = lvn::logParseFormat(patternfmt);
+	std::lock_guard<std::mutex> lock(s_LvnProfiler.mutex);
+	buffer->threadId = static_cast<uint32_t>(s_LvnProfiler.buffers.size()) + 1;
+	s_LvnProfiler.buffers.push_back(buffer);
 
-	return Lvn_Result_Success;
+	s_ThreadBuffer = buffer;
+	return buffer;
 }
 
-LvnResult logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count)
+static void profileWriteTrace(FILE* file)
 {
-	if (!pLogPatterns) { return Lvn_Result_Failure; }
-	if (pLogPatterns->symbol == '\0') { return Lvn_Result_Failure; }
+	long long processId = 1;
+	fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%lld,\"tid\":0,\"args\":%s}", processId,
+		nlm::json({ { "name", (s_LvnContext && !s_LvnContext->appName.empty()) ? s_LvnContext->appName : "levikno" } }).dump().c_str());
 
-	for (uint32_t i = 0; i < sizeof(s_LogPatterns) / sizeof(LvnLogPattern); i++)
+	uint32_t session = s_LvnProfiler.session.load();
+	for (LvnProfileThreadBuffer* buffer : s_LvnProfiler.buffers)
 	{
-		for (uint32_t j = 0; j < count; j++)
+		if (buffer->session.load(std::memory_order_acquire) != session) { continue; }
+
+		if (!buffer->threadName.empty())
+		{
+			fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lld,\"tid\":%u,\"args\":%s}", processId, buffer->threadId,
+				nlm::json({ { "name", buffer->threadName } }).dump().c_str());
+		}
+
+		uint64_t count = buffer->count.load(std::memory_order_acquire);
+		LvnProfileChunk* chunk = buffer->first;
+		for (uint64_t i = 0; i < count && chunk; i++)
 		{
-			if (pLogPatterns[j].symbol == s_LogPatterns[i].symbol) { return Lvn_Result_Failure; }
+			const LvnProfileZone& zone = chunk->zones[i % LVN_PROFILE_CHUNK_SIZE];
+
+			// timestamps are in microseconds relative to the start of the session, scopes that were already open when the session began are cut at its start
+			uint64_t startNs = std::max(zone.startNs, s_LvnProfiler.sessionStartNs);
+			uint64_t durationNs = zone.endNs > startNs ? zone.endNs - startNs : 0;
+			fprintf(file, ",\n{\"name\":%s,\"cat\":\"lvn\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%lld,\"tid\":%u}",
+				nlm::json(zone.name).dump().c_str(), (startNs - s_LvnProfiler.sessionStartNs) * 0.001, durationNs * 0.001, processId, buffer->threadId);
+
+			if ((i + 1) % LVN_PROFILE_CHUNK_SIZE == 0)
+				chunk = chunk->next.load(std::memory_order_acquire);
 		}
 	}
 
-	LvnContext* lvnctx = lvn::getContext();
-	lvnctx->userLogPatterns.insert(lvnctx->userLogPatterns.end(), pLogPatterns, pLogPatterns + count);
+	fprintf(file, "\n]}\n");
+}
+#endif
+
+LvnResult profileBeginSession()
+{
+#ifdef LVN_ENABLE_PROFILING
+	std::lock_guard<std::mutex> lock(s_LvnProfiler.mutex);
+	if (s_LvnProfiler.recording.load())
+	{
+		LVN_CORE_WARN("profileBeginSession() | a profiling session is already running");
+		return Lvn_Result_AlreadyCalled;
+	}
 
+	// threads reset their buffers when they record their first zone of the new session
+	s_LvnProfiler.sessionStartNs = lvn::profileGetTimeNs();
+	s_LvnProfiler.session.fetch_add(1, std::memory_order_release);
+	s_LvnProfiler.recording.store(true, std::memory_order_release);
 	return Lvn_Result_Success;
+#else
+	LVN_CORE_WARN("profileBeginSession() | the library was built without LVN_ENABLE_PROFILING, zones are not recorded");
+	return Lvn_Result_Failure;
+#endif
 }
 
-LvnResult createLogger(LvnLogger** logger, LvnLoggerCreateInfo* loggerCreateInfo)
+LvnResult profileEndSession(const char* filepath)
 {
-	LvnContext* lvnctx = lvn::getContext();
+#ifdef LVN_ENABLE_PROFILING
+	std::lock_guard<std::mutex> lock(s_LvnProfiler.mutex);
+	if (!s_LvnProfiler.recording.load())
+	{
+		LVN_CORE_ERROR("profileEndSession(const char*) | no profiling session is running");
+		return Lvn_Result_Failure;
+	}
 
-	*logger = lvn::createObject<LvnLogger>(lvnctx, Lvn_Stype_Logger);
-	LvnLogger* loggerPtr = *logger;
+	s_LvnProfiler.recording.store(false, std::memory_order_release);
+	if (!filepath) { return Lvn_Result_Success; }
 
-	loggerPtr->loggerName = loggerCreateInfo->loggerName;
-	loggerPtr->logPatternFormat = loggerCreateInfo->logPatternFormat;
-	loggerPtr->logLevel = loggerCreateInfo->logLevel;
+	FILE* file = fopen(filepath, "w");
+	if (!file)
+	{
+		LVN_CORE_ERROR("profileEndSession(const char*) | failed to open file to write trace: \"%s\"", filepath);
+		return Lvn_Result_Failure;
+	}
 
-	loggerPtr->logPatterns = lvn::logParseFormat(loggerCreateInfo->logPatternFormat.c_str());
+	lvn::profileWriteTrace(file);
+	fclose(file);
 
-	LVN_CORE_TRACE("created logger: (%p), name: \"%s\"", *logger, loggerCreateInfo->loggerName.c_str());
+	LVN_CORE_TRACE("profiling session written to trace file: \"%s\"", filepath);
 	return Lvn_Result_Success;
+#else
+	(void)filepath;
+	LVN_CORE_ERROR("profileEndSession(const char*) | the library was built without LVN_ENABLE_PROFILING");
+	return Lvn_Result_Failure;
+#endif
 }
 
-void destroyLogger(LvnLogger* logger)
+bool profileIsRecording()
 {
-	if (logger == nullptr) { return; }
-	LvnContext* lvnctx = lvn::getContext();
-	lvn::destroyObject(lvnctx, logger, Lvn_Stype_Logger);
+#ifdef LVN_ENABLE_PROFILING
+	return s_LvnProfiler.recording.load(std::memory_order_relaxed);
+#else
+	return false;
+#endif
+}
+
+uint64_t profileGetTimeNs()
+{
+	// reading the cycle counter is cheaper than a clock call, zones are converted to nanoseconds right away so they can be compared across threads
+	return lvn::clockTicksToNs(lvn::clockNowTicks());
+}
+
+void profileRecordZone(const char* name, uint64_t startNs, uint64_t endNs)
+{
+#ifdef LVN_ENABLE_PROFILING
+	if (!s_LvnProfiler.recording.load(std::memory_order_relaxed)) { return; }
+
+	LvnProfileThreadBuffer* buffer = lvn::profileGetThreadBuffer();
+
+	uint32_t session = s_LvnProfiler.session.load(std::memory_order_acquire);
+	uint64_t index = buffer->count.load(std::memory_order_relaxed);
+	if (buffer->session.load(std::memory_order_relaxed) != session)
+	{
+		index = 0;
+		buffer->current = buffer->first;
+		buffer->count.store(0, std::memory_order_relaxed);
+		buffer->session.store(session, std::memory_order_release);
+	}
+
+	if (index > 0 && index % LVN_PROFILE_CHUNK_SIZE == 0)
+	{
+		LvnProfileChunk* next = buffer->current->next.load(std::memory_order_relaxed);
+		if (!next)
+		{
+			next = new LvnProfileChunk();
+			buffer->current->next.store(next, std::memory_order_release);
+		}
+		buffer->current = next;
+	}
+
+	buffer->current->zones[index % LVN_PROFILE_CHUNK_SIZE] = { name, startNs, endNs };
+	buffer->count.store(index + 1, std::memory_order_release);
+#else
+	(void)name; (void)startNs; (void)endNs;
+#endif
+}
+
+void profileSetThreadName(const char* name)
+{
+#ifdef LVN_ENABLE_PROFILING
+	if (!name) { return; }
+
+	LvnProfileThreadBuffer* buffer = lvn::profileGetThreadBuffer();
+	std::lock_guard<std::mutex> lock(s_LvnProfiler.mutex);
+	buffer->threadName = name;
+#else
+	(void)name;
+#endif
 }
 
 // ------------------------------------------------------------
@@ -1652,12 +4014,15 @@ void destroyWindow(LvnWindow* window)
 {
 	if (window == nullptr) { return; }
 	LvnContext* lvnctx = lvn::getContext();
+	lvn::renderDisableGpuTiming(window);
+	if (lvnctx->frameStatsWindow == window) { lvnctx->frameStatsWindow = nullptr; }
 	lvnctx->windowContext.destroyWindow(window);
 	lvn::destroyObject(lvnctx, window, Lvn_Stype_Window);
 }
 
 void windowUpdate(LvnWindow* window)
 {
+	LVN_PROFILE_FUNCTION();
 	lvn::getContext()->windowContext.updateWindow(window);
 }
 
@@ -1865,6 +4230,10 @@ void renderCmdDraw(LvnWindow* window, uint32_t vertexCount)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
+	window->frameStats.current.drawCalls++;
+	window->frameStats.current.instances++;
+	window->frameStats.current.vertices += vertexCount;
+
 	lvn::getContext()->graphicsContext.renderCmdDraw(window, vertexCount);
 }
 
@@ -1874,6 +4243,11 @@ void renderCmdDrawIndexed(LvnWindow* window, uint32_t indexCount)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
+	window->frameStats.current.drawCalls++;
+	window->frameStats.current.indexedDrawCalls++;
+	window->frameStats.current.instances++;
+	window->frameStats.current.indices += indexCount;
+
 	lvn::getContext()->graphicsContext.renderCmdDrawIndexed(window, indexCount);
 }
 
@@ -1883,6 +4257,11 @@ void renderCmdDrawInstanced(LvnWindow* window, uint32_t vertexCount, uint32_t in
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
+	window->frameStats.current.drawCalls++;
+	window->frameStats.current.instancedDrawCalls++;
+	window->frameStats.current.instances += instanceCount;
+	window->frameStats.current.vertices += static_cast<uint64_t>(vertexCount) * instanceCount;
+
 	lvn::getContext()->graphicsContext.renderCmdDrawInstanced(window, vertexCount, instanceCount, firstInstance);
 }
 
@@ -1892,6 +4271,12 @@ void renderCmdDrawIndexedInstanced(LvnWindow* window, uint32_t indexCount, uint3
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
+	window->frameStats.current.drawCalls++;
+	window->frameStats.current.indexedDrawCalls++;
+	window->frameStats.current.instancedDrawCalls++;
+	window->frameStats.current.instances += instanceCount;
+	window->frameStats.current.indices += static_cast<uint64_t>(indexCount) * instanceCount;
+
 	lvn::getContext()->graphicsContext.renderCmdDrawIndexedInstanced(window, indexCount, instanceCount, firstInstance);
 }
 
@@ -1907,15 +4292,49 @@ void renderCmdSetStencilMask(uint32_t compareMask, uint32_t writeMask)
 
 void renderBeginNextFrame(LvnWindow* window)
 {
+	LVN_PROFILE_FUNCTION();
+	LvnContext* lvnctx = lvn::getContext();
+
+	// the frame arenas rotate once per frame for the whole context, with several windows the next frame starts when
+	// a window that already began a frame in the current epoch begins another one
+	if (window->frameArenaEpoch == lvnctx->frameArenaEpoch)
+	{
+		// move on to the next frame arena, arenas of the frames before it stay valid until they come around again
+		uint32_t frameIndex = (lvnctx->frameArenaIndex.load(std::memory_order_relaxed) + 1) % lvnctx->frameArenas.size();
+		lvn::resetFrameArena(&lvnctx->frameArenas[frameIndex]);
+		lvnctx->frameArenaIndex.store(frameIndex, std::memory_order_release);
+		lvnctx->frameArenaEpoch++;
+	}
+	window->frameArenaEpoch = lvnctx->frameArenaEpoch;
+
+	// start of the frame is a safe point to create the graphics objects of models loaded in the background
+	lvn::assetLoadProcessPending();
+
+	// move the counters of the last frame into the history, there is no last frame the first time a frame begins
+	LvnFrameStatsData& frameStats = window->frameStats;
+	if (frameStats.frameBegun)
+	{
+		frameStats.history[frameStats.historyIndex] = frameStats.current;
+		frameStats.historyIndex = (frameStats.historyIndex + 1) % LVN_FRAME_STATS_HISTORY_SIZE;
+		frameStats.historyCount = std::min(frameStats.historyCount + 1, static_cast<uint32_t>(LVN_FRAME_STATS_HISTORY_SIZE));
+	}
+	frameStats.frameBegun = true;
+
+	uint64_t frameNumber = frameStats.current.frameNumber + 1;
+	frameStats.current = {};
+	frameStats.current.frameNumber = frameNumber;
+	lvnctx->frameStatsWindow = window;
+
 	int width, height;
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
-	lvn::getContext()->graphicsContext.renderBeginNextFrame(window);
+	lvnctx->graphicsContext.renderBeginNextFrame(window);
 }
 
 void renderDrawSubmit(LvnWindow* window)
 {
+	LVN_PROFILE_FUNCTION();
 	int width, height;
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
@@ -1929,7 +4348,9 @@ void renderBeginCommandRecording(LvnWindow* window)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
-	lvn::getContext()->graphicsContext.renderBeginCommandRecording(window);
+	LvnContext* lvnctx = lvn::getContext();
+	lvnctx->graphicsContext.renderBeginCommandRecording(window);
+	if (window->gpuTiming) { lvn::gpuTimingBeginFrame(lvnctx, window); }
 }
 
 void renderEndCommandRecording(LvnWindow* window)
@@ -1938,7 +4359,9 @@ void renderEndCommandRecording(LvnWindow* window)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
-	lvn::getContext()->graphicsContext.renderEndCommandRecording(window);
+	LvnContext* lvnctx = lvn::getContext();
+	if (window->gpuTiming) { lvn::gpuTimingEndFrame(lvnctx, window); }
+	lvnctx->graphicsContext.renderEndCommandRecording(window);
 }
 
 void renderCmdBeginRenderPass(LvnWindow* window)
@@ -1947,7 +4370,10 @@ void renderCmdBeginRenderPass(LvnWindow* window)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
-	lvn::getContext()->graphicsContext.renderCmdBeginRenderPass(window);
+	LvnContext* lvnctx = lvn::getContext();
+	window->frameStats.current.renderPasses++;
+	if (window->gpuTiming && window->gpuTiming->timePasses) { lvn::gpuTimingBeginRegion(lvnctx, window, "renderPass", nullptr); }
+	lvnctx->graphicsContext.renderCmdBeginRenderPass(window);
 }
 
 void renderCmdEndRenderPass(LvnWindow* window)
@@ -1956,65 +4382,333 @@ void renderCmdEndRenderPass(LvnWindow* window)
 	lvn::windowGetSize(window, &width, &height);
 	if (width * height <= 0) { return; }
 
-	lvn::getContext()->graphicsContext.renderCmdEndRenderPass(window);
+	LvnContext* lvnctx = lvn::getContext();
+	lvnctx->graphicsContext.renderCmdEndRenderPass(window);
+	if (window->gpuTiming && window->gpuTiming->timePasses) { lvn::gpuTimingEndRegion(lvnctx, window); }
+}
+
+void renderCmdBindPipeline(LvnWindow* window, LvnPipeline* pipeline)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	window->frameStats.current.pipelineBinds++;
+	lvn::getContext()->graphicsContext.renderCmdBindPipeline(window, pipeline);
+}
+
+void renderCmdBindVertexBuffer(LvnWindow* window, LvnBuffer* buffer)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	window->frameStats.current.vertexBufferBinds++;
+	lvn::getContext()->graphicsContext.renderCmdBindVertexBuffer(window, buffer);
+}
+
+void renderCmdBindIndexBuffer(LvnWindow* window, LvnBuffer* buffer)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	window->frameStats.current.indexBufferBinds++;
+	lvn::getContext()->graphicsContext.renderCmdBindIndexBuffer(window, buffer);
+}
+
+void renderCmdBindDescriptorSets(LvnWindow* window, LvnPipeline* pipeline, uint32_t firstSetIndex, uint32_t descriptorSetCount, LvnDescriptorSet** pDescriptorSets)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	window->frameStats.current.descriptorSetBinds += descriptorSetCount;
+	lvn::getContext()->graphicsContext.renderCmdBindDescriptorSets(window, pipeline, firstSetIndex, descriptorSetCount, pDescriptorSets);
+}
+
+void renderCmdBeginFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	LvnContext* lvnctx = lvn::getContext();
+	window->frameStats.current.frameBufferPasses++;
+	if (window->gpuTiming && window->gpuTiming->timePasses) { lvn::gpuTimingBeginRegion(lvnctx, window, "frameBuffer", frameBuffer); }
+	lvnctx->graphicsContext.renderCmdBeginFrameBuffer(window, frameBuffer);
+}
+
+void renderCmdEndFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
+{
+	int width, height;
+	lvn::windowGetSize(window, &width, &height);
+	if (width * height <= 0) { return; }
+
+	LvnContext* lvnctx = lvn::getContext();
+	lvnctx->graphicsContext.renderCmdEndFrameBuffer(window, frameBuffer);
+	if (window->gpuTiming && window->gpuTiming->timePasses) { lvn::gpuTimingEndRegion(lvnctx, window); }
+}
+
+LvnResult renderEnableGpuTiming(LvnWindow* window, bool timePasses, bool pipelineStatistics)
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	if (window->gpuTiming)
+	{
+		LVN_CORE_WARN("renderEnableGpuTiming(LvnWindow*, bool, bool) | gpu timing is already enabled for window (%p)", window);
+		return Lvn_Result_AlreadyCalled;
+	}
+
+	LvnGpuTimingData* gpuTiming = new (lvn::memAlloc(sizeof(LvnGpuTimingData), Lvn_MemoryTag_Graphics)) LvnGpuTimingData();
+	gpuTiming->timePasses = timePasses;
+	gpuTiming->pipelineStatistics = pipelineStatistics;
+
+	if (lvnctx->graphicsContext.gpuTimingCreate(window, gpuTiming) != Lvn_Result_Success)
+	{
+		LVN_CORE_ERROR("renderEnableGpuTiming(LvnWindow*, bool, bool) | failed to create gpu timing queries for window (%p)", window);
+		gpuTiming->~LvnGpuTimingData();
+		lvn::memFree(gpuTiming);
+		return Lvn_Result_Failure;
+	}
+
+	window->gpuTiming = gpuTiming;
+	return Lvn_Result_Success;
+}
+
+void renderDisableGpuTiming(LvnWindow* window)
+{
+	if (!window->gpuTiming) { return; }
+
+	lvn::getContext()->graphicsContext.gpuTimingDestroy(window, window->gpuTiming);
+	window->gpuTiming->~LvnGpuTimingData();
+	lvn::memFree(window->gpuTiming);
+	window->gpuTiming = nullptr;
+}
+
+void renderCmdBeginGpuRegion(LvnWindow* window, const char* name)
+{
+	if (!window->gpuTiming) { return; }
+	lvn::gpuTimingBeginRegion(lvn::getContext(), window, name, nullptr);
+}
+
+void renderCmdEndGpuRegion(LvnWindow* window)
+{
+	if (!window->gpuTiming) { return; }
+	lvn::gpuTimingEndRegion(lvn::getContext(), window);
+}
+
+uint32_t renderGetGpuTimings(LvnWindow* window, LvnGpuTiming* pTimings, uint32_t maxCount)
+{
+	if (!window->gpuTiming) { return 0; }
+
+	const std::vector<LvnGpuTiming>& results = window->gpuTiming->results;
+	if (!pTimings) { return static_cast<uint32_t>(results.size()); }
+
+	uint32_t count = std::min(static_cast<uint32_t>(results.size()), maxCount);
+	for (uint32_t i = 0; i < count; i++)
+		pTimings[i] = results[i];
+
+	return count;
+}
+
+LvnFrameStats renderGetFrameStats(LvnWindow* window)
+{
+	const LvnFrameStatsData& frameStats = window->frameStats;
+	if (frameStats.historyCount == 0) { return LvnFrameStats{}; }
+
+	return frameStats.history[(frameStats.historyIndex + LVN_FRAME_STATS_HISTORY_SIZE - 1) % LVN_FRAME_STATS_HISTORY_SIZE];
+}
+
+uint32_t renderGetFrameStatsHistory(LvnWindow* window, LvnFrameStats* pStats, uint32_t maxCount)
+{
+	const LvnFrameStatsData& frameStats = window->frameStats;
+	if (!pStats) { return frameStats.historyCount; }
+
+	// copy the newest frames if there is not enough space for all of them
+	uint32_t count = std::min(frameStats.historyCount, maxCount);
+	uint32_t first = (frameStats.historyIndex + LVN_FRAME_STATS_HISTORY_SIZE - count) % LVN_FRAME_STATS_HISTORY_SIZE;
+	for (uint32_t i = 0; i < count; i++)
+		pStats[i] = frameStats.history[(first + i) % LVN_FRAME_STATS_HISTORY_SIZE];
+
+	return count;
+}
+
+static void framePacerRecordFrame(LvnFramePacer* framePacer, uint64_t now)
+{
+	if (framePacer->lastFrameNs != 0)
+	{
+		framePacer->frameTimes[framePacer->frameTimeIndex] = now - framePacer->lastFrameNs;
+		framePacer->frameTimeIndex = (framePacer->frameTimeIndex + 1) % framePacer->frameTimes.size();
+		framePacer->frameTimeCount = std::min(framePacer->frameTimeCount + 1, static_cast<uint32_t>(framePacer->frameTimes.size()));
+	}
+
+	framePacer->lastFrameNs = now;
+	framePacer->frameCount++;
+}
+
+static void framePacerSleep(LvnFramePacer* framePacer, uint64_t ns)
+{
+#ifdef LVN_PLATFORM_WINDOWS
+	// waitable timer due times are relative when negative and in 100 ns units
+	if (framePacer->waitTimer != nullptr)
+	{
+		LARGE_INTEGER dueTime;
+		dueTime.QuadPart = -static_cast<LONGLONG>(ns / 100);
+		if (SetWaitableTimer(framePacer->waitTimer, &dueTime, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(framePacer->waitTimer, INFINITE);
+			return;
+		}
+	}
+#else
+	(void)framePacer;
+#endif
+	std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+}
+
+LvnResult createFramePacer(LvnFramePacer** framePacer, LvnFramePacerCreateInfo* createInfo)
+{
+	if (createInfo->targetHz < 0.0)
+	{
+		LVN_CORE_ERROR("createFramePacer(LvnFramePacer**, LvnFramePacerCreateInfo*) | createInfo->targetHz cannot be negative (%f)", createInfo->targetHz);
+		return Lvn_Result_Failure;
+	}
+
+	LvnFramePacer* pacer = new (lvn::memAlloc(sizeof(LvnFramePacer), Lvn_MemoryTag_Core)) LvnFramePacer();
+
+#ifdef LVN_PLATFORM_WINDOWS
+	// sleeps on windows wake up on the system timer tick (15.6 ms by default), a high resolution waitable timer does not depend on it,
+	// older versions of windows without one raise the timer resolution to 1 ms for as long as the pacer exists instead
+	pacer->waitTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (pacer->waitTimer == nullptr)
+		pacer->timerPeriodRaised = timeBeginPeriod(1) == TIMERR_NOERROR;
+
+	pacer->spinNs = createInfo->spinNs ? createInfo->spinNs : 2000000;
+#else
+	pacer->spinNs = createInfo->spinNs ? createInfo->spinNs : 1000000;
+#endif
+	pacer->frameTimes.resize(createInfo->historySize ? createInfo->historySize : 240);
+	lvn::framePacerSetTargetHz(pacer, createInfo->targetHz);
+
+	*framePacer = pacer;
+
+	LVN_CORE_TRACE("created frame pacer: (%p), target: %.2f hz", *framePacer, createInfo->targetHz);
+	return Lvn_Result_Success;
+}
+
+void destroyFramePacer(LvnFramePacer* framePacer)
+{
+	if (framePacer == nullptr) { return; }
+
+#ifdef LVN_PLATFORM_WINDOWS
+	if (framePacer->waitTimer != nullptr)
+		CloseHandle(framePacer->waitTimer);
+	if (framePacer->timerPeriodRaised)
+		timeEndPeriod(1);
+#endif
+
+	framePacer->~LvnFramePacer();
+	lvn::memFree(framePacer);
 }
 
-void renderCmdBindPipeline(LvnWindow* window, LvnPipeline* pipeline)
+void framePacerBeginFrame(LvnFramePacer* framePacer, LvnWindow* window)
 {
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
-
-	lvn::getContext()->graphicsContext.renderCmdBindPipeline(window, pipeline);
+	lvn::framePacerWait(framePacer);
+	lvn::renderBeginNextFrame(window);
 }
 
-void renderCmdBindVertexBuffer(LvnWindow* window, LvnBuffer* buffer)
+void framePacerEndFrame(LvnFramePacer* framePacer, LvnWindow* window)
 {
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
+	lvn::renderDrawSubmit(window);
 
-	lvn::getContext()->graphicsContext.renderCmdBindVertexBuffer(window, buffer);
+	if (framePacer->lastFrameNs != 0)
+		framePacer->lastWorkNs = lvn::clockNowNs() - framePacer->lastFrameNs;
 }
 
-void renderCmdBindIndexBuffer(LvnWindow* window, LvnBuffer* buffer)
+void framePacerWait(LvnFramePacer* framePacer)
 {
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
+	LVN_PROFILE_FUNCTION();
+	uint64_t now = lvn::clockNowNs();
 
-	lvn::getContext()->graphicsContext.renderCmdBindIndexBuffer(window, buffer);
-}
+	if (framePacer->intervalNs == 0)
+	{
+		lvn::framePacerRecordFrame(framePacer, now);
+		return;
+	}
 
-void renderCmdBindDescriptorSets(LvnWindow* window, LvnPipeline* pipeline, uint32_t firstSetIndex, uint32_t descriptorSetCount, LvnDescriptorSet** pDescriptorSets)
-{
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
+	// the first frame, or a frame that is more than one interval late, starts the schedule again from now instead of rushing to catch up
+	if (framePacer->nextFrameNs == 0 || now > framePacer->nextFrameNs + framePacer->intervalNs)
+	{
+		if (framePacer->nextFrameNs != 0) { framePacer->missedFrames++; }
+		framePacer->nextFrameNs = now;
+	}
 
-	lvn::getContext()->graphicsContext.renderCmdBindDescriptorSets(window, pipeline, firstSetIndex, descriptorSetCount, pDescriptorSets);
+	// sleep while there is more than the spin time left, sleeps can overshoot by up to the timer resolution of the system
+	uint64_t deadline = framePacer->nextFrameNs;
+	while (now + framePacer->spinNs < deadline)
+	{
+		lvn::framePacerSleep(framePacer, deadline - now - framePacer->spinNs);
+		now = lvn::clockNowNs();
+	}
+
+	while (now < deadline)
+	{
+		std::this_thread::yield();
+		now = lvn::clockNowNs();
+	}
+
+	// schedule from the deadline rather than the wake up time so that errors do not add up over frames
+	framePacer->nextFrameNs = deadline + framePacer->intervalNs;
+	lvn::framePacerRecordFrame(framePacer, now);
 }
 
-void renderCmdBeginFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
+void framePacerSetTargetHz(LvnFramePacer* framePacer, double targetHz)
 {
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
-
-	lvn::getContext()->graphicsContext.renderCmdBeginFrameBuffer(window, frameBuffer);
+	framePacer->intervalNs = targetHz > 0.0 ? static_cast<uint64_t>(1e9 / targetHz) : 0;
+	framePacer->nextFrameNs = 0;
 }
 
-void renderCmdEndFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
+LvnFramePacerStats framePacerGetStats(LvnFramePacer* framePacer)
 {
-	int width, height;
-	lvn::windowGetSize(window, &width, &height);
-	if (width * height <= 0) { return; }
+	LvnFramePacerStats stats{};
+	stats.frameCount = framePacer->frameCount;
+	stats.missedFrames = framePacer->missedFrames;
+	stats.sampleCount = framePacer->frameTimeCount;
+	stats.targetMs = lvn::clockNsToMs(framePacer->intervalNs);
+	stats.lastWorkMs = lvn::clockNsToMs(framePacer->lastWorkNs);
+
+	if (framePacer->frameTimeCount == 0) { return stats; }
+
+	uint64_t total = 0;
+	std::vector<uint64_t> jitter(framePacer->frameTimeCount);
+	for (uint32_t i = 0; i < framePacer->frameTimeCount; i++)
+	{
+		uint64_t frameTime = framePacer->frameTimes[i];
+		total += frameTime;
+		jitter[i] = frameTime;
+	}
 
-	lvn::getContext()->graphicsContext.renderCmdEndFrameBuffer(window, frameBuffer);
+	// without a target the jitter is measured from the average frame time instead
+	uint64_t target = framePacer->intervalNs ? framePacer->intervalNs : total / framePacer->frameTimeCount;
+	for (uint64_t& value : jitter)
+		value = value > target ? value - target : target - value;
+
+	std::sort(jitter.begin(), jitter.end());
+	auto percentile = [&](double p) { return lvn::clockNsToMs(jitter[static_cast<size_t>(p * (jitter.size() - 1) + 0.5)]); };
+
+	stats.averageFrameMs = lvn::clockNsToMs(total / framePacer->frameTimeCount);
+	stats.jitterP50Ms = percentile(0.50);
+	stats.jitterP95Ms = percentile(0.95);
+	stats.jitterP99Ms = percentile(0.99);
+	stats.jitterMaxMs = lvn::clockNsToMs(jitter.back());
+
+	return stats;
 }
 
 LvnResult createShaderFromSrc(LvnShader** shader, LvnShaderCreateInfo* createInfo)
 {
+	LVN_PROFILE_FUNCTION();
 	LvnContext* lvnctx = lvn::getContext();
 
 	if (createInfo->vertexSrc.empty())
@@ -2037,6 +4731,7 @@ LvnResult createShaderFromSrc(LvnShader** shader, LvnShaderCreateInfo* createInf
 
 LvnResult createShaderFromFileSrc(LvnShader** shader, LvnShaderCreateInfo* createInfo)
 {
+	LVN_PROFILE_FUNCTION();
 	LvnContext* lvnctx = lvn::getContext();
 
 	if (createInfo->vertexSrc.empty())
@@ -2059,6 +4754,7 @@ LvnResult createShaderFromFileSrc(LvnShader** shader, LvnShaderCreateInfo* creat
 
 LvnResult createShaderFromFileBin(LvnShader** shader, LvnShaderCreateInfo* createInfo)
 {
+	LVN_PROFILE_FUNCTION();
 	LvnContext* lvnctx = lvn::getContext();
 
 	if (createInfo->vertexSrc.empty())
@@ -2416,12 +5112,16 @@ LvnPipelineSpecification pipelineSpecificationGetConfig()
 
 void bufferUpdateVertexData(LvnBuffer* buffer, void* vertices, uint32_t size, uint32_t offset)
 {
-	lvn::getContext()->graphicsContext.bufferUpdateVertexData(buffer, vertices, size, offset);
+	LvnContext* lvnctx = lvn::getContext();
+	if (lvnctx->frameStatsWindow) { lvnctx->frameStatsWindow->frameStats.current.bufferUploadBytes += size; }
+	lvnctx->graphicsContext.bufferUpdateVertexData(buffer, vertices, size, offset);
 }
 
 void bufferUpdateIndexData(LvnBuffer* buffer, uint32_t* indices, uint32_t size, uint32_t offset)
 {
-	lvn::getContext()->graphicsContext.bufferUpdateIndexData(buffer, indices, size, offset);
+	LvnContext* lvnctx = lvn::getContext();
+	if (lvnctx->frameStatsWindow) { lvnctx->frameStatsWindow->frameStats.current.bufferUploadBytes += size; }
+	lvnctx->graphicsContext.bufferUpdateIndexData(buffer, indices, size, offset);
 }
 
 void bufferResizeVertexBuffer(LvnBuffer* buffer, uint32_t size)
@@ -2441,6 +5141,7 @@ LvnTexture* cubemapGetTextureData(LvnCubemap* cubemap)
 
 void updateUniformBufferData(LvnWindow* window, LvnUniformBuffer* uniformBuffer, void* data, uint64_t size)
 {
+	window->frameStats.current.uniformUploadBytes += size;
 	lvn::getContext()->graphicsContext.updateUniformBufferData(window, uniformBuffer, data, size);
 }
 
@@ -2527,6 +5228,13 @@ LvnBufferCreateInfo meshGetVertexBufferCreateInfoConfig(LvnVertex* pVertices, ui
 	return bufferCreateInfo;
 }
 
+static void setImageDataPixels(LvnImageData* imageData, uint8_t* pixels)
+{
+	// stb image allocates through memAllocTagged, take ownership instead of copying, LvnData frees it with memFree which counts it as a memAlloc allocation
+	if (lvn::memIsCounted(pixels)) { s_LvnContext->numMemoryAllocations++; }
+	imageData->pixels = LvnData<uint8_t>(pixels, imageData->size, LvnDataAdoptTag{});
+}
+
 LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVertically)
 {
 	if (filepath == nullptr)
@@ -2546,7 +5254,7 @@ LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVer
 		return {};
 	}
 
-	stbi_set_flip_vertically_on_load(flipVertically);
+	stbi_set_flip_vertically_on_load_thread(flipVertically); // per thread so images can be loaded on several threads at once
 	int imageWidth, imageHeight, imageChannels;
 	stbi_uc* pixels = stbi_load(filepath, &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
@@ -2561,12 +5269,10 @@ LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVer
 	imageData.height = imageHeight;
 	imageData.channels = forceChannels ? forceChannels : imageChannels;
 	imageData.size = imageData.width * imageData.height * imageData.channels;
-	imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+	lvn::setImageDataPixels(&imageData, pixels);
 
 	LVN_CORE_TRACE("loaded image data <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes, filepath: %s", pixels, imageData.width, imageData.height, imageData.channels, imageData.size, filepath);
 
-	stbi_image_free(pixels);
-
 	return imageData;
 }
 
@@ -2589,7 +5295,7 @@ LvnImageData loadImageDataMemory(const uint8_t* data, int length, int forceChann
 		return {};
 	}
 
-	stbi_set_flip_vertically_on_load(flipVertically);
+	stbi_set_flip_vertically_on_load_thread(flipVertically); // per thread so images can be loaded on several threads at once
 	int imageWidth, imageHeight, imageChannels;
 	stbi_uc* pixels = stbi_load_from_memory(data, length, &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
@@ -2604,17 +5310,16 @@ LvnImageData loadImageDataMemory(const uint8_t* data, int length, int forceChann
 	imageData.height = imageHeight;
 	imageData.channels = forceChannels ? forceChannels : imageChannels;
 	imageData.size = imageData.width * imageData.height * imageData.channels;
-	imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+	lvn::setImageDataPixels(&imageData, pixels);
 
 	LVN_CORE_TRACE("loaded image data from memory <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes", pixels, imageData.width, imageData.height, imageData.channels, imageData.size);
 
-	stbi_image_free(pixels);
-
 	return imageData;
 }
 
 LvnModel loadModel(const char* filepath)
 {
+	LVN_PROFILE_FUNCTION();
 	std::string filepathstr(filepath);
 	std::string extensionType = filepathstr.substr(filepathstr.find_last_of(".") + 1);
 
@@ -2644,6 +5349,408 @@ void freeModel(LvnModel* model)
 	}
 }
 
+static void setThreadPoolConfig(LvnThreadPoolConfig* config, const LvnThreadPoolCreateInfo* createInfo, const char* defaultName, const uint32_t* pReservedCores, uint32_t reservedCoreCount)
+{
+	// the create info points to arrays owned by the caller, keep copies for when the pool is created
+	config->createInfo = *createInfo;
+	config->name = createInfo->name ? createInfo->name : defaultName;
+
+	if (createInfo->pCores && createInfo->coreCount > 0)
+		config->cores.assign(createInfo->pCores, createInfo->pCores + createInfo->coreCount);
+	if (createInfo->pReservedCores && createInfo->reservedCoreCount > 0)
+		config->reservedCores.assign(createInfo->pReservedCores, createInfo->pReservedCores + createInfo->reservedCoreCount);
+	if (pReservedCores && reservedCoreCount > 0)
+		config->reservedCores.insert(config->reservedCores.end(), pReservedCores, pReservedCores + reservedCoreCount);
+}
+
+static LvnThreadPool* createThreadPool(const LvnThreadPoolConfig& config)
+{
+	LvnThreadPoolCreateInfo createInfo = config.createInfo;
+	createInfo.pCores = config.cores.data();
+	createInfo.coreCount = static_cast<uint32_t>(config.cores.size());
+	createInfo.pReservedCores = config.reservedCores.data();
+	createInfo.reservedCoreCount = static_cast<uint32_t>(config.reservedCores.size());
+	createInfo.name = config.name.c_str();
+
+	return new (lvn::memAlloc(sizeof(LvnThreadPool), Lvn_MemoryTag_Core)) LvnThreadPool(createInfo);
+}
+
+static void destroyThreadPool(LvnThreadPool* threadPool)
+{
+	if (threadPool == nullptr) { return; }
+
+	threadPool->~LvnThreadPool();
+	lvn::memFree(threadPool);
+}
+
+static LvnThreadPool* getAssetThreadPool(LvnContext* lvnctx)
+{
+	std::lock_guard<std::mutex> lock(lvnctx->assetLoadMutex);
+	if (!lvnctx->assetThreadPool)
+		lvnctx->assetThreadPool = lvn::createThreadPool(lvnctx->assetPoolConfig);
+
+	return lvnctx->assetThreadPool;
+}
+
+static void gpuTimingBeginFrame(LvnContext* lvnctx, LvnWindow* window)
+{
+	LvnGpuTimingData* gpuTiming = window->gpuTiming;
+	LvnGpuTimingFrame& frame = gpuTiming->frames[gpuTiming->frameIndex];
+
+	// the gpu has finished the last commands recorded with this frame, read its results before the queries are reset
+	if (frame.recorded)
+	{
+		std::vector<uint64_t> timestamps(frame.timestampCount);
+		std::vector<LvnGpuPipelineStatistics> statistics(frame.statisticsCount);
+
+		if (lvnctx->graphicsContext.gpuTimingGetResults(window, gpuTiming, gpuTiming->frameIndex, timestamps.data(), statistics.data()))
+		{
+			gpuTiming->results.resize(frame.regions.size());
+			for (uint32_t i = 0; i < frame.regions.size(); i++)
+			{
+				const LvnGpuRegion& region = frame.regions[i];
+				LvnGpuTiming& timing = gpuTiming->results[i];
+
+				timing.name = region.name;
+				timing.frameBuffer = region.frameBuffer;
+				timing.depth = region.depth;
+				timing.gpuTimeMs = timestamps[region.endQuery] >= timestamps[region.startQuery]
+					? static_cast<double>(timestamps[region.endQuery] - timestamps[region.startQuery]) / 1000000.0
+					: 0.0;
+				timing.hasStatistics = region.statisticsQuery >= 0;
+				timing.statistics = timing.hasStatistics ? statistics[region.statisticsQuery] : LvnGpuPipelineStatistics{};
+			}
+		}
+	}
+
+	frame.regions.clear();
+	frame.timestampCount = 0;
+	frame.statisticsCount = 0;
+	frame.recorded = false;
+
+	gpuTiming->openRegions.clear();
+	gpuTiming->recording = true;
+	lvnctx->graphicsContext.gpuTimingCmdResetFrame(window, gpuTiming, gpuTiming->frameIndex);
+}
+
+static void gpuTimingEndFrame(LvnContext* lvnctx, LvnWindow* window)
+{
+	LvnGpuTimingData* gpuTiming = window->gpuTiming;
+	if (!gpuTiming->recording) { return; }
+
+	if (!gpuTiming->openRegions.empty())
+	{
+		LVN_CORE_WARN("renderEndCommandRecording(LvnWindow*) | %zu gpu regions were not ended before command recording ended, ending them now", gpuTiming->openRegions.size());
+		while (!gpuTiming->openRegions.empty())
+			lvn::gpuTimingEndRegion(lvnctx, window);
+	}
+
+	gpuTiming->frames[gpuTiming->frameIndex].recorded = true;
+	gpuTiming->frameIndex = (gpuTiming->frameIndex + 1) % gpuTiming->frames.size();
+	gpuTiming->recording = false;
+}
+
+static void gpuTimingBeginRegion(LvnContext* lvnctx, LvnWindow* window, const char* name, LvnFrameBuffer* frameBuffer)
+{
+	LvnGpuTimingData* gpuTiming = window->gpuTiming;
+	LvnGpuTimingFrame& frame = gpuTiming->frames[gpuTiming->frameIndex];
+
+	// the region is still pushed when it is skipped so that its end is matched
+	if (!gpuTiming->recording || frame.regions.size() >= LVN_GPU_TIMING_MAX_REGIONS)
+	{
+		gpuTiming->openRegions.push_back(UINT32_MAX);
+		return;
+	}
+
+	LvnGpuRegion region{};
+	region.name = name;
+	region.frameBuffer = frameBuffer;
+	region.depth = static_cast<uint32_t>(gpuTiming->openRegions.size());
+	region.startQuery = frame.timestampCount++;
+	region.statisticsQuery = -1;
+
+	lvnctx->graphicsContext.gpuTimingCmdWriteTimestamp(window, gpuTiming, gpuTiming->frameIndex, region.startQuery);
+
+	// only one statistics query can be active at a time, nested regions are not counted
+	if (gpuTiming->pipelineStatistics && gpuTiming->openRegions.empty())
+	{
+		region.statisticsQuery = static_cast<int32_t>(frame.statisticsCount++);
+		lvnctx->graphicsContext.gpuTimingCmdBeginStatistics(window, gpuTiming, gpuTiming->frameIndex, region.statisticsQuery);
+	}
+
+	gpuTiming->openRegions.push_back(static_cast<uint32_t>(frame.regions.size()));
+	frame.regions.push_back(region);
+}
+
+static void gpuTimingEndRegion(LvnContext* lvnctx, LvnWindow* window)
+{
+	LvnGpuTimingData* gpuTiming = window->gpuTiming;
+	if (gpuTiming->openRegions.empty())
+	{
+		LVN_CORE_WARN("renderCmdEndGpuRegion(LvnWindow*) | no gpu region was begun for window (%p)", window);
+		return;
+	}
+
+	uint32_t regionIndex = gpuTiming->openRegions.back();
+	gpuTiming->openRegions.pop_back();
+	if (regionIndex == UINT32_MAX) { return; }
+
+	LvnGpuTimingFrame& frame = gpuTiming->frames[gpuTiming->frameIndex];
+	LvnGpuRegion& region = frame.regions[regionIndex];
+
+	if (region.statisticsQuery >= 0)
+		lvnctx->graphicsContext.gpuTimingCmdEndStatistics(window, gpuTiming, gpuTiming->frameIndex, region.statisticsQuery);
+
+	region.endQuery = frame.timestampCount++;
+	lvnctx->graphicsContext.gpuTimingCmdWriteTimestamp(window, gpuTiming, gpuTiming->frameIndex, region.endQuery);
+}
+
+static LvnAssetLoad* createAssetLoad(LvnAssetLoadType type, const char* filepath)
+{
+	LvnAssetLoad* assetLoad = new (lvn::memAlloc(sizeof(LvnAssetLoad), Lvn_MemoryTag_Assets)) LvnAssetLoad();
+	assetLoad->type = type;
+	assetLoad->state.store(Lvn_AssetLoadState_Loading);
+	assetLoad->filepath = filepath;
+	return assetLoad;
+}
+
+// render thread only, the load is taken off the queue so each model is created once
+static void assetLoadCreateModel(LvnContext* lvnctx, LvnAssetLoad* assetLoad)
+{
+	{
+		std::lock_guard<std::mutex> lock(lvnctx->assetLoadMutex);
+		auto it = std::find(lvnctx->assetModelQueue.begin(), lvnctx->assetModelQueue.end(), assetLoad);
+		if (it == lvnctx->assetModelQueue.end()) { return; }
+		lvnctx->assetModelQueue.erase(it);
+	}
+
+	assetLoad->model = lvn::createModelFromData(assetLoad->modelData);
+	assetLoad->modelData = nullptr;
+	assetLoad->state.store(Lvn_AssetLoadState_Ready, std::memory_order_release);
+}
+
+LvnResult loadModelAsync(LvnAssetLoad** assetLoad, const char* filepath)
+{
+	if (!filepath)
+	{
+		LVN_CORE_ERROR("loadModelAsync(LvnAssetLoad**, const char*) | invalid filepath, filepath must not be nullptr");
+		return Lvn_Result_Failure;
+	}
+
+	std::string filepathstr(filepath);
+	std::string extensionType = filepathstr.substr(filepathstr.find_last_of(".") + 1);
+
+	if (extensionType != "gltf" && extensionType != "glb")
+	{
+		LVN_CORE_WARN("loadModelAsync(LvnAssetLoad**, const char*) | could not load model, file extension type not recognized (%s), Filepath: %s", extensionType.c_str(), filepath);
+		return Lvn_Result_Failure;
+	}
+
+	LvnContext* lvnctx = lvn::getContext();
+	LvnAssetLoad* load = lvn::createAssetLoad(Lvn_AssetLoadType_Model, filepath);
+	*assetLoad = load;
+
+	bool glb = extensionType == "glb";
+	lvn::getAssetThreadPool(lvnctx)->add_task([lvnctx, load, glb]()
+	{
+		// the json parser reports malformed files with exceptions
+		try
+		{
+			load->modelData = glb ? lvn::loadGlbModelData(load->filepath.c_str()) : lvn::loadGltfModelData(load->filepath.c_str());
+		}
+		catch (...)
+		{
+			load->modelData = nullptr;
+		}
+
+		if (!load->modelData)
+		{
+			LVN_CORE_ERROR("loadModelAsync(LvnAssetLoad**, const char*) | failed to load model, filepath: %s", load->filepath.c_str());
+			load->state.store(Lvn_AssetLoadState_Failed, std::memory_order_release);
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(lvnctx->assetLoadMutex);
+		lvnctx->assetModelQueue.push_back(load);
+	}, &load->counter);
+
+	return Lvn_Result_Success;
+}
+
+LvnResult loadImageDataAsync(LvnAssetLoad** assetLoad, const char* filepath, int forceChannels, bool flipVertically)
+{
+	if (!filepath)
+	{
+		LVN_CORE_ERROR("loadImageDataAsync(LvnAssetLoad**, const char*) | invalid filepath, filepath must not be nullptr");
+		return Lvn_Result_Failure;
+	}
+
+	LvnAssetLoad* load = lvn::createAssetLoad(Lvn_AssetLoadType_ImageData, filepath);
+	load->forceChannels = forceChannels;
+	load->flipVertically = flipVertically;
+	*assetLoad = load;
+
+	lvn::getAssetThreadPool(lvn::getContext())->add_task([load]()
+	{
+		load->imageData = lvn::loadImageData(load->filepath.c_str(), load->forceChannels, load->flipVertically);
+		load->state.store(load->imageData.pixels.empty() ? Lvn_AssetLoadState_Failed : Lvn_AssetLoadState_Ready, std::memory_order_release);
+	}, &load->counter);
+
+	return Lvn_Result_Success;
+}
+
+LvnResult loadFontFromFileTTFAsync(LvnAssetLoad** assetLoad, const char* filepath, uint32_t fontSize, LvnCharset charset)
+{
+	if (!filepath)
+	{
+		LVN_CORE_ERROR("loadFontFromFileTTFAsync(LvnAssetLoad**, const char*, uint32_t, LvnCharset) | invalid filepath, filepath must not be nullptr");
+		return Lvn_Result_Failure;
+	}
+
+	LvnAssetLoad* load = lvn::createAssetLoad(Lvn_AssetLoadType_Font, filepath);
+	load->fontSize = fontSize;
+	load->charset = charset;
+	*assetLoad = load;
+
+	lvn::getAssetThreadPool(lvn::getContext())->add_task([load]()
+	{
+		load->font = lvn::loadFontFromFileTTF(load->filepath.c_str(), load->fontSize, load->charset);
+		load->state.store(load->font.atlas.pixels.empty() ? Lvn_AssetLoadState_Failed : Lvn_AssetLoadState_Ready, std::memory_order_release);
+	}, &load->counter);
+
+	return Lvn_Result_Success;
+}
+
+LvnResult createSoundFromFileAsync(LvnAssetLoad** assetLoad, LvnSoundCreateInfo* createInfo)
+{
+	if (createInfo->filepath.empty())
+	{
+		LVN_CORE_ERROR("createSoundFromFileAsync(LvnAssetLoad**, LvnSoundCreateInfo*) | createInfo->filepath is empty, cannot load sound data without a valid path to the sound file");
+		return Lvn_Result_Failure;
+	}
+
+	LvnAssetLoad* load = lvn::createAssetLoad(Lvn_AssetLoadType_Sound, createInfo->filepath.c_str());
+	load->soundCreateInfo = *createInfo;
+	*assetLoad = load;
+
+	// miniaudio sounds can be initialized from any thread
+	lvn::getAssetThreadPool(lvn::getContext())->add_task([load]()
+	{
+		LvnResult result = lvn::createSoundFromFile(&load->sound, &load->soundCreateInfo);
+		load->state.store(result == Lvn_Result_Success ? Lvn_AssetLoadState_Ready : Lvn_AssetLoadState_Failed, std::memory_order_release);
+	}, &load->counter);
+
+	return Lvn_Result_Success;
+}
+
+void destroyAssetLoad(LvnAssetLoad* assetLoad)
+{
+	if (assetLoad == nullptr) { return; }
+	LvnContext* lvnctx = lvn::getContext();
+
+	if (lvnctx->assetThreadPool)
+		lvnctx->assetThreadPool->wait(assetLoad->counter);
+
+	{
+		std::lock_guard<std::mutex> lock(lvnctx->assetLoadMutex);
+		auto it = std::find(lvnctx->assetModelQueue.begin(), lvnctx->assetModelQueue.end(), assetLoad);
+		if (it != lvnctx->assetModelQueue.end()) { lvnctx->assetModelQueue.erase(it); }
+	}
+
+	if (assetLoad->modelData)
+		lvn::freeModelData(assetLoad->modelData);
+
+	if (assetLoad->state.load() == Lvn_AssetLoadState_Ready && !assetLoad->resultTaken)
+	{
+		if (assetLoad->type == Lvn_AssetLoadType_Model) { lvn::freeModel(&assetLoad->model); }
+		else if (assetLoad->type == Lvn_AssetLoadType_Sound) { lvn::destroySound(assetLoad->sound); }
+	}
+
+	assetLoad->~LvnAssetLoad();
+	lvn::memFree(assetLoad);
+}
+
+LvnAssetLoadState assetLoadGetState(LvnAssetLoad* assetLoad)
+{
+	return assetLoad->state.load(std::memory_order_acquire);
+}
+
+LvnAssetLoadState assetLoadWait(LvnAssetLoad* assetLoad)
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	if (lvnctx->assetThreadPool)
+		lvnctx->assetThreadPool->wait(assetLoad->counter);
+
+	if (assetLoad->type == Lvn_AssetLoadType_Model && assetLoad->state.load() == Lvn_AssetLoadState_Loading)
+		lvn::assetLoadCreateModel(lvnctx, assetLoad);
+
+	return assetLoad->state.load(std::memory_order_acquire);
+}
+
+void assetLoadProcessPending()
+{
+	LvnContext* lvnctx = lvn::getContext();
+
+	std::vector<LvnAssetLoad*> pending;
+	{
+		std::lock_guard<std::mutex> lock(lvnctx->assetLoadMutex);
+		if (lvnctx->assetModelQueue.empty()) { return; }
+		pending = lvnctx->assetModelQueue;
+	}
+
+	for (LvnAssetLoad* assetLoad : pending)
+		lvn::assetLoadCreateModel(lvnctx, assetLoad);
+}
+
+LvnModel assetLoadGetModel(LvnAssetLoad* assetLoad)
+{
+	if (assetLoad->type != Lvn_AssetLoadType_Model || assetLoad->state.load(std::memory_order_acquire) != Lvn_AssetLoadState_Ready || assetLoad->resultTaken)
+	{
+		LVN_CORE_ERROR("assetLoadGetModel(LvnAssetLoad*) | asset load (%p) is not a finished model load or the model was already taken", assetLoad);
+		return {};
+	}
+
+	assetLoad->resultTaken = true;
+	return std::move(assetLoad->model);
+}
+
+LvnImageData assetLoadGetImageData(LvnAssetLoad* assetLoad)
+{
+	if (assetLoad->type != Lvn_AssetLoadType_ImageData || assetLoad->state.load(std::memory_order_acquire) != Lvn_AssetLoadState_Ready || assetLoad->resultTaken)
+	{
+		LVN_CORE_ERROR("assetLoadGetImageData(LvnAssetLoad*) | asset load (%p) is not a finished image load or the image data was already taken", assetLoad);
+		return {};
+	}
+
+	assetLoad->resultTaken = true;
+	return std::move(assetLoad->imageData);
+}
+
+LvnFont assetLoadGetFont(LvnAssetLoad* assetLoad)
+{
+	if (assetLoad->type != Lvn_AssetLoadType_Font || assetLoad->state.load(std::memory_order_acquire) != Lvn_AssetLoadState_Ready || assetLoad->resultTaken)
+	{
+		LVN_CORE_ERROR("assetLoadGetFont(LvnAssetLoad*) | asset load (%p) is not a finished font load or the font was already taken", assetLoad);
+		return {};
+	}
+
+	assetLoad->resultTaken = true;
+	return std::move(assetLoad->font);
+}
+
+LvnSound* assetLoadGetSound(LvnAssetLoad* assetLoad)
+{
+	if (assetLoad->type != Lvn_AssetLoadType_Sound || assetLoad->state.load(std::memory_order_acquire) != Lvn_AssetLoadState_Ready || assetLoad->resultTaken)
+	{
+		LVN_CORE_ERROR("assetLoadGetSound(LvnAssetLoad*) | asset load (%p) is not a finished sound load or the sound was already taken", assetLoad);
+		return nullptr;
+	}
+
+	assetLoad->resultTaken = true;
+	return assetLoad->sound;
+}
+
 LvnCamera cameraConfigInit(LvnCameraCreateInfo* createInfo)
 {
 	LvnCamera camera{};
@@ -3146,14 +6253,51 @@ LvnResult socketReceive(LvnSocket* socket, LvnPacket* packet, uint32_t milliseco
 // [SECTION]: Math Functions
 // ------------------------------------------------------------
 
-float radians(float deg)
-{
-	return deg * 0.0174532925199f; // deg * (PI / 180)
-}
+// compile time checks, the library fails to build if any of the math types or functions below can no longer be used in constant expressions
+static_assert(lvn::min(2, 3) == 2 && lvn::max(2, 3) == 3 && lvn::clamp(5, 0, 4) == 4, "min, max and clamp are not constexpr");
+static_assert(lvn::within(lvn::degrees(lvn::radians(90.0f)), 90.0f, 0.001f), "radians and degrees are not constexpr");
+
+static_assert(LvnVec3(1.0f, LvnVec2(2.0f, 3.0f)).z == 3.0f && LvnVec4(1.0f, LvnVec3(2.0f, 3.0f, 4.0f)).w == 4.0f, "vector constructors are not constexpr");
+static_assert(LvnVec2(LvnVec4(1.0f, 2.0f, 3.0f, 4.0f)).y == 2.0f && LvnVec3(LvnVec4(1.0f, 2.0f, 3.0f, 4.0f))[2] == 3.0f, "vector conversions are not constexpr");
+static_assert((LvnVec3(1.0f, 2.0f, 3.0f) * 2.0f - LvnVec3(1.0f)).z == 5.0f && (-LvnVec4(1.0f)).w == -1.0f, "vector operators are not constexpr");
+static_assert([]() { LvnVec3 v(1.0f); v += LvnVec3(2.0f); v *= LvnVec3(2.0f); v[1] = 0.0f; return v.x + v.y; }() == 6.0f, "vector assignment operators are not constexpr");
+static_assert(LvnVec3{}.x == 0.0f && LvnVec4d{}.w == 0.0, "value initialized vectors are not constexpr");
+
+static_assert(lvn::dot(LvnVec3(1.0f, 2.0f, 3.0f), LvnVec3(4.0f, 5.0f, 6.0f)) == 32.0f && lvn::dot(LvnVec2d(1.0, 2.0), LvnVec2d(3.0, 4.0)) == 11.0, "dot is not constexpr");
+static_assert(lvn::cross(LvnVec3(1.0f, 0.0f, 0.0f), LvnVec3(0.0f, 1.0f, 0.0f)).z == 1.0f && lvn::cross(LvnVec3i(0, 1, 0), LvnVec3i(0, 0, 1)).x == 1, "cross is not constexpr");
+
+static_assert((LvnMat2x2_t<double>(2.0) * LvnVec2d(1.0, 2.0)).y == 4.0 && lvn::inverse(LvnMat2x2_t<double>(4.0))[1][1] == 0.25, "2x2 matrices are not constexpr");
+static_assert((LvnMat3x3_t<double>(2.0) * LvnMat3x3_t<double>(3.0))[2][2] == 6.0 && lvn::inverse(LvnMat3x3_t<double>(2.0))[0][0] == 0.5, "3x3 matrices are not constexpr");
+static_assert(LvnMat4x3(LvnMat4(2.0f))[3].z == 0.0f && (LvnMat2x4(1.0f) * LvnMat4x2(1.0f))[1][1] == 1.0f, "non square matrices are not constexpr");
+static_assert(LvnMat4::length() == 4 && LvnMat4d()[3][3] == 1.0 && (LvnMat4d(2.0) * LvnVec4d(1.0))[2] == 2.0, "4x4 matrices are not constexpr");
+static_assert(lvn::translate(LvnMat4d(1.0), LvnVec3d(1.0, 2.0, 3.0))[3][1] == 2.0 && lvn::scale(LvnMat4d(1.0), LvnVec3d(2.0))[2][2] == 2.0, "translate and scale are not constexpr");
+static_assert(lvn::orthoRHZO(-2.0, 2.0, -1.0, 1.0, 0.0, 1.0)[0][0] == 0.5 && lvn::orthoLHNO(0.0, 2.0, 0.0, 2.0, -1.0, 1.0)[3][0] == -1.0, "ortho is not constexpr");
+static_assert(lvn::quatToMat4(LvnQuat_t<double>(1.0, 0.0, 0.0, 0.0))[1][1] == 1.0 && LvnQuat_t<double>(1.0, 2.0, 3.0, 4.0)[3] == 4.0, "quaternions are not constexpr");
+static_assert([]() { constexpr LvnQuat_t<double> q(1.0, 2.0, 3.0, 4.0); constexpr LvnMat4d m(2.0); constexpr LvnMat4d mm = m * m; return q[2] + mm[3][3]; }() == 7.0, "const quaternions and matrices are not constexpr");
+
+#if !defined(LVN_MATH_NO_CONSTANT_EVALUATED)
+// float 4x4 matrix math uses simd at runtime and sqrtConstexpr uses sqrt, both need the compiler to tell when they are evaluated at compile time
+static_assert(lvn::sqrtConstexpr(16.0) == 4.0 && lvn::sqrtConstexpr(2.0f) == 1.41421354f && lvn::sqrtConstexpr(0.0f) == 0.0f, "sqrtConstexpr is not constexpr");
+static_assert(lvn::sqrtConstexpr(0.5) == 0.70710678118654757 && lvn::sqrtConstexpr(3.0) == 1.7320508075688772 && lvn::sqrtConstexpr(1e-300) == 1e-150, "sqrtConstexpr is not correctly rounded");
+static_assert(lvn::normalize(LvnVec3(0.0f, 0.0f, 2.0f)).z == 1.0f && lvn::normalize(LvnQuat(0.0f, 0.0f, 0.0f, 2.0f)).z == 1.0f, "normalize is not constexpr");
+static_assert((lvn::translate(LvnMat4(1.0f), LvnVec3(1.0f, 2.0f, 3.0f)) * LvnVec4(0.0f, 0.0f, 0.0f, 1.0f)).z == 3.0f, "float 4x4 matrix multiply is not constexpr");
+static_assert([]() { constexpr LvnMat4 a(2.0f); constexpr LvnMat4 b = a * a; constexpr LvnVec4 v = b * LvnVec4(1.0f); return v.w; }() == 4.0f, "float 4x4 matrix multiply of const matrices is not constexpr");
+static_assert(lvn::inverse(lvn::scale(LvnMat4(1.0f), LvnVec3(2.0f)))[1][1] == 0.5f && lvn::transpose(lvn::translate(LvnMat4(1.0f), LvnVec3(5.0f)))[0][3] == 5.0f, "float 4x4 inverse and transpose are not constexpr");
+static_assert(lvn::inverseAffine(lvn::translate(LvnMat4(1.0f), LvnVec3(1.0f, 2.0f, 3.0f)))[3][0] == -1.0f, "float 4x4 affine inverse is not constexpr");
+static_assert(lvn::lookAtRH(LvnVec3(0.0f, 0.0f, 1.0f), LvnVec3(0.0f), LvnVec3(0.0f, 1.0f, 0.0f))[3][2] == -1.0f, "lookAt is not constexpr");
+#endif
 
-float degrees(float rad)
+const char* mathGetSimdInstructionSet()
 {
-	return rad * 57.2957795131f; // rad * (180 / PI)
+#if defined(LVN_MATH_SIMD_AVX)
+	return "avx";
+#elif defined(LVN_MATH_SIMD_SSE)
+	return "sse";
+#elif defined(LVN_MATH_SIMD_NEON)
+	return "neon";
+#else
+	return "scalar";
+#endif
 }
 
 float clampAngle(float rad)
@@ -3188,20 +6332,4 @@ float invSqrt(float num)
 	return conv.f;
 }
 
-LvnVec3f cross(LvnVec3f v1, LvnVec3f v2)
-{
-	float cx = v1.y * v2.z - v1.z * v2.y;
-	float cy = v1.z * v2.x - v1.x * v2.z;
-	float cz = v1.x * v2.y - v1.y * v2.x;
-	return { cx, cy, cz };
-}
-
-LvnVec3d cross(LvnVec3d v1, LvnVec3d v2)
-{
-	double cx = v1.y * v2.z - v1.z * v2.y;
-	double cy = v1.z * v2.x - v1.x * v2.z;
-	double cz = v1.x * v2.y - v1.y * v2.x;
-	return { cx, cy, cz };
-}
-
 } /* namespace lvn */
@@ -3,131 +3,151 @@
 
 #include "levikno.h"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <shared_mutex>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define LVN_RETURN_ADDRESS() _ReturnAddress()
+#else
+	#define LVN_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
 
-template <typename T>
-struct LvnNode
+namespace lvn
 {
-	T data;
-	LvnNode* next;
-	LvnNode* prev;
-};
+	void*       memVirtualReserve(uint64_t size, bool hugePages);              // reserves a range of virtual memory without committing any physical pages, hugePages advises the os to back the range with transparent huge pages
+	void        memVirtualCommit(void* ptr, uint64_t size);                    // commits the pages containing the given range of reserved virtual memory so they can be read and written
+	void        memVirtualRelease(void* ptr, uint64_t size, bool hugePages);   // releases a range of virtual memory reserved with memVirtualReserve
+	void*       memAllocUntagged(size_t size, size_t alignment, bool zeroMemory); // allocates memory with the context allocation callbacks (or malloc if none are set) without adding to the memory tag counts, alignment cannot be larger than alignof(std::max_align_t)
+	void        memFreeUntagged(void* ptr);                                   // frees memory allocated with memAllocUntagged
+}
 
-template <typename T>
-class LvnList
+
+/*
+  LvnSegmentedArray stores elements in a fixed table of segments where each segment is
+  twice the size of the previous one. Segments are never moved or reallocated, so element
+  addresses stay valid as the array grows, indexing is O(1) and elements are constructed in
+  place without a separate allocation per element.
+*/
+template <typename T, uint32_t FirstSegmentBits = 3>
+class LvnSegmentedArray
 {
 private:
-	LvnNode<T>* m_Head;
-	LvnNode<T>* m_Tail;
-	uint32_t m_Size;
+	static constexpr uint32_t s_MaxSegments = 64 - FirstSegmentBits;
 
-public:
-	LvnList() : m_Head(nullptr), m_Tail(nullptr), m_Size(0) {}
+	T* m_Segments[s_MaxSegments];
+	uint64_t m_Size;
 
-	~LvnList()
+	static uint32_t highest_bit(uint64_t value)
 	{
-		while (m_Head != nullptr)
-		{
-			LvnNode<T>* node = m_Head;
-			m_Head = node->next;
-			delete node;
-		}
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return index;
+#else
+		return 63 - __builtin_clzll(value);
+#endif
 	}
 
-	T& operator [](uint32_t index)
-	{
-		LVN_CORE_ASSERT(index < m_Size, "list index out of range");
+	static uint64_t segment_size(uint32_t segment) { return 1ull << (segment + FirstSegmentBits); }
 
-		LvnNode<T>* node = m_Head;
-
-		for (uint32_t i = 0; i < index; i++)
-		{
-			node = node->next;
-		}
-
-		return node->data;
+	// maps an element index to its segment and the index of the element within that segment
+	static void locate(uint64_t index, uint32_t* segment, uint64_t* offset)
+	{
+		uint64_t biased = index + (1ull << FirstSegmentBits);
+		uint32_t bit = highest_bit(biased);
+		*segment = bit - FirstSegmentBits;
+		*offset = biased - (1ull << bit);
 	}
-	const T& operator [](uint32_t index) const
+
+	T* slot(uint64_t index)
 	{
-		LVN_CORE_ASSERT(index < m_Size, "list index out of range");
+		uint32_t segment; uint64_t offset;
+		locate(index, &segment, &offset);
+		return &m_Segments[segment][offset];
+	}
 
-		LvnNode<T>* node = m_Head;
+	T* next_slot()
+	{
+		uint32_t segment; uint64_t offset;
+		locate(m_Size, &segment, &offset);
 
-		for (uint32_t i = 0; i < index; i++)
+		if (m_Segments[segment] == nullptr)
 		{
-			node = node->next;
+			void* memptr = lvn::memAllocUntagged(segment_size(segment) * sizeof(T), alignof(T), false);
+			LVN_CORE_ASSERT(memptr, "malloc failure when allocating segmented array segment");
+			m_Segments[segment] = static_cast<T*>(memptr);
 		}
 
-		return node->data;
+		return &m_Segments[segment][offset];
 	}
 
-	uint32_t    size() { return m_Size; }
-	bool        empty() { return m_Size == 0; }
-
-	T&          front() { return m_Head->data; }
-	const T&    front() const { return m_Head->data; }
+public:
+	LvnSegmentedArray() : m_Segments(), m_Size(0) {}
 
-	T&          back() { return m_Tail->data; }
-	const T&    back() const { return m_Tail->data; }
+	LvnSegmentedArray(const LvnSegmentedArray&) = delete;
+	LvnSegmentedArray& operator =(const LvnSegmentedArray&) = delete;
 
-	void push_back(const T& data)
+	LvnSegmentedArray(LvnSegmentedArray&& other) noexcept
+		: m_Size(other.m_Size)
 	{
-		if (!m_Size)
+		for (uint32_t i = 0; i < s_MaxSegments; i++)
 		{
-			m_Head = new LvnNode<T>();
-			m_Head->data = data;
-			m_Tail = m_Head;
-			m_Size++;
-			return;
+			m_Segments[i] = other.m_Segments[i];
+			other.m_Segments[i] = nullptr;
 		}
 
-		LvnNode<T>* node = m_Tail;
-		node->next = new LvnNode<T>();
-		m_Tail = node->next;
-		m_Tail->data = data;
-		m_Tail->prev = node;
-		m_Size++;
+		other.m_Size = 0;
 	}
 
-	void push_front(const T& data)
+	~LvnSegmentedArray()
 	{
-		if (!m_Size)
-		{
-			m_Head = new LvnNode<T>();
-			m_Head->data = data;
-			m_Tail = m_Head;
-			m_Size++;
-			return;
-		}
+		while (m_Size) { pop_back(); }
 
-		LvnNode<T>* node = new LvnNode<T>();
-		node->data = data;
-		node->next = m_Head;
-		m_Head->prev = node;
-		m_Head = node;
-		m_Size++;
+		for (uint32_t i = 0; i < s_MaxSegments; i++)
+			lvn::memFreeUntagged(m_Segments[i]);
 	}
 
-	void pop_back()
+	T& operator [](uint64_t index)
 	{
-		if (!m_Size) { return; }
-		if (m_Size == 1) { delete m_Tail; m_Tail = m_Head = nullptr; m_Size--; return; }
+		LVN_CORE_ASSERT(index < m_Size, "segmented array index out of range");
+		return *slot(index);
+	}
+	const T& operator [](uint64_t index) const
+	{
+		LVN_CORE_ASSERT(index < m_Size, "segmented array index out of range");
+		return *const_cast<LvnSegmentedArray*>(this)->slot(index);
+	}
 
-		LvnNode<T>* node = m_Tail->prev;
-		node->next = nullptr;
-		delete m_Tail;
-		m_Tail = node;
-		m_Size--;
+	uint64_t    size() const { return m_Size; }
+	bool        empty() const { return m_Size == 0; }
+
+	T&          front() { return (*this)[0]; }
+	const T&    front() const { return (*this)[0]; }
+
+	T&          back() { return (*this)[m_Size - 1]; }
+	const T&    back() const { return (*this)[m_Size - 1]; }
+
+	template <typename... Args>
+	T& emplace_back(Args&&... args)
+	{
+		T* element = new (next_slot()) T(std::forward<Args>(args)...);
+		m_Size++;
+		return *element;
 	}
 
-	void pop_front()
+	void push_back(const T& data) { emplace_back(data); }
+	void push_back(T&& data) { emplace_back(std::move(data)); }
+
+	void pop_back()
 	{
 		if (!m_Size) { return; }
-		if (m_Size == 1) { delete m_Head; m_Head = m_Tail = nullptr; m_Size--; return; }
 
-		LvnNode<T>* node = m_Head->next;
-		node->prev = nullptr;
-		delete m_Head;
-		m_Head = node;
+		slot(m_Size - 1)->~T();
 		m_Size--;
 	}
 };
@@ -138,39 +158,65 @@ class LvnMemoryBlock
 private:
 	void* m_Memory;
 	uint64_t m_Size;
+	bool m_Virtual, m_HugePages;
 
-public:
-	LvnMemoryBlock() : m_Memory(nullptr), m_Size(0) {}
-
-	LvnMemoryBlock(uint64_t memsize)
-		: m_Size(memsize)
+	void allocate()
 	{
-		void* memptr = calloc(1, memsize);
+		if (m_Virtual)
+		{
+			m_Memory = lvn::memVirtualReserve(m_Size, m_HugePages);
+			LVN_CORE_ASSERT(m_Memory, "failed to reserve virtual memory when allocating memory block");
+			return;
+		}
+
+		void* memptr = lvn::memAllocUntagged(m_Size, alignof(std::max_align_t), true);
 		LVN_CORE_ASSERT(memptr, "malloc failure when allocating memory block");
 		m_Memory = memptr;
 	}
 
+	void release()
+	{
+		if (m_Memory == nullptr) { return; }
+
+		if (m_Virtual)
+			lvn::memVirtualRelease(m_Memory, m_Size, m_HugePages);
+		else
+			lvn::memFreeUntagged(m_Memory);
+
+		m_Memory = nullptr;
+	}
+
+public:
+	LvnMemoryBlock() : m_Memory(nullptr), m_Size(0), m_Virtual(false), m_HugePages(false) {}
+
+	// virtualReserve only reserves the address range of the block, pages are committed when memory bindings hand out slots
+	LvnMemoryBlock(uint64_t memsize, bool virtualReserve = false, bool hugePages = false)
+		: m_Memory(nullptr), m_Size(memsize), m_Virtual(virtualReserve), m_HugePages(virtualReserve && hugePages)
+	{
+		allocate();
+	}
+
 	LvnMemoryBlock(const LvnMemoryBlock& other)
+		: m_Memory(nullptr), m_Size(other.m_Size), m_Virtual(other.m_Virtual), m_HugePages(other.m_HugePages)
 	{
-		m_Size = other.m_Size;
-		void* memptr = calloc(1, m_Size);
-		LVN_CORE_ASSERT(memptr, "malloc failure when allocating memory block");
-		m_Memory = memptr;
+		allocate();
 	}
 
 	LvnMemoryBlock& operator =(const LvnMemoryBlock& other)
 	{
+		release();
+
 		m_Size = other.m_Size;
-		void* memptr = calloc(1, m_Size);
-		LVN_CORE_ASSERT(memptr, "malloc failure when allocating memory block");
-		m_Memory = memptr;
+		m_Virtual = other.m_Virtual;
+		m_HugePages = other.m_HugePages;
+		allocate();
 
 		return *this;
 	}
 
 	~LvnMemoryBlock()
 	{
-		free(m_Memory);
+		release();
 	}
 
 	void* operator [](uint64_t bytes)
@@ -181,57 +227,228 @@ public:
 	}
 
 	uint64_t size() { return m_Size; }
+	bool     is_virtual() { return m_Virtual; }
+
+	// number of bytes committed at once when a memory binding reaches uncommitted memory
+	uint64_t commit_granularity() { return m_HugePages ? (2ull << 20) : (64ull << 10); }
+
+	void commit(void* ptr, uint64_t size)
+	{
+		if (m_Virtual) { lvn::memVirtualCommit(ptr, size); }
+	}
 };
 
 class LvnMemoryBinding
 {
 private:
+	/*
+	  freed slots are kept in an intrusive free list; the first bytes of each freed slot
+	  store the address of the next free slot so no extra memory is needed to track them.
+	  the list head is a tagged pointer (address + modification counter) packed into one
+	  64 bit word so that pops and pushes are lock-free and ABA-safe across threads
+	*/
+	struct LvnFreeSlot
+	{
+		LvnFreeSlot* next;
+	};
+
+#if UINTPTR_MAX > 0xFFFFFFFF
+	static constexpr uint64_t s_TagShift = 48;
+	static constexpr uint64_t s_PtrMask = (1ull << s_TagShift) - 1;
+#else
+	static constexpr uint64_t s_TagShift = 32;
+	static constexpr uint64_t s_PtrMask = 0xFFFFFFFFull;
+#endif
+
+	static uint64_t      pack_head(LvnFreeSlot* slot, uint64_t tag) { return (reinterpret_cast<uintptr_t>(slot) & s_PtrMask) | (tag << s_TagShift); }
+	static LvnFreeSlot*  head_slot(uint64_t head) { return reinterpret_cast<LvnFreeSlot*>(static_cast<uintptr_t>(head & s_PtrMask)); }
+	static uint64_t      head_tag(uint64_t head) { return head >> s_TagShift; }
+
 	void* m_Data;
-	uint64_t m_ObjSize, m_Size, m_Capacity;
-	std::queue<void*> m_Available;
+	uint64_t m_ObjSize, m_Capacity;
+	std::atomic<uint64_t> m_Size;
+	std::atomic<uint64_t> m_FreeHead;
+	std::atomic<uint64_t> m_FreeCount;
+
+	LvnMemoryBlock* m_Block;            // block the memory of this binding is in, used to commit pages of virtual memory blocks
+	std::atomic<uint64_t> m_Committed;  // number of bytes from m_Data that are committed
+
+	std::atomic<LvnMemoryBinding*> m_Next;
+
+	// commits the pages of a virtual memory block up to and including the slot at index
+	void commit_slot(uint64_t index)
+	{
+		uint64_t end = (index + 1) * m_ObjSize;
+		uint64_t committed = m_Committed.load(std::memory_order_acquire);
+
+		while (end > committed)
+		{
+			uint64_t granularity = m_Block->commit_granularity();
+			uint64_t commitEnd = (end + granularity - 1) / granularity * granularity;
+			if (commitEnd > m_Capacity * m_ObjSize) { commitEnd = m_Capacity * m_ObjSize; }
 
-	LvnMemoryBinding* m_Next;
+			// committing the same pages from more than one thread is harmless
+			m_Block->commit(static_cast<uint8_t*>(m_Data) + committed, commitEnd - committed);
+
+			if (m_Committed.compare_exchange_weak(committed, commitEnd, std::memory_order_acq_rel, std::memory_order_acquire))
+				break;
+		}
+	}
 
 public:
-	LvnMemoryBinding() : m_Data(nullptr), m_ObjSize(0), m_Size(0), m_Capacity(0), m_Next(nullptr) {}
-	LvnMemoryBinding(void* data, uint64_t objSize, uint64_t count) : m_Data(data), m_ObjSize(objSize), m_Size(0), m_Capacity(count), m_Next(nullptr) {}
+	LvnMemoryBinding() : m_Data(nullptr), m_ObjSize(0), m_Capacity(0), m_Size(0), m_FreeHead(0), m_FreeCount(0), m_Block(nullptr), m_Committed(0), m_Next(nullptr) {}
+	LvnMemoryBinding(void* data, uint64_t objSize, uint64_t count, LvnMemoryBlock* block = nullptr)
+		: m_Data(data), m_ObjSize(objSize), m_Capacity(count), m_Size(0), m_FreeHead(0), m_FreeCount(0), m_Block(block && block->is_virtual() ? block : nullptr), m_Committed(0), m_Next(nullptr)
+	{
+		LVN_CORE_ASSERT(count == 0 || objSize >= sizeof(LvnFreeSlot), "memory binding object size is smaller than a free slot pointer");
+	}
 
-	void                 set_next_memory_binding(LvnMemoryBinding* next) { m_Next = next; }
-	LvnMemoryBinding*    get_next_memory_binding() { return m_Next; }
-	bool                 full() { return m_Size == m_Capacity; }
+	LvnMemoryBinding(const LvnMemoryBinding& other)
+		: m_Data(other.m_Data), m_ObjSize(other.m_ObjSize), m_Capacity(other.m_Capacity),
+		  m_Size(other.m_Size.load()), m_FreeHead(other.m_FreeHead.load()), m_FreeCount(other.m_FreeCount.load()),
+		  m_Block(other.m_Block), m_Committed(other.m_Committed.load()), m_Next(other.m_Next.load()) {}
 
+	LvnMemoryBinding& operator =(const LvnMemoryBinding& other)
+	{
+		m_Data = other.m_Data;
+		m_ObjSize = other.m_ObjSize;
+		m_Capacity = other.m_Capacity;
+		m_Size.store(other.m_Size.load());
+		m_FreeHead.store(other.m_FreeHead.load());
+		m_FreeCount.store(other.m_FreeCount.load());
+		m_Block = other.m_Block;
+		m_Committed.store(other.m_Committed.load());
+		m_Next.store(other.m_Next.load());
+
+		return *this;
+	}
+
+	void                 set_next_memory_binding(LvnMemoryBinding* next) { m_Next.store(next, std::memory_order_release); }
+	LvnMemoryBinding*    get_next_memory_binding() { return m_Next.load(std::memory_order_acquire); }
+	bool                 full() { return m_Size.load(std::memory_order_relaxed) >= m_Capacity; }
+	uint64_t             size() { uint64_t size = m_Size.load(std::memory_order_relaxed); return size < m_Capacity ? size : m_Capacity; }
+	uint64_t             capacity() { return m_Capacity; }
+	uint64_t             free_count() { return m_FreeCount.load(std::memory_order_relaxed); }
+	bool                 contains(void* ptr) { return ptr >= m_Data && ptr < static_cast<uint8_t*>(m_Data) + m_Capacity * m_ObjSize; }
+
+	// returns nullptr if this binding and every binding after it are full
 	void* take_next()
 	{
-		if (!m_Available.empty())
+		uint64_t head = m_FreeHead.load(std::memory_order_acquire);
+		while (head_slot(head) != nullptr)
 		{
-			void* value = m_Available.front();
-			m_Available.pop();
-			return value;
+			LvnFreeSlot* slot = head_slot(head);
+			uint64_t next = pack_head(slot->next, head_tag(head) + 1);
+
+			if (m_FreeHead.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				m_FreeCount.fetch_sub(1, std::memory_order_relaxed);
+				return slot;
+			}
 		}
 
-		if (full()) // current memory block is full, get next memory block
+		if (!full())
 		{
-			return m_Next->take_next();
+			uint64_t index = m_Size.fetch_add(1, std::memory_order_relaxed);
+			if (index < m_Capacity)
+			{
+				if (m_Block != nullptr) { commit_slot(index); }
+				return &static_cast<uint8_t*>(m_Data)[index * m_ObjSize];
+			}
+
+			m_Size.store(m_Capacity, std::memory_order_relaxed); // another thread took the last slot
 		}
 
-		uint64_t index = m_Size;
-		m_Size++;
-		return &static_cast<uint8_t*>(m_Data)[index * m_ObjSize];
+		// current memory block is full, get next memory block
+		LvnMemoryBinding* next = get_next_memory_binding();
+		return next != nullptr ? next->take_next() : nullptr;
 	}
 
 	void push_back(void* value)
 	{
-		LVN_CORE_ASSERT(value != nullptr, "value is nullptr when pushing back into memory binding queue");
+		LVN_CORE_ASSERT(value != nullptr, "value is nullptr when pushing back into memory binding free list");
+
+		LvnFreeSlot* slot = static_cast<LvnFreeSlot*>(value);
+		uint64_t head = m_FreeHead.load(std::memory_order_relaxed);
+		do
+		{
+			slot->next = head_slot(head);
+		} while (!m_FreeHead.compare_exchange_weak(head, pack_head(slot, head_tag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
 
-		m_Available.push(value);
+		m_FreeCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// the functions below walk the free list without synchronization, they must not be
+	// called while other threads create or destroy objects using this memory binding
+
+	// get the number of free slots in the free list that belong to the memory of owner
+	uint64_t free_slot_count(LvnMemoryBinding* owner)
+	{
+		uint64_t count = 0;
+		for (LvnFreeSlot* slot = head_slot(m_FreeHead.load()); slot != nullptr; slot = slot->next)
+			if (owner->contains(slot)) { count++; }
+
+		return count;
+	}
+
+	// remove all free slots from the free list that belong to the memory of owner
+	void erase_free_slots(LvnMemoryBinding* owner)
+	{
+		uint64_t head = m_FreeHead.load();
+		LvnFreeSlot* first = head_slot(head);
+		uint64_t erased = 0;
+
+		while (first != nullptr && owner->contains(first))
+		{
+			first = first->next;
+			erased++;
+		}
+
+		for (LvnFreeSlot* slot = first; slot != nullptr; slot = slot->next)
+		{
+			while (slot->next != nullptr && owner->contains(slot->next))
+			{
+				slot->next = slot->next->next;
+				erased++;
+			}
+		}
+
+		m_FreeHead.store(pack_head(first, head_tag(head) + 1));
+		m_FreeCount.fetch_sub(erased);
 	}
 };
 
 struct LvnMemoryPool
 {
-	LvnList<LvnMemoryBlock> memBlocks;
+	LvnSegmentedArray<LvnMemoryBlock> memBlocks;                   // first memory block, shared by all sTypes
+	std::vector<LvnSegmentedArray<LvnMemoryBlock>> sTypeMemBlocks; // further memory blocks grown individually for each sType
+	std::mutex memBlockMutex;                                      // guards creating and freeing memory blocks when a binding runs out of slots
+	bool virtualMemory;                                            // memory blocks reserve virtual memory and commit pages as slots are used
 
-	std::vector<LvnList<LvnMemoryBinding>> memBindings;
+	std::vector<LvnSegmentedArray<LvnMemoryBinding>> memBindings;
+};
+
+// linear memory handed out by lvn::frameAlloc, one arena per frame in flight
+struct LvnFrameArena
+{
+	uint8_t* data;
+	uint64_t capacity;
+	std::atomic<uint64_t> offset;             // bump offset into data, never past capacity, allocations that do not fit go to overflowAllocations
+	std::vector<void*> overflowAllocations;   // allocations made after the arena was full, freed when the arena is reset
+	uint64_t overflowSize;                    // total size of overflow allocations, the arena grows by this much when reset
+
+	LvnFrameArena() : data(nullptr), capacity(0), offset(0), overflowSize(0) {}
+	LvnFrameArena(const LvnFrameArena& other)
+		: data(other.data), capacity(other.capacity), offset(other.offset.load()), overflowAllocations(other.overflowAllocations), overflowSize(other.overflowSize) {}
+	LvnFrameArena& operator =(const LvnFrameArena& other)
+	{
+		data = other.data;
+		capacity = other.capacity;
+		offset.store(other.offset.load());
+		overflowAllocations = other.overflowAllocations;
+		overflowSize = other.overflowSize;
+		return *this;
+	}
 };
 
 
@@ -239,12 +456,327 @@ struct LvnMemoryPool
 // [SECTION]: Core Internal structs
 // ------------------------------------------------------------
 
+enum LvnLogTokenType
+{
+	Lvn_LogToken_Literal,
+	Lvn_LogToken_NewLine,
+	Lvn_LogToken_LoggerName,
+	Lvn_LogToken_Level,
+	Lvn_LogToken_ColorStart,
+	Lvn_LogToken_ColorReset,
+	Lvn_LogToken_Message,
+	Lvn_LogToken_Percent,
+	Lvn_LogToken_Time,
+	Lvn_LogToken_Time12,
+	Lvn_LogToken_Year,
+	Lvn_LogToken_Year02d,
+	Lvn_LogToken_Month,
+	Lvn_LogToken_MonthName,
+	Lvn_LogToken_MonthNameShort,
+	Lvn_LogToken_Day,
+	Lvn_LogToken_WeekDayName,
+	Lvn_LogToken_WeekDayNameShort,
+	Lvn_LogToken_Hour,
+	Lvn_LogToken_Hour12,
+	Lvn_LogToken_Minute,
+	Lvn_LogToken_Second,
+	Lvn_LogToken_Meridiem,
+	Lvn_LogToken_MeridiemLower,
+	Lvn_LogToken_User,
+};
+
+// one piece of a precompiled log pattern, literal text is a range of the formatter's pattern string
+struct LvnLogToken
+{
+	LvnLogTokenType type;
+	uint32_t literalOffset;
+	uint32_t literalLength;
+	std::string (*func)(LvnLogMessage*);   // only set for user defined patterns
+};
+
+struct LvnLogFormatter
+{
+	std::string pattern;
+	std::vector<LvnLogToken> tokens;
+};
+
+#define LVN_LOG_SINK_DEFAULT_BUFFER_SIZE (64 * 1024)
+
+/*
+  Output target of a logger. Each sink filters by its own level and may use its own pattern,
+  sinks that use the logger's pattern follow logSetPatternFormat. Writes to a sink are
+  serialized by its mutex so the same logger can be used from several threads.
+  - stdout: messages are written directly to stdout
+  - file: messages are collected in the buffer and written with a single fwrite when the buffer
+    is full, on error/fatal messages or when flushed. The file is rotated to path.1 ... path.N
+    when it grows past maxFileSize or has been open longer than rotateInterval seconds
+  - ring: messages overwrite the oldest bytes of a fixed size buffer so that the most recent
+    output is always available, eg. to dump after a crash
+  - binary: same buffering and rotation as file, but messages are not formatted. The record
+    holds the id of the format string and the raw arguments, see LvnLogBinaryRecordType
+*/
+struct LvnLogSink
+{
+	LvnLogSinkType type;
+	LvnLogLevel logLevel;
+	bool useLoggerPattern;
+	LvnLogFormatter formatter;
+	std::mutex mutex;
+
+	// file
+	FILE* file;
+	std::string filepath;
+	std::vector<char> buffer;
+	uint64_t bufferUsed;
+	uint64_t fileSize;
+	uint64_t maxFileSize;
+	uint64_t rotateInterval;
+	long long openTime;
+	uint32_t maxFiles;
+	LvnLogFsyncPolicy fsyncPolicy;
+
+	// ring, uses buffer as storage
+	uint64_t ringHead;
+	bool ringWrapped;
+
+	// binary, format strings are identified by address and written to the file the first time they are used
+	std::unordered_map<const char*, uint32_t> formatIds;
+	bool binaryHeaderWritten;
+
+	~LvnLogSink()
+	{
+		if (!file) { return; }
+		if (bufferUsed) { fwrite(buffer.data(), 1, bufferUsed, file); }
+		fclose(file);
+	}
+};
+
+namespace lvn
+{
+	void        logDestroySink(LvnLogSink* sink);                              // closes the sink and frees its memory
+}
+
 struct LvnLogger
 {
 	std::string loggerName;
 	std::string logPatternFormat;
 	LvnLogLevel logLevel;
-	std::vector<LvnLogPattern> logPatterns;
+	LvnLogFormatter formatter;
+	std::vector<LvnLogSink*> sinks;
+	std::shared_mutex sinkMutex;                  // held shared while sinks are written to, held exclusively while sinks are added or removed
+	std::atomic<uint32_t> binarySinkCount;
+	std::atomic<uint32_t> textSinkCount;
+
+	LvnLogger() = default;
+	LvnLogger(const LvnLogger&) = delete;
+	LvnLogger& operator=(const LvnLogger&) = delete;
+	~LvnLogger() { for (LvnLogSink* sink : sinks) { lvn::logDestroySink(sink); } }
+};
+
+/*
+  Binary log stream written by binary sinks and read by the lvnlogdecode tool. The stream is a
+  sequence of records in native byte order, each starting with a one byte LvnLogBinaryRecordType:
+
+  Header  : char magic[8], u32 version, u32 endianCheck, i64 anchorEpochNs, u64 anchorNs, u16 nameLength, u16 patternLength, name, pattern
+  Format  : u32 formatId, u32 length, format string (not null terminated)
+  Message : u8 level, u32 formatId, u64 timeNs, u32 argSize, args
+
+  Message times are lvn::clockNowNs values so records from different threads keep their order
+  even if the system time changes. The header anchors that clock to the wall clock, anchorNs and
+  anchorEpochNs (nanoseconds since the unix epoch) are sampled together when the header is written.
+
+  A header starts every file (and every append to a file), format ids are only valid until the
+  next header. Arguments are stored in the order of the format specifiers: integers, floats and
+  pointers as 8 bytes, strings as u32 length followed by the characters. '*' widths and
+  precisions are stored as integers before the argument they belong to.
+*/
+#define LVN_LOG_BINARY_MAGIC "LVNBLOG"
+#define LVN_LOG_BINARY_VERSION 2
+#define LVN_LOG_BINARY_ENDIAN_CHECK 0x01020304
+#define LVN_LOG_BINARY_ARG_BUFFER_SIZE 4096
+
+enum LvnLogBinaryRecordType
+{
+	Lvn_LogBinaryRecord_Header = 1,
+	Lvn_LogBinaryRecord_Format,
+	Lvn_LogBinaryRecord_Message,
+};
+
+enum LvnLogArgType
+{
+	Lvn_LogArgType_None,      // %% or a specifier without an argument
+	Lvn_LogArgType_Int,
+	Lvn_LogArgType_Uint,
+	Lvn_LogArgType_Double,
+	Lvn_LogArgType_String,
+	Lvn_LogArgType_Pointer,
+};
+
+enum LvnLogArgLength
+{
+	Lvn_LogArgLength_Default,
+	Lvn_LogArgLength_Char,        // hh
+	Lvn_LogArgLength_Short,       // h
+	Lvn_LogArgLength_Long,        // l
+	Lvn_LogArgLength_LongLong,    // ll
+	Lvn_LogArgLength_IntMax,      // j
+	Lvn_LogArgLength_Size,        // z
+	Lvn_LogArgLength_PtrDiff,     // t
+	Lvn_LogArgLength_LongDouble,  // L
+};
+
+// one printf conversion specifier, parsed the same way by the binary encoder and the decoder
+struct LvnLogFormatSpec
+{
+	const char* begin;            // the '%' of the specifier
+	const char* end;              // one past the conversion character
+	const char* flags;
+	uint32_t flagsLength;
+	int width;                    // -1 if not given
+	int precision;                // -1 if not given
+	bool widthArg;                // width is '*'
+	bool precisionArg;            // precision is '*'
+	LvnLogArgLength length;
+	char conversion;
+	LvnLogArgType argType;
+};
+
+namespace lvn
+{
+	bool        logNextFormatSpec(const char* fmt, LvnLogFormatSpec* spec);    // finds the next printf conversion specifier in fmt, returns false if there are no more specifiers
+}
+
+#define LVN_LOG_RECORD_MSG_SIZE 480
+
+// message queued for the async log writer, messages longer than the buffer are truncated
+struct LvnLogRecord
+{
+	LvnLogger* logger;
+	LvnLogLevel level;
+	long long timeEpoch;
+	char msg[LVN_LOG_RECORD_MSG_SIZE];
+};
+
+/*
+  Bounded lock-free queue of log records, each cell has a sequence number that tells producers
+  and consumers whether the cell is free to write or ready to read. Any thread can push, the
+  writer thread pops, and producers may also pop to discard the oldest record when the queue
+  is full. Capacity is always a power of two.
+*/
+class LvnLogRingBuffer
+{
+private:
+	struct Cell
+	{
+		std::atomic<uint64_t> sequence;
+		LvnLogRecord record;
+	};
+
+	Cell* m_Cells;
+	uint64_t m_Mask;
+	alignas(64) std::atomic<uint64_t> m_EnqueuePos;
+	alignas(64) std::atomic<uint64_t> m_DequeuePos;
+
+public:
+	LvnLogRingBuffer() : m_Cells(nullptr), m_Mask(0), m_EnqueuePos(0), m_DequeuePos(0) {}
+	~LvnLogRingBuffer() { delete[] m_Cells; }
+
+	LvnLogRingBuffer(const LvnLogRingBuffer&) = delete;
+	LvnLogRingBuffer& operator =(const LvnLogRingBuffer&) = delete;
+
+	void init(uint64_t capacity)
+	{
+		uint64_t size = 2;
+		while (size < capacity) { size <<= 1; }
+
+		delete[] m_Cells;
+		m_Cells = new Cell[size];
+		m_Mask = size - 1;
+
+		for (uint64_t i = 0; i < size; i++)
+			m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+
+		m_EnqueuePos.store(0, std::memory_order_relaxed);
+		m_DequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	// claims a cell and calls fill(LvnLogRecord*) to write into it, returns false if the queue is full
+	template <typename F>
+	bool try_push(F&& fill)
+	{
+		Cell* cell;
+		uint64_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			cell = &m_Cells[pos & m_Mask];
+			uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+			int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+
+			if (diff == 0)
+			{
+				if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				pos = m_EnqueuePos.load(std::memory_order_relaxed);
+		}
+
+		fill(&cell->record);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// copies the oldest record into record and removes it, record may be nullptr to discard it, returns false if the queue is empty
+	bool try_pop(LvnLogRecord* record)
+	{
+		Cell* cell;
+		uint64_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			cell = &m_Cells[pos & m_Mask];
+			uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+			int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+
+			if (diff == 0)
+			{
+				if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				pos = m_DequeuePos.load(std::memory_order_relaxed);
+		}
+
+		if (record)
+			*record = cell->record;
+
+		cell->sequence.store(pos + m_Mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const { return m_EnqueuePos.load(std::memory_order_acquire) == m_DequeuePos.load(std::memory_order_acquire); }
+};
+
+struct LvnLogAsyncWriter
+{
+	bool                                 enabled;
+	LvnLogOverflowPolicy                 overflowPolicy;
+	LvnLogRingBuffer                     ringBuffer;
+	std::thread                          thread;
+	std::mutex                           mutex;
+	std::condition_variable              condition;
+	std::atomic<bool>                    sleeping;       // writer thread is waiting on condition, producers only notify when set
+	std::condition_variable              writtenCondition; // notified by the writer thread after writing a record while producers or logFlush are waiting on it
+	std::atomic<uint32_t>                waiters;        // number of threads waiting on writtenCondition
+	std::atomic<bool>                    terminate;
+	std::atomic<uint64_t>                queued;         // number of records pushed into the ring buffer
+	std::atomic<uint64_t>                written;        // number of records written or discarded by the drop oldest policy
+	std::atomic<uint64_t>                dropped;
 };
 
 
@@ -314,12 +846,73 @@ struct LvnRenderPass
         allocated and destroyed with its corresponding functions.
         Use lvn::createWindow() and lvn::destroyWindow()
 */
+#define LVN_GPU_TIMING_MAX_REGIONS 64
+
+struct LvnGpuRegion
+{
+	const char* name;
+	LvnFrameBuffer* frameBuffer;
+	uint32_t depth;
+	uint32_t startQuery, endQuery;   // timestamp queries written at the start and end of the region
+	int32_t statisticsQuery;         // -1 if no statistics were collected
+};
+
+struct LvnGpuTimingFrame
+{
+	std::vector<LvnGpuRegion> regions;
+	uint32_t timestampCount;
+	uint32_t statisticsCount;
+	bool recorded;                   // commands of the frame were recorded and results can be read once the gpu finishes them
+};
+
+// queries are kept for one more frame than the frames in flight, when a frame comes around again its
+// commands have finished on the gpu so its results are read before the queries are reset
+struct LvnGpuTimingData
+{
+	bool timePasses;
+	bool pipelineStatistics;
+	bool recording;                  // between renderBeginCommandRecording and renderEndCommandRecording
+	uint32_t frameIndex;
+	std::vector<LvnGpuTimingFrame> frames;
+	std::vector<uint32_t> openRegions; // regions of the current frame that have not ended, UINT32_MAX for regions that were skipped
+	std::vector<LvnGpuTiming> results; // regions of the latest frame with results
+	void* queryData;                 // query pools or query objects of the graphics api
+};
+
+struct LvnFrameStatsData
+{
+	LvnFrameStats current;                               // counters of the frame being recorded
+	LvnFrameStats history[LVN_FRAME_STATS_HISTORY_SIZE]; // ring of completed frames
+	uint32_t historyIndex;                               // next slot of the history to write to
+	uint32_t historyCount;
+	bool frameBegun;                                     // false until the first renderBeginNextFrame, before that current does not hold a frame
+};
+
+struct LvnFramePacer
+{
+	uint64_t intervalNs;                   // 0 if the frame rate is not limited
+	uint64_t spinNs;
+	uint64_t nextFrameNs;                  // time the next frame is due
+	uint64_t lastFrameNs;                  // time the last frame started, 0 before the first frame
+	uint64_t lastWorkNs;                   // time from the start of the last frame to its framePacerEndFrame
+	uint64_t frameCount;
+	uint64_t missedFrames;
+	std::vector<uint64_t> frameTimes;      // ring of the time between frame starts in nanoseconds
+	uint32_t frameTimeIndex;
+	uint32_t frameTimeCount;
+	void* waitTimer;                       // windows only, high resolution waitable timer used for sleeping, null if not supported
+	bool timerPeriodRaised;                // windows only, timeBeginPeriod was called because there is no high resolution timer
+};
+
 struct LvnWindow
 {
 	LvnWindowData data;          // holds data of window (eg. width, height)
 	void* nativeWindow;          // pointer to window api handle (eg. GLFWwindow)
 	LvnRenderPass renderPass;    // pointer to native render pass for this window
 	void* apiData;               // used for graphics api related uses
+	LvnGpuTimingData* gpuTiming; // nullptr unless gpu timing is enabled
+	LvnFrameStatsData frameStats;
+	uint64_t frameArenaEpoch;    // frame arena epoch of the context when this window last began a frame
 };
 
 struct LvnWindowContext
@@ -425,6 +1018,14 @@ struct LvnGraphicsContext
 	void                        (*frameBufferSetClearColor)(LvnFrameBuffer*, uint32_t, float, float, float, float);
 
 	LvnDepthImageFormat         (*findSupportedDepthImageFormat)(LvnDepthImageFormat*, uint32_t);
+
+	LvnResult                   (*gpuTimingCreate)(LvnWindow*, LvnGpuTimingData*);
+	void                        (*gpuTimingDestroy)(LvnWindow*, LvnGpuTimingData*);
+	void                        (*gpuTimingCmdResetFrame)(LvnWindow*, LvnGpuTimingData*, uint32_t);                        // frame index
+	void                        (*gpuTimingCmdWriteTimestamp)(LvnWindow*, LvnGpuTimingData*, uint32_t, uint32_t);           // frame index, query index
+	void                        (*gpuTimingCmdBeginStatistics)(LvnWindow*, LvnGpuTimingData*, uint32_t, uint32_t);          // frame index, query index
+	void                        (*gpuTimingCmdEndStatistics)(LvnWindow*, LvnGpuTimingData*, uint32_t, uint32_t);            // frame index, query index
+	bool                        (*gpuTimingGetResults)(LvnWindow*, LvnGpuTimingData*, uint32_t, uint64_t*, LvnGpuPipelineStatistics*); // frame index, timestamps in nanoseconds, statistics; returns false without waiting if the results are not available
 };
 
 struct LvnPhysicalDevice
@@ -511,6 +1112,44 @@ struct LvnCubemap
 };
 
 
+// ------------------------------------------------------------
+// [SECTION]: Asset Internal structs
+// ------------------------------------------------------------
+
+namespace lvn { namespace gltfs { struct gltfLoadData; } }
+
+enum LvnAssetLoadType
+{
+	Lvn_AssetLoadType_Model,
+	Lvn_AssetLoadType_ImageData,
+	Lvn_AssetLoadType_Font,
+	Lvn_AssetLoadType_Sound,
+};
+
+struct LvnAssetLoad
+{
+	LvnAssetLoadType type;
+	std::atomic<LvnAssetLoadState> state;
+	LvnJobCounter counter;                      // tracks the loading job on the asset thread pool
+	bool resultTaken;
+
+	// load parameters
+	std::string filepath;
+	int forceChannels;
+	bool flipVertically;
+	uint32_t fontSize;
+	LvnCharset charset;
+	LvnSoundCreateInfo soundCreateInfo;
+
+	// results
+	lvn::gltfs::gltfLoadData* modelData;        // decoded model waiting for its graphics objects to be created
+	LvnModel model;
+	LvnImageData imageData;
+	LvnFont font;
+	LvnSound* sound;
+};
+
+
 // ------------------------------------------------------------
 // [SECTION]: Context Internal structs
 // ------------------------------------------------------------
@@ -522,17 +1161,142 @@ struct LvnStructureTypeInfo
 	uint64_t count;
 };
 
+struct LvnStructureTypeGrowth
+{
+	uint64_t nextCount;   // number of objects in the next memory block grown for this sType
+	float growthFactor;   // multiplier applied to nextCount after each growth
+	uint64_t maxCount;    // max number of objects of this sType, 0 for no limit
+	uint64_t capacity;    // current number of objects this sType has memory for
+	bool hugePages;       // grown memory blocks of this sType use transparent huge pages, only used with virtual memory blocks
+};
+
 struct LvnObjectMemAllocCount
 {
 	struct LvnStructCounts
 	{
 		LvnStructureType sType;
-		size_t count;
+		std::atomic<size_t> count;
+		std::atomic<size_t> peak;
+
+		LvnStructCounts() : sType(Lvn_Stype_Undefined), count(0), peak(0) {}
+		LvnStructCounts(LvnStructureType type, size_t num) : sType(type), count(num), peak(num) {}
+		LvnStructCounts(const LvnStructCounts& other) : sType(other.sType), count(other.count.load()), peak(other.peak.load()) {}
+		LvnStructCounts& operator =(const LvnStructCounts& other) { sType = other.sType; count.store(other.count.load()); peak.store(other.peak.load()); return *this; }
 	};
 
 	std::vector<LvnStructCounts> sTypes;
 };
 
+struct LvnMemoryTagCounts
+{
+	std::atomic<uint64_t> liveBytes;
+	std::atomic<uint64_t> liveCount;
+	std::atomic<uint64_t> peakBytes;
+};
+
+// stored in front of every allocation made with lvn::memAlloc so the size, tag and allocator are known when freeing
+struct alignas(std::max_align_t) LvnMemAllocHeader
+{
+	uint64_t size;
+	LvnMemoryTag tag;
+	uint32_t contextId;                        // id of the context whose memory stats count this allocation, 0 if none do
+	void (*freeFn)(void* ptr, void* userData); // allocation callback the memory came from, nullptr if it came from malloc
+	void* userData;
+};
+
+// where an object or memAlloc allocation was created, only recorded when allocation site tracking is enabled
+struct LvnAllocationRecord
+{
+	const char* site;             // name of the library function that created the allocation
+	void* caller;                 // return address into the code that called that function
+	LvnStructureType sType;       // Lvn_Stype_Undefined for memAlloc allocations
+	LvnMemoryTag tag;
+	uint64_t size;
+};
+
+// profiling
+#define LVN_PROFILE_CHUNK_SIZE 4096
+
+struct LvnProfileZone
+{
+	const char* name;
+	uint64_t startNs;
+	uint64_t endNs;
+};
+
+struct LvnProfileChunk
+{
+	LvnProfileZone zones[LVN_PROFILE_CHUNK_SIZE];
+	std::atomic<LvnProfileChunk*> next;
+};
+
+// zones recorded by one thread, only the owning thread writes zones so recording does not lock
+// chunks are kept and reused by later sessions, the buffer outlives its thread so that its zones can still be written out
+struct LvnProfileThreadBuffer
+{
+	uint32_t threadId;
+	std::string threadName;                // guarded by LvnProfiler::mutex
+	std::atomic<uint32_t> session;         // session the recorded zones belong to
+	std::atomic<uint64_t> count;           // number of zones recorded in the session
+	LvnProfileChunk* first;
+	LvnProfileChunk* current;              // chunk that the next zone is written to, owner thread only
+
+	~LvnProfileThreadBuffer()
+	{
+		LvnProfileChunk* chunk = first;
+		while (chunk)
+		{
+			LvnProfileChunk* next = chunk->next.load();
+			delete chunk;
+			chunk = next;
+		}
+	}
+};
+
+struct LvnProfiler
+{
+	std::mutex mutex;                      // guards buffers, thread names and starting and ending sessions
+	std::vector<LvnProfileThreadBuffer*> buffers;
+	std::atomic<bool> recording;
+	std::atomic<uint32_t> session;
+	uint64_t sessionStartNs;
+
+	~LvnProfiler()
+	{
+		for (LvnProfileThreadBuffer* buffer : buffers)
+			delete buffer;
+	}
+};
+
+// ticks of the cycle counter are converted relative to the time both clocks were read during calibration
+struct LvnClockCalibration
+{
+	bool useCounter;                       // false if the cpu has no counter that runs at a constant rate, ticks are then nanoseconds
+	uint64_t originTicks;                  // first sample of the counter and the clock, the tick rate is measured from here over an ever longer interval
+	uint64_t originNs;
+	uint64_t rebaseTicks;                  // number of ticks (about a second) after which the conversion is compared against clockNowNs again
+
+	// seqlock over the conversion, odd while a thread is rebasing, ticks are converted with the segment starting at baseTicks and ticks
+	// before it with the previous segment, the segments meet at baseTicks so the conversion never goes backwards
+	std::atomic<uint32_t> sequence;
+	std::atomic<uint64_t> baseTicks;
+	std::atomic<uint64_t> baseNs;
+	std::atomic<double> nsPerTick;
+	std::atomic<uint64_t> prevBaseTicks;
+	std::atomic<uint64_t> prevBaseNs;
+	std::atomic<double> prevNsPerTick;
+	std::atomic<double> measuredNsPerTick; // rate measured from the origin, nsPerTick differs from it while errors are slewed away
+};
+
+// thread pool settings copied from LvnContextCreateInfo, the pools are created when first used
+struct LvnThreadPoolConfig
+{
+	LvnThreadPoolCreateInfo createInfo;
+	std::vector<uint32_t> cores;
+	std::vector<uint32_t> reservedCores;   // reserved cores of the pool and the cores reserved for the whole context
+	std::string name;
+};
+
 struct LvnContext
 {
 	LvnWindowApi                         windowapi;
@@ -544,6 +1308,7 @@ struct LvnContext
 
 	bool                                 logging;
 	bool                                 enableCoreLogging;
+	LvnLogAsyncWriter                    logAsyncWriter;
 	LvnLogger                            coreLogger;
 	LvnLogger                            clientLogger;
 	std::vector<LvnLogPattern>           userLogPatterns;
@@ -554,11 +1319,35 @@ struct LvnContext
 	LvnMemAllocMode                      memoryMode;
 	LvnMemoryPool                        memoryPool;
 	std::vector<LvnStructureTypeInfo>    sTypeMemAllocInfos;
-	std::vector<LvnStructureTypeInfo>    blockMemAllocInfos;
-	uint64_t                             blockMemSize;
+	std::vector<LvnStructureTypeGrowth>  sTypeGrowthInfos;
+
+	LvnAllocationCallbacks               allocationCallbacks;   // allocFn is nullptr when no callbacks were set
 
-	size_t                               numMemoryAllocations;
+	uint32_t                             id;                            // unique for each context created, used to tell which context counted an allocation
+	std::atomic<size_t>                  numMemoryAllocations;
 	LvnObjectMemAllocCount               objectMemoryAllocations;
+	LvnMemoryTagCounts                   memoryTagCounts[Lvn_MemoryTag_Max];
+	std::atomic<uint64_t>                totalLiveBytes;
+	std::atomic<uint64_t>                totalPeakBytes;
+
+	bool                                 trackAllocationSites;
+	bool                                 trackLibraryAllocations;
+	std::mutex                           allocationRecordMutex;
+	std::unordered_map<void*, LvnAllocationRecord> allocationRecords;
+
+	std::vector<LvnFrameArena>           frameArenas;
+	std::atomic<uint32_t>                frameArenaIndex;
+	uint64_t                             frameArenaEpoch;       // incremented each time the frame arenas rotate, a window beginning a second frame in the same epoch starts the next frame
+	std::mutex                           frameArenaMutex;       // guards overflow allocations of the frame arenas
+	LvnWindow*                           frameStatsWindow;      // window that last began a frame, buffer uploads are not tied to a window so they are counted for this one
+
+	LvnThreadPoolConfig                  jobPoolConfig;
+	LvnThreadPoolConfig                  assetPoolConfig;
+	LvnThreadPool*                       jobThreadPool;         // created with the first call to getJobThreadPool
+	std::mutex                           jobThreadPoolMutex;
+	LvnThreadPool*                       assetThreadPool;       // created with the first async load
+	std::mutex                           assetLoadMutex;        // guards assetThreadPool creation and assetModelQueue
+	std::vector<LvnAssetLoad*>           assetModelQueue;       // decoded models waiting for their graphics objects to be created on the render thread
 };
 
 
@@ -2,6 +2,8 @@
 
 #include "json.h"
 
+#include <memory>
+
 namespace nlm = nlohmann;
 
 enum LvnFileType
@@ -21,15 +23,32 @@ namespace gltfs
 		uint32_t index;
 	};
 
+	// mesh data decoded on the loading thread, the vertex buffer is created in createModelFromData
+	struct gltfPendingMesh
+	{
+		std::vector<LvnVertex> vertices;
+		std::vector<uint32_t> indices;
+		LvnMaterial material;                 // textures are placeholders until createModelFromData
+		LvnMat4 matrix;
+		LvnMeshBounds bounds;
+	};
+
+	/*
+	  Loading is split in two stages so that the file reads and decoding can run on any thread:
+	  - loadModelData parses the file and decodes vertices and images without touching the graphics api,
+	    textures are recorded as create infos and referenced by placeholder pointers (index + 1)
+	  - createModelFromData creates the textures and buffers, and must be called where graphics objects can be created
+	*/
 	struct gltfLoadData
 	{
 		nlm::json JSON;
 		std::string filepath;
 		LvnFileType filetype;
-		LvnData<uint8_t> binData;
-		std::vector<LvnMesh> meshes;
+		LvnData<uint8_t> fileData;            // owns the loaded binary file memory
+		LvnSpan<const uint8_t> binData;       // view of the binary buffer data within fileData
+		std::vector<gltfPendingMesh> meshes;
 		std::vector<LvnTextureIndexData> textureData;
-		std::vector<LvnTexture*> textures;
+		std::vector<LvnTextureCreateInfo> pendingTextures;
 	};
 
 	static void                    traverseNode(gltfLoadData* gltfData, uint32_t nextNode, LvnMat4 matrix);
@@ -41,6 +60,9 @@ namespace gltfs
 	static LvnMaterial             getMaterial(gltfLoadData* gltfData, nlm::json accessor);
 	static LvnTextureFilter        getTexFilter(uint32_t filter);
 	static std::vector<LvnVec3>    calculateBitangents(const std::vector<LvnVec3>& normals, const std::vector<LvnVec4>& tangents);
+	static LvnMeshBounds           getBounds(const std::vector<LvnVec3>& positions);
+	static LvnTexture*             createTexture(gltfLoadData* gltfData, LvnTextureCreateInfo* createInfo);
+	static LvnTexture*             resolveTexture(const std::vector<LvnTexture*>& textures, LvnTexture* placeholder);
 
 	static void traverseNode(gltfLoadData* gltfData, uint32_t nextNode, LvnMat4 matrix)
 	{
@@ -229,18 +251,14 @@ namespace gltfs
 			LvnMaterial material = gltfs::getMaterial(gltfData, JSON["materials"][meshMaterialIndex]);
 
 
-			LvnMeshCreateInfo meshCreateInfo{};
-
-			LvnBufferCreateInfo meshBufferInfo = lvn::meshGetVertexBufferCreateInfoConfig(vertices.data(), vertices.size(), indices.data(), indices.size());
-			meshCreateInfo.bufferInfo = &meshBufferInfo;
-			meshCreateInfo.material = material;
-
-			LvnMesh mesh = lvn::createMesh(&meshCreateInfo);
-			lvn::meshSetMatrix(&mesh, matrix);
-			mesh.vertexCount = vertices.size();
-			mesh.indexCount = indices.size();
+			gltfPendingMesh mesh{};
+			mesh.bounds = gltfs::getBounds(position);
+			mesh.vertices = std::move(vertices);
+			mesh.indices = std::move(indices);
+			mesh.material = material;
+			mesh.matrix = matrix;
 
-			gltfData->meshes.push_back(mesh);
+			gltfData->meshes.push_back(std::move(mesh));
 		}
 	}
 
@@ -419,12 +437,10 @@ namespace gltfs
 				textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 				textureCreateInfo.format = Lvn_TextureFormat_Srgb;
 
-				LvnTexture* texture;
-				lvn::createTexture(&texture, &textureCreateInfo);
+				LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 				LvnTextureIndexData textureIndexData = { texture, texSource };
 				gltfData->textureData.push_back(textureIndexData);
-				gltfData->textures.push_back(texture);
 				material.albedo = texture;
 			}
 		}
@@ -445,11 +461,9 @@ namespace gltfs
 			textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 			textureCreateInfo.format = Lvn_TextureFormat_Srgb;
 
-			LvnTexture* texture;
-			lvn::createTexture(&texture, &textureCreateInfo);
+			LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 			material.albedo = texture;
-			gltfData->textures.push_back(texture);
 		}
 
 		// metalic roughness
@@ -505,12 +519,10 @@ namespace gltfs
 				textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 				textureCreateInfo.format = Lvn_TextureFormat_Srgb;
 
-				LvnTexture* texture;
-				lvn::createTexture(&texture, &textureCreateInfo);
+				LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 				LvnTextureIndexData textureIndexData = { texture, texSource };
 				gltfData->textureData.push_back(textureIndexData);
-				gltfData->textures.push_back(texture);
 				material.metallicRoughnessOcclusion = texture;
 			}
 		}
@@ -531,11 +543,9 @@ namespace gltfs
 			textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 			textureCreateInfo.format = Lvn_TextureFormat_Srgb;
 
-			LvnTexture* texture;
-			lvn::createTexture(&texture, &textureCreateInfo);
+			LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 			material.metallicRoughnessOcclusion = texture;
-			gltfData->textures.push_back(texture);
 		}
 
 		// normal
@@ -591,12 +601,10 @@ namespace gltfs
 				textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 				textureCreateInfo.format = Lvn_TextureFormat_Unorm;
 
-				LvnTexture* texture;
-				lvn::createTexture(&texture, &textureCreateInfo);
+				LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 				LvnTextureIndexData textureIndexData = { texture, texSource };
 				gltfData->textureData.push_back(textureIndexData);
-				gltfData->textures.push_back(texture);
 				material.normal = texture;
 			}
 		}
@@ -617,11 +625,9 @@ namespace gltfs
 			textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 			textureCreateInfo.format = Lvn_TextureFormat_Unorm;
 
-			LvnTexture* texture;
-			lvn::createTexture(&texture, &textureCreateInfo);
+			LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 			material.normal = texture;
-			gltfData->textures.push_back(texture);
 		}
 
 		// emissive
@@ -677,12 +683,10 @@ namespace gltfs
 				textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 				textureCreateInfo.format = Lvn_TextureFormat_Unorm;
 
-				LvnTexture* texture;
-				lvn::createTexture(&texture, &textureCreateInfo);
+				LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 				LvnTextureIndexData textureIndexData = { texture, texSource };
 				gltfData->textureData.push_back(textureIndexData);
-				gltfData->textures.push_back(texture);
 				material.emissive = texture;
 			}
 		}
@@ -703,11 +707,9 @@ namespace gltfs
 			textureCreateInfo.wrapMode = Lvn_TextureMode_Repeat;
 			textureCreateInfo.format = Lvn_TextureFormat_Unorm;
 
-			LvnTexture* texture;
-			lvn::createTexture(&texture, &textureCreateInfo);
+			LvnTexture* texture = gltfs::createTexture(gltfData, &textureCreateInfo);
 
 			material.emissive = texture;
-			gltfData->textures.push_back(texture);
 		}
 
 		return material;
@@ -737,64 +739,171 @@ namespace gltfs
 
 		return bitangents;
 	}
+
+	static LvnMeshBounds getBounds(const std::vector<LvnVec3>& positions)
+	{
+		if (positions.empty()) { return { LvnVec3(0.0f), LvnVec3(0.0f) }; }
+
+		LvnMeshBounds bounds = { positions[0], positions[0] };
+		for (uint32_t i = 1; i < positions.size(); i++)
+		{
+			const LvnVec3& pos = positions[i];
+			bounds.min = LvnVec3(lvn::min(bounds.min.x, pos.x), lvn::min(bounds.min.y, pos.y), lvn::min(bounds.min.z, pos.z));
+			bounds.max = LvnVec3(lvn::max(bounds.max.x, pos.x), lvn::max(bounds.max.y, pos.y), lvn::max(bounds.max.z, pos.z));
+		}
+
+		return bounds;
+	}
+
+	// records the texture to be created in createModelFromData and returns its placeholder
+	static LvnTexture* createTexture(gltfLoadData* gltfData, LvnTextureCreateInfo* createInfo)
+	{
+		gltfData->pendingTextures.push_back(std::move(*createInfo));
+		return reinterpret_cast<LvnTexture*>(static_cast<uintptr_t>(gltfData->pendingTextures.size()));
+	}
+
+	static LvnTexture* resolveTexture(const std::vector<LvnTexture*>& textures, LvnTexture* placeholder)
+	{
+		if (placeholder == nullptr) { return nullptr; }
+		return textures[reinterpret_cast<uintptr_t>(placeholder) - 1];
+	}
 }
 
-LvnModel loadGltfModel(const char* filepath)
+gltfs::gltfLoadData* loadGltfModelData(const char* filepath)
 {
-	gltfs::gltfLoadData gltfData{};
+	LVN_PROFILE_FUNCTION();
+
+	// held by unique_ptr until loading finished so that it is freed if the json parser throws on a malformed file
+	std::unique_ptr<gltfs::gltfLoadData> gltfData = std::make_unique<gltfs::gltfLoadData>();
 	std::string jsonText = lvn::loadFileSrc(filepath);
-	gltfData.JSON = nlm::json::parse(jsonText);
-	gltfData.binData = gltfs::getData(gltfData.JSON, filepath);
-	gltfData.filepath = filepath;
-	gltfData.filetype = Lvn_FileType_Gltf;
+	gltfData->JSON = nlm::json::parse(jsonText);
+	gltfData->fileData = gltfs::getData(gltfData->JSON, filepath);
+	gltfData->binData = gltfData->fileData;
+	gltfData->filepath = filepath;
+	gltfData->filetype = Lvn_FileType_Gltf;
 
-	nlm::json JSON = gltfData.JSON;
+	nlm::json JSON = gltfData->JSON;
 
 	uint32_t scene = JSON.value("scene", 0);
 
 	for (uint32_t i = 0; i < JSON["scenes"][scene]["nodes"].size(); i++) // curent impl only supports loading first scene
-		gltfs::traverseNode(&gltfData, JSON["scenes"][0]["nodes"][i], LvnMat4(1.0f));
-
-	LvnModel model{};
-	model.meshes = LvnData(gltfData.meshes.data(), gltfData.meshes.size());
-	model.textures = LvnData(gltfData.textures.data(), gltfData.textures.size());
-	model.modelMatrix = LvnMat4(1.0f);
+		gltfs::traverseNode(gltfData.get(), JSON["scenes"][0]["nodes"][i], LvnMat4(1.0f));
 
-	return model;
+	return gltfData.release();
 }
 
-LvnModel loadGlbModel(const char* filepath)
+gltfs::gltfLoadData* loadGlbModelData(const char* filepath)
 {
-	LvnBin binData = lvn::loadFileSrcBin(filepath);
+	LVN_PROFILE_FUNCTION();
+
+	// held by unique_ptr until loading finished so that it is freed if the json parser throws on a malformed file
+	std::unique_ptr<gltfs::gltfLoadData> gltfData = std::make_unique<gltfs::gltfLoadData>();
+	gltfData->fileData = lvn::loadFileSrcBin(filepath);
+	LvnBin& binData = gltfData->fileData;
+
+	// header (magic, version, length) followed by the header of chunk 0
+	static const uint32_t s_GlbMagic = 0x46546C67; // "glTF"
+	uint32_t magic = 0;
+	if (binData.size() >= 20) { memcpy(&magic, &binData[0], sizeof(uint32_t)); }
+	if (magic != s_GlbMagic)
+	{
+		LVN_CORE_ERROR("loadGlbModelData(const char*) | file is not a valid glb file, filepath: %s", filepath);
+		return nullptr;
+	}
 
 	// chunk 0 (JSON)
 	uint32_t chunkLengthJson = 0;
 	memcpy(&chunkLengthJson, &binData[12], sizeof(uint32_t));
-	std::vector<uint8_t> chunkDataJson(&binData[20], &binData[20] + chunkLengthJson);
-
-	// chunk 1 (Buffer)
-	uint32_t chunkLengthBuffer = 0;
-	memcpy(&chunkLengthBuffer, &binData[20 + chunkLengthJson], sizeof(uint32_t));
-	std::vector<uint8_t> chunkDataBuffer(&binData[28 + chunkLengthJson], &binData[28 + chunkLengthJson] + chunkLengthBuffer);
+	if (binData.size() < 20ull + chunkLengthJson)
+	{
+		LVN_CORE_ERROR("loadGlbModelData(const char*) | json chunk is larger than the file, filepath: %s", filepath);
+		return nullptr;
+	}
+	gltfData->JSON = nlm::json::parse(&binData[20], &binData[20] + chunkLengthJson);
 
-	gltfs::gltfLoadData gltfData{};
-	std::string jsonText = std::string(chunkDataJson.begin(), chunkDataJson.end());
-	gltfData.JSON = nlm::json::parse(jsonText);
-	gltfData.binData = LvnBin(chunkDataBuffer.data(), chunkDataBuffer.size());
-	gltfData.filepath = filepath;
-	gltfData.filetype = Lvn_FileType_Glb;
+	// chunk 1 (Buffer), viewed in place instead of copied out of the file data, the buffer chunk is optional
+	if (binData.size() >= 28ull + chunkLengthJson)
+	{
+		uint32_t chunkLengthBuffer = 0;
+		memcpy(&chunkLengthBuffer, &binData[20 + chunkLengthJson], sizeof(uint32_t));
+		if (binData.size() < 28ull + chunkLengthJson + chunkLengthBuffer)
+		{
+			LVN_CORE_ERROR("loadGlbModelData(const char*) | buffer chunk is larger than the file, filepath: %s", filepath);
+			return nullptr;
+		}
+		gltfData->binData = LvnSpan<const uint8_t>(&binData[28 + chunkLengthJson], chunkLengthBuffer);
+	}
+	gltfData->filepath = filepath;
+	gltfData->filetype = Lvn_FileType_Glb;
 
-	nlm::json JSON = gltfData.JSON;
+	nlm::json JSON = gltfData->JSON;
 
 	for (uint32_t i = 0; i < JSON["scenes"][0]["nodes"].size(); i++) // curent impl only supports loading first scene
-		gltfs::traverseNode(&gltfData, JSON["scenes"][0]["nodes"][i], LvnMat4(1.0f));
+		gltfs::traverseNode(gltfData.get(), JSON["scenes"][0]["nodes"][i], LvnMat4(1.0f));
+
+	return gltfData.release();
+}
+
+LvnModel createModelFromData(gltfs::gltfLoadData* gltfData)
+{
+	LVN_PROFILE_FUNCTION();
+	std::vector<LvnTexture*> textures(gltfData->pendingTextures.size());
+	for (uint32_t i = 0; i < gltfData->pendingTextures.size(); i++)
+		lvn::createTexture(&textures[i], &gltfData->pendingTextures[i]);
+
+	std::vector<LvnMesh> meshes(gltfData->meshes.size());
+	for (uint32_t i = 0; i < gltfData->meshes.size(); i++)
+	{
+		gltfs::gltfPendingMesh& pending = gltfData->meshes[i];
+
+		LvnMaterial material = pending.material;
+		material.albedo = gltfs::resolveTexture(textures, material.albedo);
+		material.metallicRoughnessOcclusion = gltfs::resolveTexture(textures, material.metallicRoughnessOcclusion);
+		material.normal = gltfs::resolveTexture(textures, material.normal);
+		material.emissive = gltfs::resolveTexture(textures, material.emissive);
+
+		LvnMeshCreateInfo meshCreateInfo{};
+
+		LvnBufferCreateInfo meshBufferInfo = lvn::meshGetVertexBufferCreateInfoConfig(pending.vertices.data(), pending.vertices.size(), pending.indices.data(), pending.indices.size());
+		meshCreateInfo.bufferInfo = &meshBufferInfo;
+		meshCreateInfo.material = material;
+
+		LvnMesh& mesh = meshes[i];
+		mesh = lvn::createMesh(&meshCreateInfo);
+		lvn::meshSetMatrix(&mesh, pending.matrix);
+		mesh.bounds = pending.bounds;
+		mesh.vertexCount = pending.vertices.size();
+		mesh.indexCount = pending.indices.size();
+	}
 
 	LvnModel model{};
-	model.meshes = LvnData(gltfData.meshes.data(), gltfData.meshes.size());
-	model.textures = LvnData(gltfData.textures.data(), gltfData.textures.size());
+	model.meshes = LvnData(meshes.data(), meshes.size());
+	model.textures = LvnData(textures.data(), textures.size());
 	model.modelMatrix = LvnMat4(1.0f);
 
+	lvn::freeModelData(gltfData);
 	return model;
 }
 
+void freeModelData(gltfs::gltfLoadData* gltfData)
+{
+	delete gltfData;
+}
+
+LvnModel loadGltfModel(const char* filepath)
+{
+	gltfs::gltfLoadData* gltfData = lvn::loadGltfModelData(filepath);
+	if (!gltfData) { return {}; }
+
+	return lvn::createModelFromData(gltfData);
+}
+
+LvnModel loadGlbModel(const char* filepath)
+{
+	gltfs::gltfLoadData* gltfData = lvn::loadGlbModelData(filepath);
+	if (!gltfData) { return {}; }
+
+	return lvn::createModelFromData(gltfData);
+}
+
 } /* namespace lvn */
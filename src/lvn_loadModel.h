@@ -5,8 +5,16 @@
 
 namespace lvn
 {
+	namespace gltfs { struct gltfLoadData; }
+
 	LvnModel loadGltfModel(const char* filepath);
 	LvnModel loadGlbModel(const char* filepath);
+
+	// two stage loading used by loadModelAsync, the data functions only read and decode the file and are safe to call from any thread
+	gltfs::gltfLoadData* loadGltfModelData(const char* filepath);
+	gltfs::gltfLoadData* loadGlbModelData(const char* filepath);
+	LvnModel createModelFromData(gltfs::gltfLoadData* gltfData);    // creates the textures and mesh buffers of the model and frees the data
+	void freeModelData(gltfs::gltfLoadData* gltfData);
 }
 
 #endif
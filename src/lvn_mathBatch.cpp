@@ -0,0 +1,515 @@
+#include "levikno.h"
+
+#include <mutex>
+
+// INFO: batched vector kernels, arrays are processed 8 vectors at a time with avx2 when the cpu supports it,
+//       4 at a time with sse otherwise, the remaining vectors at the end of the array use the scalar loop
+//       AoS LvnVec3 arrays are loaded as three registers and deinterleaved into x, y, z registers
+
+#if defined(LVN_MATH_SIMD_SSE)
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define LVN_TARGET_AVX2
+	#else
+		#define LVN_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#endif
+#endif
+
+static_assert(sizeof(LvnVec3) == sizeof(float) * 3, "batch kernels expect LvnVec3 to be three tightly packed floats");
+
+struct LvnMathBatchKernels
+{
+	const char* name;
+	void (*transformAoS)(const LvnMat4& m, float tw, const LvnVec3* pIn, LvnVec3* pOut, size_t count);
+	void (*transformSoA)(const LvnMat4& m, float tw, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+	void (*normalizeAoS)(const LvnVec3* pIn, LvnVec3* pOut, size_t count);
+	void (*dotAoS)(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count);
+	void (*aosToSoA)(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+	void (*soaToAoS)(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count);
+};
+
+namespace lvn
+{
+
+// ------------------------------------------------------------
+// scalar, used for the tail of the simd kernels and when no simd instruction set is available
+// ------------------------------------------------------------
+
+// tw is the w component of the input vectors, 1 for points and 0 for directions
+static void scalarTransformAoS(const LvnMat4& m, float tw, const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		const float x = pIn[i].x, y = pIn[i].y, z = pIn[i].z;
+		pOut[i].x = m[0].x * x + m[1].x * y + m[2].x * z + m[3].x * tw;
+		pOut[i].y = m[0].y * x + m[1].y * y + m[2].y * z + m[3].y * tw;
+		pOut[i].z = m[0].z * x + m[1].z * y + m[2].z * z + m[3].z * tw;
+	}
+}
+
+static void scalarTransformSoA(const LvnMat4& m, float tw, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		const float x = pInX[i], y = pInY[i], z = pInZ[i];
+		pOutX[i] = m[0].x * x + m[1].x * y + m[2].x * z + m[3].x * tw;
+		pOutY[i] = m[0].y * x + m[1].y * y + m[2].y * z + m[3].y * tw;
+		pOutZ[i] = m[0].z * x + m[1].z * y + m[2].z * z + m[3].z * tw;
+	}
+}
+
+static void scalarNormalizeAoS(const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		const float x = pIn[i].x, y = pIn[i].y, z = pIn[i].z;
+		const float u = 1.0f / sqrt(x * x + y * y + z * z);
+		pOut[i].x = x * u;
+		pOut[i].y = y * u;
+		pOut[i].z = z * u;
+	}
+}
+
+static void scalarDotAoS(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		pOut[i] = pA[i].x * pB[i].x + pA[i].y * pB[i].y + pA[i].z * pB[i].z;
+}
+
+static void scalarAoSToSoA(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		pOutX[i] = pIn[i].x;
+		pOutY[i] = pIn[i].y;
+		pOutZ[i] = pIn[i].z;
+	}
+}
+
+static void scalarSoAToAoS(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		pOut[i].x = pInX[i];
+		pOut[i].y = pInY[i];
+		pOut[i].z = pInZ[i];
+	}
+}
+
+static const LvnMathBatchKernels s_ScalarKernels =
+{
+	"scalar",
+	lvn::scalarTransformAoS,
+	lvn::scalarTransformSoA,
+	lvn::scalarNormalizeAoS,
+	lvn::scalarDotAoS,
+	lvn::scalarAoSToSoA,
+	lvn::scalarSoAToAoS,
+};
+
+#if defined(LVN_MATH_SIMD_SSE)
+
+// ------------------------------------------------------------
+// sse, 4 vectors at a time
+// ------------------------------------------------------------
+
+// a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+static inline void sseDeinterleave(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+{
+	x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 2)), _MM_SHUFFLE(3, 0, 3, 0));
+	y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static inline void sseInterleave(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+{
+	a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+	c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static inline void sseLoadAoS(const LvnVec3* pIn, __m128& x, __m128& y, __m128& z)
+{
+	const float* src = &pIn->x;
+	lvn::sseDeinterleave(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+}
+
+static inline void sseStoreAoS(LvnVec3* pOut, __m128 x, __m128 y, __m128 z)
+{
+	__m128 a, b, c;
+	lvn::sseInterleave(x, y, z, a, b, c);
+	float* dst = &pOut->x;
+	_mm_storeu_ps(dst, a);
+	_mm_storeu_ps(dst + 4, b);
+	_mm_storeu_ps(dst + 8, c);
+}
+
+struct LvnSseMat3x4
+{
+	__m128 m[4][3]; // m[column][row] broadcast to every lane, the translation column is already multiplied by tw
+
+	LvnSseMat3x4(const LvnMat4& mat, float tw)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			const float s = i == 3 ? tw : 1.0f;
+			m[i][0] = _mm_set1_ps(mat[i].x * s);
+			m[i][1] = _mm_set1_ps(mat[i].y * s);
+			m[i][2] = _mm_set1_ps(mat[i].z * s);
+		}
+	}
+
+	void transform(__m128 x, __m128 y, __m128 z, __m128& ox, __m128& oy, __m128& oz) const
+	{
+		ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][0], x), _mm_mul_ps(m[1][0], y)), _mm_add_ps(_mm_mul_ps(m[2][0], z), m[3][0]));
+		oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][1], x), _mm_mul_ps(m[1][1], y)), _mm_add_ps(_mm_mul_ps(m[2][1], z), m[3][1]));
+		oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][2], x), _mm_mul_ps(m[1][2], y)), _mm_add_ps(_mm_mul_ps(m[2][2], z), m[3][2]));
+	}
+};
+
+static void sseTransformAoS(const LvnMat4& m, float tw, const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	const LvnSseMat3x4 mat(m, tw);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 x, y, z;
+		lvn::sseLoadAoS(pIn + i, x, y, z);
+		mat.transform(x, y, z, x, y, z);
+		lvn::sseStoreAoS(pOut + i, x, y, z);
+	}
+
+	lvn::scalarTransformAoS(m, tw, pIn + i, pOut + i, count - i);
+}
+
+static void sseTransformSoA(const LvnMat4& m, float tw, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	const LvnSseMat3x4 mat(m, tw);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 x, y, z;
+		mat.transform(_mm_loadu_ps(pInX + i), _mm_loadu_ps(pInY + i), _mm_loadu_ps(pInZ + i), x, y, z);
+		_mm_storeu_ps(pOutX + i, x);
+		_mm_storeu_ps(pOutY + i, y);
+		_mm_storeu_ps(pOutZ + i, z);
+	}
+
+	lvn::scalarTransformSoA(m, tw, pInX + i, pInY + i, pInZ + i, pOutX + i, pOutY + i, pOutZ + i, count - i);
+}
+
+static void sseNormalizeAoS(const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 x, y, z;
+		lvn::sseLoadAoS(pIn + i, x, y, z);
+		__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+		__m128 u = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+		lvn::sseStoreAoS(pOut + i, _mm_mul_ps(x, u), _mm_mul_ps(y, u), _mm_mul_ps(z, u));
+	}
+
+	lvn::scalarNormalizeAoS(pIn + i, pOut + i, count - i);
+}
+
+static void sseDotAoS(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count)
+{
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 ax, ay, az, bx, by, bz;
+		lvn::sseLoadAoS(pA + i, ax, ay, az);
+		lvn::sseLoadAoS(pB + i, bx, by, bz);
+		_mm_storeu_ps(pOut + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)));
+	}
+
+	lvn::scalarDotAoS(pA + i, pB + i, pOut + i, count - i);
+}
+
+static void sseAoSToSoA(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 x, y, z;
+		lvn::sseLoadAoS(pIn + i, x, y, z);
+		_mm_storeu_ps(pOutX + i, x);
+		_mm_storeu_ps(pOutY + i, y);
+		_mm_storeu_ps(pOutZ + i, z);
+	}
+
+	lvn::scalarAoSToSoA(pIn + i, pOutX + i, pOutY + i, pOutZ + i, count - i);
+}
+
+static void sseSoAToAoS(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count)
+{
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		lvn::sseStoreAoS(pOut + i, _mm_loadu_ps(pInX + i), _mm_loadu_ps(pInY + i), _mm_loadu_ps(pInZ + i));
+
+	lvn::scalarSoAToAoS(pInX + i, pInY + i, pInZ + i, pOut + i, count - i);
+}
+
+static const LvnMathBatchKernels s_SseKernels =
+{
+	"sse",
+	lvn::sseTransformAoS,
+	lvn::sseTransformSoA,
+	lvn::sseNormalizeAoS,
+	lvn::sseDotAoS,
+	lvn::sseAoSToSoA,
+	lvn::sseSoAToAoS,
+};
+
+// ------------------------------------------------------------
+// avx2, 8 vectors at a time, only called after checking that the cpu supports avx2 and fma
+// ------------------------------------------------------------
+
+// the 8 vectors are split so that the low 128 bit lanes hold vectors 0-3 and the high lanes hold vectors 4-7,
+// each lane is then deinterleaved the same way as sse
+LVN_TARGET_AVX2 static inline void avx2LoadAoS(const LvnVec3* pIn, __m256& x, __m256& y, __m256& z)
+{
+	const float* src = &pIn->x;
+	const __m256 r0 = _mm256_loadu_ps(src);        // x0 y0 z0 x1 | y1 z1 x2 y2
+	const __m256 r1 = _mm256_loadu_ps(src + 8);    // z2 x3 y3 z3 | x4 y4 z4 x5
+	const __m256 r2 = _mm256_loadu_ps(src + 16);   // y5 z5 x6 y6 | z6 x7 y7 z7
+
+	const __m256 a = _mm256_permute2f128_ps(r0, r1, 0x30); // x0 y0 z0 x1 | x4 y4 z4 x5
+	const __m256 b = _mm256_permute2f128_ps(r0, r2, 0x21); // y1 z1 x2 y2 | y5 z5 x6 y6
+	const __m256 c = _mm256_permute2f128_ps(r1, r2, 0x30); // z2 x3 y3 z3 | z6 x7 y7 z7
+
+	x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 2)), _MM_SHUFFLE(3, 0, 3, 0));
+	y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+LVN_TARGET_AVX2 static inline void avx2StoreAoS(LvnVec3* pOut, __m256 x, __m256 y, __m256 z)
+{
+	const __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+	float* dst = &pOut->x;
+	_mm256_storeu_ps(dst, _mm256_permute2f128_ps(a, b, 0x20));
+	_mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(c, a, 0x30));
+	_mm256_storeu_ps(dst + 16, _mm256_permute2f128_ps(b, c, 0x31));
+}
+
+struct LvnAvx2Mat3x4
+{
+	__m256 m[4][3]; // m[column][row] broadcast to every lane, the translation column is already multiplied by tw
+};
+
+LVN_TARGET_AVX2 static inline void avx2LoadMat3x4(LvnAvx2Mat3x4& mat, const LvnMat4& m, float tw)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		const float s = i == 3 ? tw : 1.0f;
+		mat.m[i][0] = _mm256_set1_ps(m[i].x * s);
+		mat.m[i][1] = _mm256_set1_ps(m[i].y * s);
+		mat.m[i][2] = _mm256_set1_ps(m[i].z * s);
+	}
+}
+
+LVN_TARGET_AVX2 static inline void avx2Transform(const LvnAvx2Mat3x4& mat, __m256 x, __m256 y, __m256 z, __m256& ox, __m256& oy, __m256& oz)
+{
+	ox = _mm256_fmadd_ps(mat.m[0][0], x, _mm256_fmadd_ps(mat.m[1][0], y, _mm256_fmadd_ps(mat.m[2][0], z, mat.m[3][0])));
+	oy = _mm256_fmadd_ps(mat.m[0][1], x, _mm256_fmadd_ps(mat.m[1][1], y, _mm256_fmadd_ps(mat.m[2][1], z, mat.m[3][1])));
+	oz = _mm256_fmadd_ps(mat.m[0][2], x, _mm256_fmadd_ps(mat.m[1][2], y, _mm256_fmadd_ps(mat.m[2][2], z, mat.m[3][2])));
+}
+
+LVN_TARGET_AVX2 static void avx2TransformAoS(const LvnMat4& m, float tw, const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	LvnAvx2Mat3x4 mat;
+	lvn::avx2LoadMat3x4(mat, m, tw);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256 x, y, z;
+		lvn::avx2LoadAoS(pIn + i, x, y, z);
+		lvn::avx2Transform(mat, x, y, z, x, y, z);
+		lvn::avx2StoreAoS(pOut + i, x, y, z);
+	}
+
+	lvn::sseTransformAoS(m, tw, pIn + i, pOut + i, count - i);
+}
+
+LVN_TARGET_AVX2 static void avx2TransformSoA(const LvnMat4& m, float tw, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	LvnAvx2Mat3x4 mat;
+	lvn::avx2LoadMat3x4(mat, m, tw);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256 x, y, z;
+		lvn::avx2Transform(mat, _mm256_loadu_ps(pInX + i), _mm256_loadu_ps(pInY + i), _mm256_loadu_ps(pInZ + i), x, y, z);
+		_mm256_storeu_ps(pOutX + i, x);
+		_mm256_storeu_ps(pOutY + i, y);
+		_mm256_storeu_ps(pOutZ + i, z);
+	}
+
+	lvn::sseTransformSoA(m, tw, pInX + i, pInY + i, pInZ + i, pOutX + i, pOutY + i, pOutZ + i, count - i);
+}
+
+LVN_TARGET_AVX2 static void avx2NormalizeAoS(const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	const __m256 one = _mm256_set1_ps(1.0f);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256 x, y, z;
+		lvn::avx2LoadAoS(pIn + i, x, y, z);
+		__m256 lengthSq = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+		__m256 u = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSq));
+		lvn::avx2StoreAoS(pOut + i, _mm256_mul_ps(x, u), _mm256_mul_ps(y, u), _mm256_mul_ps(z, u));
+	}
+
+	lvn::sseNormalizeAoS(pIn + i, pOut + i, count - i);
+}
+
+LVN_TARGET_AVX2 static void avx2DotAoS(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256 ax, ay, az, bx, by, bz;
+		lvn::avx2LoadAoS(pA + i, ax, ay, az);
+		lvn::avx2LoadAoS(pB + i, bx, by, bz);
+		_mm256_storeu_ps(pOut + i, _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_mul_ps(az, bz))));
+	}
+
+	lvn::sseDotAoS(pA + i, pB + i, pOut + i, count - i);
+}
+
+LVN_TARGET_AVX2 static void avx2AoSToSoA(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256 x, y, z;
+		lvn::avx2LoadAoS(pIn + i, x, y, z);
+		_mm256_storeu_ps(pOutX + i, x);
+		_mm256_storeu_ps(pOutY + i, y);
+		_mm256_storeu_ps(pOutZ + i, z);
+	}
+
+	lvn::sseAoSToSoA(pIn + i, pOutX + i, pOutY + i, pOutZ + i, count - i);
+}
+
+LVN_TARGET_AVX2 static void avx2SoAToAoS(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		lvn::avx2StoreAoS(pOut + i, _mm256_loadu_ps(pInX + i), _mm256_loadu_ps(pInY + i), _mm256_loadu_ps(pInZ + i));
+
+	lvn::sseSoAToAoS(pInX + i, pInY + i, pInZ + i, pOut + i, count - i);
+}
+
+static const LvnMathBatchKernels s_Avx2Kernels =
+{
+	"avx2",
+	lvn::avx2TransformAoS,
+	lvn::avx2TransformSoA,
+	lvn::avx2NormalizeAoS,
+	lvn::avx2DotAoS,
+	lvn::avx2AoSToSoA,
+	lvn::avx2SoAToAoS,
+};
+
+static bool cpuSupportsAvx2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) { return false; }
+
+	__cpuid(info, 1);
+	const bool fma = (info[2] & (1 << 12)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	if (!fma || !osxsave) { return false; }
+
+	// the os has to save the ymm registers on context switches
+	if ((_xgetbv(0) & 0x6) != 0x6) { return false; }
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+
+#endif
+
+static const LvnMathBatchKernels& getMathBatchKernels()
+{
+	static const LvnMathBatchKernels* s_Kernels = nullptr;
+	static std::once_flag s_KernelsOnce;
+
+	std::call_once(s_KernelsOnce, []()
+	{
+#if defined(LVN_MATH_SIMD_SSE)
+		s_Kernels = lvn::cpuSupportsAvx2() ? &s_Avx2Kernels : &s_SseKernels;
+#else
+		s_Kernels = &s_ScalarKernels;
+#endif
+	});
+
+	return *s_Kernels;
+}
+
+const char* mathGetBatchInstructionSet()
+{
+	return lvn::getMathBatchKernels().name;
+}
+
+void transformPoints(const LvnMat4& matrix, const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	lvn::getMathBatchKernels().transformAoS(matrix, 1.0f, pIn, pOut, count);
+}
+
+void transformDirections(const LvnMat4& matrix, const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	lvn::getMathBatchKernels().transformAoS(matrix, 0.0f, pIn, pOut, count);
+}
+
+void transformPointsSoA(const LvnMat4& matrix, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	lvn::getMathBatchKernels().transformSoA(matrix, 1.0f, pInX, pInY, pInZ, pOutX, pOutY, pOutZ, count);
+}
+
+void transformDirectionsSoA(const LvnMat4& matrix, const float* pInX, const float* pInY, const float* pInZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	lvn::getMathBatchKernels().transformSoA(matrix, 0.0f, pInX, pInY, pInZ, pOutX, pOutY, pOutZ, count);
+}
+
+void normalizeVectors(const LvnVec3* pIn, LvnVec3* pOut, size_t count)
+{
+	lvn::getMathBatchKernels().normalizeAoS(pIn, pOut, count);
+}
+
+void dotVectors(const LvnVec3* pA, const LvnVec3* pB, float* pOut, size_t count)
+{
+	lvn::getMathBatchKernels().dotAoS(pA, pB, pOut, count);
+}
+
+void vectorsAoSToSoA(const LvnVec3* pIn, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+	lvn::getMathBatchKernels().aosToSoA(pIn, pOutX, pOutY, pOutZ, count);
+}
+
+void vectorsSoAToAoS(const float* pInX, const float* pInY, const float* pInZ, LvnVec3* pOut, size_t count)
+{
+	lvn::getMathBatchKernels().soaToAoS(pInX, pInY, pInZ, pOut, count);
+}
+
+} /* namespace lvn */
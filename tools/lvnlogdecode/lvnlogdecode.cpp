@@ -0,0 +1,321 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "levikno_internal.h"
+
+// INFO: lvnlogdecode turns the binary log files written by binary log sinks back into text,
+//       the messages are formatted with the log pattern recorded in the file (or the one given with -p)
+//
+// usage: lvnlogdecode <input> [-o output] [-p pattern]
+
+
+struct BinaryReader
+{
+	const char* data;
+	size_t size;
+	size_t pos;
+
+	bool read(void* dst, size_t length)
+	{
+		if (pos + length > size) { return false; }
+		memcpy(dst, data + pos, length);
+		pos += length;
+		return true;
+	}
+
+	bool readString(std::string* dst, size_t length)
+	{
+		if (pos + length > size) { return false; }
+		dst->assign(data + pos, length);
+		pos += length;
+		return true;
+	}
+};
+
+template <typename T>
+static void appendFormatted(std::string& out, const std::string& spec, T value)
+{
+	int length = snprintf(nullptr, 0, spec.c_str(), value);
+	if (length <= 0) { return; }
+
+	size_t offset = out.size();
+	out.resize(offset + length + 1);
+	snprintf(&out[offset], length + 1, spec.c_str(), value);
+	out.resize(offset + length);
+}
+
+// formats the recorded arguments with the format string, each specifier is passed to snprintf on its own
+static std::string decodeMessage(const std::string& fmt, const char* args, size_t argSize)
+{
+	std::string out;
+	BinaryReader reader = { args, argSize, 0 };
+
+	const char* p = fmt.c_str();
+	LvnLogFormatSpec spec;
+
+	while (lvn::logNextFormatSpec(p, &spec))
+	{
+		out.append(p, spec.begin - p);
+		p = spec.end;
+
+		if (spec.conversion == '\0') { break; }
+		if (spec.argType == Lvn_LogArgType_None)
+		{
+			if (spec.conversion == '%') { out += '%'; }
+			continue;
+		}
+
+		int64_t width = spec.width, precision = spec.precision;
+		if (spec.widthArg && !reader.read(&width, sizeof(int64_t))) { break; }
+		if (spec.precisionArg && !reader.read(&precision, sizeof(int64_t))) { break; }
+
+		// rebuild the specifier with the '*' values filled in
+		std::string specStr = "%";
+		specStr.append(spec.flags, spec.flagsLength);
+		if (width < 0 && spec.widthArg) { specStr += '-'; width = -width; }
+		if (width >= 0) { specStr += std::to_string(width); }
+		if (precision >= 0) { specStr += "." + std::to_string(precision); }
+
+		switch (spec.argType)
+		{
+			case Lvn_LogArgType_Int:
+			{
+				int64_t value;
+				if (!reader.read(&value, sizeof(int64_t))) { return out; }
+
+				if (spec.conversion == 'c')
+					appendFormatted(out, specStr + 'c', static_cast<int>(value));
+				else
+					appendFormatted(out, specStr + "ll" + spec.conversion, static_cast<long long>(value));
+				break;
+			}
+			case Lvn_LogArgType_Uint:
+			{
+				uint64_t value;
+				if (!reader.read(&value, sizeof(uint64_t))) { return out; }
+				appendFormatted(out, specStr + "ll" + spec.conversion, static_cast<unsigned long long>(value));
+				break;
+			}
+			case Lvn_LogArgType_Double:
+			{
+				double value;
+				if (!reader.read(&value, sizeof(double))) { return out; }
+				appendFormatted(out, specStr + spec.conversion, value);
+				break;
+			}
+			case Lvn_LogArgType_String:
+			{
+				uint32_t length;
+				std::string value;
+				if (!reader.read(&length, sizeof(uint32_t)) || !reader.readString(&value, length)) { return out; }
+				appendFormatted(out, specStr + 's', value.c_str());
+				break;
+			}
+			case Lvn_LogArgType_Pointer:
+			{
+				uint64_t value;
+				if (!reader.read(&value, sizeof(uint64_t))) { return out; }
+				appendFormatted(out, specStr + 'p', reinterpret_cast<void*>(static_cast<uintptr_t>(value)));
+				break;
+			}
+			default: { break; }
+		}
+	}
+
+	out += p;
+	return out;
+}
+
+static bool readFile(const char* filepath, std::vector<char>* data)
+{
+	FILE* file = fopen(filepath, "rb");
+	if (!file) { return false; }
+
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	data->resize(size > 0 ? size : 0);
+	size_t read = fread(data->data(), 1, data->size(), file);
+	fclose(file);
+
+	return read == data->size();
+}
+
+int main(int argc, char** argv)
+{
+	const char* inputPath = nullptr;
+	const char* outputPath = nullptr;
+	const char* patternOverride = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-o" && i + 1 < argc) { outputPath = argv[++i]; }
+		else if (arg == "-p" && i + 1 < argc) { patternOverride = argv[++i]; }
+		else if (!inputPath) { inputPath = argv[i]; }
+		else { inputPath = nullptr; break; }
+	}
+
+	if (!inputPath)
+	{
+		fprintf(stderr, "usage: lvnlogdecode <input> [-o output] [-p pattern]\n");
+		return 1;
+	}
+
+	std::vector<char> data;
+	if (!readFile(inputPath, &data))
+	{
+		fprintf(stderr, "lvnlogdecode: failed to read file: \"%s\"\n", inputPath);
+		return 1;
+	}
+
+	LvnContextCreateInfo lvnCreateInfo{};
+	lvnCreateInfo.logging.enableLogging = true;
+	lvnCreateInfo.logging.disableCoreLogging = true;
+	lvn::createContext(&lvnCreateInfo);
+
+	// the name and pattern of the logger are set from each header in the file
+	LvnLogSinkCreateInfo sinkCreateInfo{};
+	sinkCreateInfo.type = outputPath ? Lvn_LogSinkType_File : Lvn_LogSinkType_Stdout;
+	sinkCreateInfo.logLevel = Lvn_LogLevel_None;
+	sinkCreateInfo.filepath = outputPath;
+
+	LvnLoggerCreateInfo loggerCreateInfo{};
+	loggerCreateInfo.loggerName = "lvnlogdecode";
+	loggerCreateInfo.logPatternFormat = patternOverride ? patternOverride : "%v%$";
+	loggerCreateInfo.logLevel = Lvn_LogLevel_None;
+	loggerCreateInfo.pSinks = &sinkCreateInfo;
+	loggerCreateInfo.sinkCount = 1;
+
+	LvnLogger* logger;
+	if (lvn::createLogger(&logger, &loggerCreateInfo) != Lvn_Result_Success)
+	{
+		fprintf(stderr, "lvnlogdecode: failed to open output file: \"%s\"\n", outputPath);
+		lvn::terminateContext();
+		return 1;
+	}
+
+	BinaryReader reader = { data.data(), data.size(), 0 };
+	std::vector<std::string> formats;
+	std::string loggerName;
+	int64_t anchorEpochNs = 0;
+	uint64_t anchorNs = 0;
+	bool headerRead = false;
+	int result = 0;
+
+	while (reader.pos < reader.size)
+	{
+		size_t recordPos = reader.pos;
+		uint8_t recordType;
+		reader.read(&recordType, sizeof(uint8_t));
+
+		bool complete = false;
+		switch (recordType)
+		{
+			case Lvn_LogBinaryRecord_Header:
+			{
+				char magic[8];
+				uint32_t version, endianCheck;
+				uint16_t nameLength, patternLength;
+				std::string pattern;
+
+				// check the version before reading the rest, older versions have a different header layout
+				if (!reader.read(magic, sizeof(magic)) || !reader.read(&version, sizeof(uint32_t)) || !reader.read(&endianCheck, sizeof(uint32_t)))
+					break;
+
+				if (memcmp(magic, LVN_LOG_BINARY_MAGIC, sizeof(magic)) != 0 || version != LVN_LOG_BINARY_VERSION || endianCheck != LVN_LOG_BINARY_ENDIAN_CHECK)
+				{
+					fprintf(stderr, "lvnlogdecode: unsupported log file version or byte order at offset %zu\n", recordPos);
+					reader.pos = reader.size;
+					result = 1;
+					complete = true;
+					break;
+				}
+
+				if (!reader.read(&anchorEpochNs, sizeof(int64_t)) || !reader.read(&anchorNs, sizeof(uint64_t)) ||
+					!reader.read(&nameLength, sizeof(uint16_t)) || !reader.read(&patternLength, sizeof(uint16_t)) ||
+					!reader.readString(&loggerName, nameLength) || !reader.readString(&pattern, patternLength))
+					break;
+
+				lvn::logRenameLogger(logger, loggerName.c_str());
+				if (!patternOverride && !pattern.empty())
+					lvn::logSetPatternFormat(logger, pattern.c_str());
+
+				formats.clear();
+				headerRead = true;
+				complete = true;
+				break;
+			}
+			case Lvn_LogBinaryRecord_Format:
+			{
+				uint32_t formatId, length;
+				std::string format;
+				if (!reader.read(&formatId, sizeof(uint32_t)) || !reader.read(&length, sizeof(uint32_t)) || !reader.readString(&format, length))
+					break;
+
+				if (formatId >= formats.size()) { formats.resize(formatId + 1); }
+				formats[formatId] = std::move(format);
+				complete = true;
+				break;
+			}
+			case Lvn_LogBinaryRecord_Message:
+			{
+				uint8_t level;
+				uint32_t formatId, argSize;
+				uint64_t timeNs;
+				if (!reader.read(&level, sizeof(uint8_t)) || !reader.read(&formatId, sizeof(uint32_t)) ||
+					!reader.read(&timeNs, sizeof(uint64_t)) || !reader.read(&argSize, sizeof(uint32_t)) || reader.pos + argSize > reader.size)
+					break;
+
+				const char* args = reader.data + reader.pos;
+				reader.pos += argSize;
+				complete = true;
+
+				if (!headerRead || formatId >= formats.size())
+				{
+					fprintf(stderr, "lvnlogdecode: message with unknown format id (%u) at offset %zu\n", formatId, recordPos);
+					result = 1;
+					break;
+				}
+
+				std::string text = decodeMessage(formats[formatId], args, argSize);
+
+				// message times are relative to the anchor of the last header, rounded down to whole seconds for the date fields
+				int64_t epochNs = anchorEpochNs + static_cast<int64_t>(timeNs - anchorNs);
+				int64_t timeEpoch = epochNs / 1000000000;
+				if (epochNs % 1000000000 < 0) { timeEpoch--; }
+
+				LvnLogMessage logMsg{};
+				logMsg.msg = text.c_str();
+				logMsg.loggerName = loggerName.c_str();
+				logMsg.level = static_cast<LvnLogLevel>(level);
+				logMsg.timeEpoch = timeEpoch;
+				lvn::logOutputMessage(logger, &logMsg);
+				break;
+			}
+			default:
+			{
+				fprintf(stderr, "lvnlogdecode: unknown record type (%u) at offset %zu, file may be corrupted\n", recordType, recordPos);
+				reader.pos = reader.size;
+				result = 1;
+				complete = true;
+				break;
+			}
+		}
+
+		// the last record can be cut off if the program was terminated while writing
+		if (!complete)
+		{
+			fprintf(stderr, "lvnlogdecode: truncated record at offset %zu\n", recordPos);
+			result = 1;
+			break;
+		}
+	}
+
+	lvn::destroyLogger(logger);
+	lvn::terminateContext();
+
+	return result;
+}